@@ -0,0 +1,3839 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <math.h>
+#include <limits.h>
+#include <stdint.h>
+#include <sched.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include "cobertura.h"
+#include "solucionadorGuloso.h"
+#include "solucionadorBacktracking.h"
+
+/**
+ * @brief Registra na contabilidade uma variação dos bytes em uso.
+ *
+ * @param contabilidade Contabilidade a atualizar (pode ser NULL).
+ * @param liberados Bytes devolvidos.
+ * @param alocados Bytes alocados; se positivo, conta uma alocação.
+ */
+void contabilizar_memoria(ContabilidadeMemoria *contabilidade, size_t liberados, size_t alocados)
+{
+    if (contabilidade != NULL)
+    {
+        contabilidade->bytes_em_uso = contabilidade->bytes_em_uso - liberados + alocados;
+        if (contabilidade->bytes_em_uso > contabilidade->pico_bytes)
+        {
+            contabilidade->pico_bytes = contabilidade->bytes_em_uso;
+        }
+        if (alocados > 0)
+        {
+            contabilidade->n_alocacoes++;
+        }
+    }
+}
+
+/**
+ * @brief Reserva o bloco de memória de uma arena.
+ *
+ * Só os blocos entregues por `arena_alocar` são contabilizados: a
+ * reserva em si é dimensionada para o pior caso da configuração.
+ *
+ * @param arena Arena a ser criada.
+ * @param capacidade Quantidade de bytes disponível para alocações.
+ * @param contabilidade Contabilidade que registra os blocos entregues, ou NULL.
+ * @return 1 se o bloco foi reservado, ou 0 em caso de falha de alocação.
+ */
+int arena_criar(Arena *arena, size_t capacidade, ContabilidadeMemoria *contabilidade)
+{
+    capacidade = ALINHAR_ARENA(capacidade > 0 ? capacidade : 1);
+    arena->base = (unsigned char *)aligned_alloc(ALINHAMENTO_ARENA, capacidade);
+    arena->capacidade = arena->base != NULL ? capacidade : 0;
+    arena->usado = 0;
+    arena->contabilidade = contabilidade;
+    return arena->base != NULL;
+}
+
+/**
+ * @brief Aloca um bloco da arena, alinhado a `ALINHAMENTO_ARENA` bytes.
+ *
+ * A memória não é inicializada. Não há liberação individual: os
+ * blocos são devolvidos em conjunto por `arena_restaurar` ou
+ * `arena_liberar`.
+ *
+ * @param arena Arena de onde o bloco é alocado.
+ * @param tamanho Quantidade de bytes do bloco.
+ * @return Ponteiro para o bloco, ou NULL se a arena não tiver espaço.
+ */
+void *arena_alocar(Arena *arena, size_t tamanho)
+{
+    void *bloco = NULL;
+    size_t alinhado = ALINHAR_ARENA(tamanho);
+
+    if (arena->base != NULL && alinhado <= arena->capacidade - arena->usado)
+    {
+        bloco = arena->base + arena->usado;
+        arena->usado += alinhado;
+        contabilizar_memoria(arena->contabilidade, 0, alinhado);
+    }
+
+    return bloco;
+}
+
+/**
+ * @brief Retorna a posição atual da arena, para uso com `arena_restaurar`.
+ *
+ * @param arena Arena consultada.
+ * @return Quantidade de bytes já alocados.
+ */
+size_t arena_marcador(const Arena *arena)
+{
+    return arena->usado;
+}
+
+/**
+ * @brief Devolve à arena todos os blocos alocados depois de um marcador.
+ *
+ * @param arena Arena a ser restaurada.
+ * @param marcador Posição obtida anteriormente com `arena_marcador`.
+ */
+void arena_restaurar(Arena *arena, size_t marcador)
+{
+    if (marcador <= arena->usado)
+    {
+        contabilizar_memoria(arena->contabilidade, arena->usado - marcador, 0);
+        arena->usado = marcador;
+    }
+}
+
+/**
+ * @brief Libera o bloco de memória da arena, em uma única chamada.
+ *
+ * @param arena Arena a ser liberada.
+ */
+void arena_liberar(Arena *arena)
+{
+    contabilizar_memoria(arena->contabilidade, arena->usado, 0);
+    free(arena->base);
+    arena->base = NULL;
+    arena->capacidade = 0;
+    arena->usado = 0;
+}
+
+/**
+ * @brief Abre um contador de hardware do processo atual, desativado.
+ *
+ * @param contador Contador a abrir (CONTADOR_*).
+ * @return Descritor do contador, ou -1 se ele não estiver disponível.
+ */
+int abrir_contador_hardware(int contador)
+{
+#ifdef __linux__
+    static const uint64_t eventos[N_CONTADORES_HARDWARE] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES,
+    };
+    struct perf_event_attr atributos;
+
+    memset(&atributos, 0, sizeof(atributos));
+    atributos.type = PERF_TYPE_HARDWARE;
+    atributos.size = sizeof(atributos);
+    atributos.config = eventos[contador];
+    atributos.disabled = 1;
+    atributos.inherit = 1;
+    atributos.exclude_kernel = 1;
+    atributos.exclude_hv = 1;
+    atributos.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int)syscall(SYS_perf_event_open, &atributos, 0, -1, -1, 0);
+#else
+    (void)contador;
+    return -1;
+#endif
+}
+
+/**
+ * @brief Abre os contadores de hardware, todos desativados.
+ *
+ * @param contadores Contadores a abrir.
+ * @return Quantidade de contadores disponíveis.
+ */
+int contadores_abrir(ContadoresHardware *contadores)
+{
+    int abertos = 0;
+
+    for (int k = 0; k < N_CONTADORES_HARDWARE; k++)
+    {
+        contadores->descritores[k] = abrir_contador_hardware(k);
+        contadores->valores[k] = -1;
+        abertos += contadores->descritores[k] >= 0;
+    }
+
+    return abertos;
+}
+
+/**
+ * @brief Zera e ativa os contadores abertos.
+ *
+ * @param contadores Contadores abertos por `contadores_abrir`.
+ */
+void contadores_iniciar(ContadoresHardware *contadores)
+{
+#ifdef __linux__
+    for (int k = 0; k < N_CONTADORES_HARDWARE; k++)
+    {
+        if (contadores->descritores[k] >= 0)
+        {
+            ioctl(contadores->descritores[k], PERF_EVENT_IOC_RESET, 0);
+            ioctl(contadores->descritores[k], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#else
+    (void)contadores;
+#endif
+}
+
+/**
+ * @brief Desativa os contadores abertos e lê suas contagens.
+ *
+ * Quando o kernel reveza mais contadores do que o processador comporta,
+ * a contagem é estimada proporcionalmente ao tempo em que o contador
+ * esteve de fato ativo.
+ *
+ * @param contadores Contadores ativados por `contadores_iniciar`.
+ */
+void contadores_parar(ContadoresHardware *contadores)
+{
+    for (int k = 0; k < N_CONTADORES_HARDWARE; k++)
+    {
+        contadores->valores[k] = -1;
+#ifdef __linux__
+        if (contadores->descritores[k] >= 0)
+        {
+            uint64_t leitura[3]; /* valor, tempo habilitado, tempo em execução */
+
+            ioctl(contadores->descritores[k], PERF_EVENT_IOC_DISABLE, 0);
+            if (read(contadores->descritores[k], leitura, sizeof(leitura)) == (ssize_t)sizeof(leitura) && leitura[2] > 0)
+            {
+                contadores->valores[k] = leitura[2] < leitura[1] ? (long long)((double)leitura[0] * leitura[1] / leitura[2]) : (long long)leitura[0];
+            }
+        }
+#endif
+    }
+}
+
+/**
+ * @brief Fecha os contadores abertos por `contadores_abrir`.
+ *
+ * @param contadores Contadores a fechar.
+ */
+void contadores_fechar(ContadoresHardware *contadores)
+{
+    for (int k = 0; k < N_CONTADORES_HARDWARE; k++)
+    {
+        if (contadores->descritores[k] >= 0)
+        {
+            close(contadores->descritores[k]);
+            contadores->descritores[k] = -1;
+        }
+    }
+}
+
+/**
+ * @brief Escreve as colunas de contadores de uma linha de resultado.
+ *
+ * As colunas seguem a ordem `ciclos,instrucoes,ipc,falhas_cache,falhas_desvio`,
+ * cada uma precedida de vírgula; contagens indisponíveis ficam em branco.
+ *
+ * @param saida Fluxo que recebe as colunas.
+ * @param contadores Contagens indexadas por CONTADOR_*, ou -1.
+ */
+void escrever_contadores(FILE *saida, const long long *contadores)
+{
+    for (int k = 0; k < N_CONTADORES_HARDWARE; k++)
+    {
+        if (contadores[k] >= 0)
+        {
+            fprintf(saida, ",%lld", contadores[k]);
+        }
+        else
+        {
+            fprintf(saida, ",");
+        }
+        if (k == CONTADOR_INSTRUCOES)
+        {
+            if (contadores[CONTADOR_CICLOS] > 0 && contadores[CONTADOR_INSTRUCOES] >= 0)
+            {
+                fprintf(saida, ",%.4f", (double)contadores[CONTADOR_INSTRUCOES] / contadores[CONTADOR_CICLOS]);
+            }
+            else
+            {
+                fprintf(saida, ",");
+            }
+        }
+    }
+}
+
+/**
+ * @brief Compara dois pontos com base na posição no eixo.
+ *
+ * Ordena os pontos em ordem crescente de posição. Essa ordenação
+ * facilita a identificação do próximo ponto ainda não coberto
+ * e torna contígua a faixa de pontos coberta por cada intervalo.
+ *
+ * Função compatível com `qsort`.
+ *
+ * @param a Ponteiro para o primeiro ponto.
+ * @param b Ponteiro para o segundo ponto.
+ * @return Valor negativo, positivo ou zero conforme a ordem relativa.
+ */
+int comparar_pontos(const void *a, const void *b)
+{
+    int resultado = 0;
+    Ponto *ponto_a = (Ponto *)a;
+    Ponto *ponto_b = (Ponto *)b;
+
+    if (ponto_a->posicao < ponto_b->posicao)
+    {
+        resultado = -1;
+    }
+    else if (ponto_a->posicao > ponto_b->posicao)
+    {
+        resultado = 1;
+    }
+    else
+    {
+        resultado = 0;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Compara dois intervalos pelo início, para a varredura da reta.
+ *
+ * Ordena os intervalos em ordem crescente de início e, em caso de
+ * empate, em ordem decrescente de fim. Assim, a varredura encontra
+ * primeiro, entre intervalos de mesmo início, o que alcança mais longe.
+ *
+ * Função compatível com `qsort`.
+ *
+ * @param a Ponteiro para o primeiro intervalo.
+ * @param b Ponteiro para o segundo intervalo.
+ * @return Valor negativo, positivo ou zero conforme a ordem relativa.
+ */
+int comparar_intervalos_por_inicio(const void *a, const void *b)
+{
+    int resultado = 0;
+    Intervalo *intervalo_a = (Intervalo *)a;
+    Intervalo *intervalo_b = (Intervalo *)b;
+
+    if (intervalo_a->inicio < intervalo_b->inicio)
+    {
+        resultado = -1;
+    }
+    else if (intervalo_a->inicio > intervalo_b->inicio)
+    {
+        resultado = 1;
+    }
+    else if (intervalo_a->fim > intervalo_b->fim)
+    {
+        resultado = -1;
+    }
+    else if (intervalo_a->fim < intervalo_b->fim)
+    {
+        resultado = 1;
+    }
+    else
+    {
+        resultado = 0;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Ordena faixas por primeiro ponto crescente e último ponto decrescente.
+ *
+ * Nessa ordem, uma faixa está contida em alguma anterior exatamente
+ * quando seu último ponto não ultrapassa o maior último ponto já visto.
+ *
+ * @param a Ponteiro para a primeira faixa.
+ * @param b Ponteiro para a segunda faixa.
+ * @return Valor negativo, positivo ou zero conforme a ordem relativa.
+ */
+int comparar_faixas_reducao(const void *a, const void *b)
+{
+    int resultado = 0;
+    FaixaReducao *faixa_a = (FaixaReducao *)a;
+    FaixaReducao *faixa_b = (FaixaReducao *)b;
+
+    if (faixa_a->primeiro != faixa_b->primeiro)
+    {
+        resultado = faixa_a->primeiro < faixa_b->primeiro ? -1 : 1;
+    }
+    else if (faixa_a->ultimo != faixa_b->ultimo)
+    {
+        resultado = faixa_a->ultimo > faixa_b->ultimo ? -1 : 1;
+    }
+    else
+    {
+        resultado = faixa_a->indice < faixa_b->indice ? -1 : (faixa_a->indice > faixa_b->indice ? 1 : 0);
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Retorna o índice do primeiro ponto com posição maior ou igual a `valor`.
+ *
+ * Busca binária sobre pontos ordenados por posição.
+ *
+ * @param pontos Vetor de pontos ordenado por posição.
+ * @param n_pontos Quantidade de pontos.
+ * @param valor Posição procurada.
+ * @return Índice do primeiro ponto com posição >= `valor`, ou `n_pontos`.
+ */
+int primeiro_ponto_a_partir(const Ponto *pontos, int n_pontos, int valor)
+{
+    int esquerda = 0;
+    int direita = n_pontos;
+    while (esquerda < direita)
+    {
+        int meio = esquerda + (direita - esquerda) / 2;
+        if (pontos[meio].posicao < valor)
+        {
+            esquerda = meio + 1;
+        }
+        else
+        {
+            direita = meio;
+        }
+    }
+    return esquerda;
+}
+
+/**
+ * @brief Retorna o índice da primeira posição maior ou igual a `valor`.
+ *
+ * Busca binária sobre um vetor contíguo de posições ordenadas, como o
+ * `posicoes` dos solucionadores: cada passo lê um `int`, e não um
+ * `Ponto` inteiro.
+ *
+ * @param posicoes Vetor de posições em ordem crescente.
+ * @param n_posicoes Quantidade de posições.
+ * @param valor Posição procurada.
+ * @return Índice da primeira posição >= `valor`, ou `n_posicoes`.
+ */
+int primeira_posicao_a_partir(const int *posicoes, int n_posicoes, int valor)
+{
+    int esquerda = 0;
+    int direita = n_posicoes;
+    while (esquerda < direita)
+    {
+        int meio = esquerda + (direita - esquerda) / 2;
+        if (posicoes[meio] < valor)
+        {
+            esquerda = meio + 1;
+        }
+        else
+        {
+            direita = meio;
+        }
+    }
+    return esquerda;
+}
+
+/**
+ * @brief Remove pontos e intervalos redundantes de uma instância.
+ *
+ * A redução é feita sobre os vetores da instância, que são compactados
+ * no lugar, e repetida até não haver mais nada a remover:
+ * - os pontos são ordenados e posições duplicadas são descartadas;
+ * - cada intervalo é recortado para a faixa de pontos que ele realmente
+ *   cobre; intervalos sem pontos e intervalos cuja faixa está contida
+ *   na de outro são dominados e removidos (dos idênticos, fica o primeiro);
+ * - se todos os pontos podem ser cobertos, remove-se cada ponto cujo
+ *   conjunto de intervalos que o cobrem contém o de outro ponto: cobrir
+ *   o outro já garante a sua cobertura.
+ *
+ * Depois da remoção dos intervalos dominados, as faixas restantes têm
+ * início e fim estritamente crescentes, então os intervalos que cobrem
+ * o ponto `j` formam uma faixa contígua `[a_j, b_j]` desses intervalos,
+ * com `a_j` e `b_j` não decrescentes. A inclusão entre conjuntos de
+ * pontos vizinhos se reduz a comparar esses extremos.
+ *
+ * Os intervalos mantidos preservam suas coordenadas originais e a ordem
+ * relativa em que estavam no vetor.
+ *
+ * A memória temporária vem de `arena` e é devolvida a ela ao final.
+ *
+ * @param arena Arena de onde sai a memória temporária da redução.
+ * @param pontos Vetor de pontos da instância.
+ * @param n_pontos Quantidade de pontos, atualizada após a redução.
+ * @param intervalos Vetor de intervalos da instância.
+ * @param n_intervalos Quantidade de intervalos, atualizada após a redução.
+ * @return Resumo da redução aplicada.
+ */
+Reducao reduzir_instancia(Arena *arena, Ponto *pontos, int *n_pontos, Intervalo *intervalos, int *n_intervalos)
+{
+    size_t marcador = arena_marcador(arena);
+    Reducao reducao;
+    int alterou = 1;
+
+    reducao.aplicada = 0;
+    reducao.pontos_duplicados = 0;
+    reducao.pontos_dominados = 0;
+    reducao.intervalos_dominados = 0;
+
+    FaixaReducao *faixas = (FaixaReducao *)arena_alocar(arena, (*n_intervalos + 1) * sizeof(FaixaReducao));
+    int *manter = (int *)arena_alocar(arena, (*n_intervalos + *n_pontos + 1) * sizeof(int));
+    int *primeiro_cobrindo = (int *)arena_alocar(arena, (*n_pontos + 1) * sizeof(int));
+    int *ultimo_cobrindo = (int *)arena_alocar(arena, (*n_pontos + 1) * sizeof(int));
+
+    if (faixas != NULL && manter != NULL && primeiro_cobrindo != NULL && ultimo_cobrindo != NULL)
+    {
+        reducao.aplicada = 1;
+
+        qsort(pontos, *n_pontos, sizeof(Ponto), comparar_pontos);
+        int n_unicos = 0;
+        for (int j = 0; j < *n_pontos; j++)
+        {
+            if (n_unicos == 0 || pontos[j].posicao != pontos[n_unicos - 1].posicao)
+            {
+                pontos[n_unicos] = pontos[j];
+                n_unicos++;
+            }
+        }
+        reducao.pontos_duplicados = *n_pontos - n_unicos;
+        *n_pontos = n_unicos;
+
+        while (alterou)
+        {
+            alterou = 0;
+
+            int n_faixas = 0;
+            for (int i = 0; i < *n_intervalos; i++)
+            {
+                manter[i] = 0;
+                int primeiro = primeiro_ponto_a_partir(pontos, *n_pontos, intervalos[i].inicio);
+                int ultimo = intervalos[i].fim == INT_MAX ? *n_pontos - 1
+                                                          : primeiro_ponto_a_partir(pontos, *n_pontos, intervalos[i].fim + 1) - 1;
+                if (primeiro <= ultimo)
+                {
+                    faixas[n_faixas].primeiro = primeiro;
+                    faixas[n_faixas].ultimo = ultimo;
+                    faixas[n_faixas].indice = i;
+                    n_faixas++;
+                }
+            }
+            qsort(faixas, n_faixas, sizeof(FaixaReducao), comparar_faixas_reducao);
+
+            int n_mantidas = 0;
+            int maior_ultimo = -1;
+            for (int k = 0; k < n_faixas; k++)
+            {
+                if (faixas[k].ultimo > maior_ultimo)
+                {
+                    maior_ultimo = faixas[k].ultimo;
+                    manter[faixas[k].indice] = 1;
+                    faixas[n_mantidas] = faixas[k];
+                    n_mantidas++;
+                }
+            }
+
+            int n_intervalos_mantidos = 0;
+            for (int i = 0; i < *n_intervalos; i++)
+            {
+                if (manter[i])
+                {
+                    intervalos[n_intervalos_mantidos] = intervalos[i];
+                    n_intervalos_mantidos++;
+                }
+            }
+            if (n_intervalos_mantidos != *n_intervalos)
+            {
+                reducao.intervalos_dominados += *n_intervalos - n_intervalos_mantidos;
+                *n_intervalos = n_intervalos_mantidos;
+                alterou = 1;
+            }
+
+            /**
+             * Faixas mantidas, já em ordem de primeiro ponto: para cada ponto,
+             * `primeiro_cobrindo` e `ultimo_cobrindo` delimitam os intervalos
+             * (nessa ordem) que o cobrem.
+             */
+            int todos_cobertos = 1;
+            int a = 0;
+            int b = -1;
+            for (int j = 0; j < *n_pontos; j++)
+            {
+                while (a < n_mantidas && faixas[a].ultimo < j)
+                {
+                    a++;
+                }
+                while (b + 1 < n_mantidas && faixas[b + 1].primeiro <= j)
+                {
+                    b++;
+                }
+                primeiro_cobrindo[j] = a;
+                ultimo_cobrindo[j] = b;
+                if (a > b)
+                {
+                    todos_cobertos = 0;
+                }
+            }
+
+            if (todos_cobertos && *n_pontos > 1)
+            {
+                int *pilha = manter + *n_intervalos;
+                int topo = 0;
+                for (int j = 0; j < *n_pontos; j++)
+                {
+                    while (topo > 0 && ultimo_cobrindo[pilha[topo - 1]] == ultimo_cobrindo[j])
+                    {
+                        topo--;
+                    }
+                    if (topo == 0 || primeiro_cobrindo[pilha[topo - 1]] != primeiro_cobrindo[j])
+                    {
+                        pilha[topo] = j;
+                        topo++;
+                    }
+                }
+
+                if (topo != *n_pontos)
+                {
+                    for (int k = 0; k < topo; k++)
+                    {
+                        pontos[k] = pontos[pilha[k]];
+                    }
+                    reducao.pontos_dominados += *n_pontos - topo;
+                    *n_pontos = topo;
+                    alterou = 1;
+                }
+            }
+        }
+    }
+
+    arena_restaurar(arena, marcador);
+
+    return reducao;
+}
+
+/**
+ * @brief Retorna o nome de uma distribuição de instâncias sintéticas.
+ *
+ * @param distribuicao Constante DISTRIBUICAO_*.
+ * @return Nome legível da distribuição.
+ */
+const char *nome_distribuicao(int distribuicao)
+{
+    const char *nome = "desconhecida";
+    if (distribuicao == DISTRIBUICAO_UNIFORME)
+    {
+        nome = "uniforme";
+    }
+    else if (distribuicao == DISTRIBUICAO_AGRUPADA)
+    {
+        nome = "agrupada";
+    }
+    else if (distribuicao == DISTRIBUICAO_SOBREPOSTA)
+    {
+        nome = "sobreposta";
+    }
+    else if (distribuicao == DISTRIBUICAO_ANINHADA)
+    {
+        nome = "aninhada";
+    }
+    else if (distribuicao == DISTRIBUICAO_ADVERSARIA)
+    {
+        nome = "adversaria";
+    }
+    return nome;
+}
+
+/**
+ * @brief Converte o nome de uma distribuição em sua constante.
+ *
+ * @param nome Nome da distribuição, como exibido por `nome_distribuicao`.
+ * @return Constante DISTRIBUICAO_* correspondente, ou -1 se o nome for desconhecido.
+ */
+int distribuicao_por_nome(const char *nome)
+{
+    int distribuicao;
+
+    for (distribuicao = 0; distribuicao < N_DISTRIBUICOES; distribuicao++)
+    {
+        if (strcmp(nome, nome_distribuicao(distribuicao)) == 0)
+        {
+            return distribuicao;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Gera a família adversária para o guloso clássico.
+ *
+ * Cada bloco tem os pontos x1 < x2 < x3 < x4 e os intervalos [x1, x2],
+ * [x2, x3] e [x3, x4], com o do meio mais curto. Os pontos x2 vêm
+ * primeiro no vetor: o guloso clássico parte de x2, empata em dois
+ * pontos cobertos e escolhe o intervalo mais curto, [x2, x3], usando
+ * três intervalos por bloco onde dois bastam. Pontos e intervalos
+ * excedentes repetem posições dos blocos e são intervalos unitários,
+ * que não alteram nenhuma das duas escolhas.
+ *
+ * @param gerador Gerador pseudoaleatório.
+ * @param pontos Vetor de pontos a preencher.
+ * @param n_pontos Quantidade de pontos (ao menos 4).
+ * @param intervalos Vetor de intervalos a preencher.
+ * @param n_intervalos Quantidade de intervalos (ao menos 3).
+ */
+void gerar_blocos_adversarios(GeradorAleatorio *gerador, Ponto *pontos, int n_pontos, Intervalo *intervalos, int n_intervalos)
+{
+    int n_blocos = n_pontos / 4 < n_intervalos / 3 ? n_pontos / 4 : n_intervalos / 3;
+    int base = 0;
+
+    for (int b = 0; b < n_blocos; b++)
+    {
+        int escala = 1 + gerador_uniforme(gerador, 4);
+        int x1 = base;
+        int x2 = base + 4 * escala;
+        int x3 = base + 6 * escala;
+        int x4 = base + 10 * escala;
+
+        pontos[b].posicao = x2;
+        pontos[n_blocos + 3 * b].posicao = x1;
+        pontos[n_blocos + 3 * b + 1].posicao = x3;
+        pontos[n_blocos + 3 * b + 2].posicao = x4;
+
+        intervalos[3 * b] = (Intervalo){x1, x2};
+        intervalos[3 * b + 1] = (Intervalo){x2, x3};
+        intervalos[3 * b + 2] = (Intervalo){x3, x4};
+
+        base = x4 + 1 + gerador_uniforme(gerador, 10);
+    }
+
+    for (int j = 4 * n_blocos; j < n_pontos; j++)
+    {
+        pontos[j].posicao = pontos[n_blocos + 3 * gerador_uniforme(gerador, n_blocos)].posicao;
+    }
+
+    for (int i = 3 * n_blocos; i < n_intervalos; i++)
+    {
+        int posicao = pontos[gerador_uniforme(gerador, 4 * n_blocos)].posicao;
+        intervalos[i] = (Intervalo){posicao, posicao};
+    }
+}
+
+/**
+ * O formato binário copia os pares de intervalos diretamente para o vetor
+ * de `Intervalo`, que precisa ter exatamente o layout de dois int32.
+ */
+_Static_assert(sizeof(Intervalo) == 2 * sizeof(int32_t), "Intervalo deve ocupar dois inteiros de 32 bits");
+
+/**
+ * @brief Fecha uma origem de instâncias e libera seus recursos.
+ *
+ * @param leitor Leitor aberto por `leitor_abrir`.
+ */
+void leitor_fechar(LeitorInstancia *leitor)
+{
+    if (leitor->tamanho_mapa > 0)
+    {
+        munmap((void *)leitor->dados, leitor->tamanho_mapa);
+    }
+    free(leitor->buffer);
+    if (leitor->descritor >= 0 && leitor->descritor != STDIN_FILENO)
+    {
+        close(leitor->descritor);
+    }
+    leitor->descritor = -1;
+    leitor->dados = NULL;
+    leitor->buffer = NULL;
+    leitor->tamanho_mapa = 0;
+    leitor->inicio = 0;
+    leitor->fim = 0;
+    leitor->esgotado = 1;
+}
+
+/**
+ * @brief Abre uma origem de instâncias para leitura.
+ *
+ * Arquivos regulares são mapeados em memória com `mmap` e lidos
+ * diretamente do mapeamento. A entrada padrão (caminho "-") e arquivos
+ * que não podem ser mapeados, como pipes, são lidos em blocos de
+ * `TAMANHO_BUFFER_LEITOR` bytes.
+ *
+ * @param leitor Leitor a ser preparado.
+ * @param caminho Caminho do arquivo, ou "-" para a entrada padrão.
+ * @return 1 se a origem foi aberta, ou 0 em caso de falha.
+ */
+int leitor_abrir(LeitorInstancia *leitor, const char *caminho)
+{
+    struct stat informacoes;
+    int resultado = 0;
+
+    leitor->descritor = -1;
+    leitor->dados = NULL;
+    leitor->inicio = 0;
+    leitor->fim = 0;
+    leitor->buffer = NULL;
+    leitor->tamanho_mapa = 0;
+    leitor->esgotado = 0;
+
+    if (strcmp(caminho, "-") == 0)
+    {
+        leitor->descritor = STDIN_FILENO;
+    }
+    else
+    {
+        leitor->descritor = open(caminho, O_RDONLY);
+    }
+
+    if (leitor->descritor >= 0)
+    {
+        if (leitor->descritor != STDIN_FILENO && fstat(leitor->descritor, &informacoes) == 0 &&
+            S_ISREG(informacoes.st_mode) && informacoes.st_size > 0)
+        {
+            void *mapa = mmap(NULL, (size_t)informacoes.st_size, PROT_READ, MAP_PRIVATE, leitor->descritor, 0);
+            if (mapa != MAP_FAILED)
+            {
+                madvise(mapa, (size_t)informacoes.st_size, MADV_SEQUENTIAL);
+                leitor->dados = (const unsigned char *)mapa;
+                leitor->tamanho_mapa = (size_t)informacoes.st_size;
+                leitor->fim = leitor->tamanho_mapa;
+                leitor->esgotado = 1;
+                resultado = 1;
+            }
+        }
+
+        if (resultado == 0)
+        {
+            leitor->buffer = (unsigned char *)malloc(TAMANHO_BUFFER_LEITOR);
+            if (leitor->buffer != NULL)
+            {
+                leitor->dados = leitor->buffer;
+                resultado = 1;
+            }
+        }
+    }
+
+    if (resultado == 0)
+    {
+        leitor_fechar(leitor);
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Prepara a leitura de instâncias de um descritor já aberto.
+ *
+ * Usado com origens que não têm caminho, como as conexões aceitas por
+ * um socket: o descritor é lido em blocos de `TAMANHO_BUFFER_LEITOR`
+ * bytes e passa a pertencer ao leitor, que o fecha em `leitor_fechar`.
+ *
+ * @param leitor Leitor a ser preparado.
+ * @param descritor Descritor aberto para leitura.
+ * @return 1 se o leitor foi preparado, ou 0 se faltar memória (o
+ *         descritor é fechado).
+ */
+int leitor_abrir_descritor(LeitorInstancia *leitor, int descritor)
+{
+    leitor->descritor = descritor;
+    leitor->inicio = 0;
+    leitor->fim = 0;
+    leitor->tamanho_mapa = 0;
+    leitor->esgotado = 0;
+    leitor->buffer = (unsigned char *)malloc(TAMANHO_BUFFER_LEITOR);
+    leitor->dados = leitor->buffer;
+
+    if (leitor->buffer == NULL)
+    {
+        leitor_fechar(leitor);
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Lê mais um bloco da origem para o buffer do leitor.
+ *
+ * Os bytes ainda não consumidos são movidos para o início do buffer e
+ * o restante é preenchido com uma chamada a `read`, ou a `fread` quando
+ * a origem é a entrada padrão.
+ *
+ * @param leitor Leitor em modo de buffer.
+ * @return 1 se novos bytes foram lidos, ou 0 no fim da origem.
+ */
+int leitor_recarregar(LeitorInstancia *leitor)
+{
+    ssize_t lidos = 0;
+
+    if (leitor->esgotado)
+    {
+        return 0;
+    }
+
+    if (leitor->inicio > 0)
+    {
+        memmove(leitor->buffer, leitor->buffer + leitor->inicio, leitor->fim - leitor->inicio);
+        leitor->fim -= leitor->inicio;
+        leitor->inicio = 0;
+    }
+
+    do
+    {
+        if (leitor->descritor == STDIN_FILENO)
+        {
+            /* A entrada padrão passa pelo `FILE` para aproveitar o que o menu já bufferizou. */
+            lidos = (ssize_t)fread(leitor->buffer + leitor->fim, 1, TAMANHO_BUFFER_LEITOR - leitor->fim, stdin);
+        }
+        else
+        {
+            lidos = read(leitor->descritor, leitor->buffer + leitor->fim, TAMANHO_BUFFER_LEITOR - leitor->fim);
+        }
+    } while (lidos < 0 && errno == EINTR);
+
+    if (lidos <= 0)
+    {
+        leitor->esgotado = 1;
+        return 0;
+    }
+
+    leitor->fim += (size_t)lidos;
+    return 1;
+}
+
+/**
+ * @brief Garante que ao menos `quantidade` bytes estejam disponíveis no leitor.
+ *
+ * @param leitor Leitor da origem.
+ * @param quantidade Quantidade de bytes desejada (no máximo `TAMANHO_BUFFER_LEITOR`).
+ * @return 1 se os bytes estão disponíveis, ou 0 se a origem terminou antes.
+ */
+int leitor_garantir(LeitorInstancia *leitor, size_t quantidade)
+{
+    while (leitor->fim - leitor->inicio < quantidade)
+    {
+        if (leitor_recarregar(leitor) == 0)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Avança sobre espaços em branco e comentários iniciados por '#'.
+ *
+ * @param leitor Leitor da origem.
+ * @return O próximo byte significativo (sem consumi-lo), ou -1 no fim da origem.
+ */
+int leitor_pular_espacos(LeitorInstancia *leitor)
+{
+    int em_comentario = 0;
+
+    while (leitor->inicio < leitor->fim || leitor_recarregar(leitor))
+    {
+        int c = leitor->dados[leitor->inicio];
+        if (em_comentario)
+        {
+            em_comentario = c != '\n';
+        }
+        else if (c == '#')
+        {
+            em_comentario = 1;
+        }
+        else if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+        {
+            return c;
+        }
+        leitor->inicio++;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Lê um inteiro de 64 bits em texto decimal, com sinal opcional.
+ *
+ * Substitui o `scanf` por uma conversão direta dos dígitos, que é o
+ * gargalo ao carregar instâncias com milhões de valores.
+ *
+ * @param leitor Leitor da origem.
+ * @param valor Destino do inteiro lido.
+ * @return 1 se um inteiro foi lido, ou 0 se a entrada terminou ou não
+ *         contém um inteiro válido de 64 bits nessa posição.
+ */
+int leitor_ler_inteiro64(LeitorInstancia *leitor, int64_t *valor)
+{
+    uint64_t acumulado = 0;
+    uint64_t limite = (uint64_t)INT64_MAX;
+    int negativo = 0;
+    int digitos = 0;
+    int c = leitor_pular_espacos(leitor);
+
+    if (c == '-' || c == '+')
+    {
+        negativo = c == '-';
+        leitor->inicio++;
+    }
+    if (negativo)
+    {
+        limite++;
+    }
+
+    while (leitor->inicio < leitor->fim || leitor_recarregar(leitor))
+    {
+        c = leitor->dados[leitor->inicio];
+        if (c < '0' || c > '9')
+        {
+            break;
+        }
+        if (acumulado > (limite - (uint64_t)(c - '0')) / 10)
+        {
+            return 0;
+        }
+        acumulado = acumulado * 10 + (uint64_t)(c - '0');
+        digitos++;
+        leitor->inicio++;
+    }
+
+    if (digitos == 0)
+    {
+        return 0;
+    }
+
+    *valor = negativo ? (int64_t)(0 - acumulado) : (int64_t)acumulado;
+    return 1;
+}
+
+/**
+ * @brief Lê um inteiro de 32 bits em texto decimal, com sinal opcional.
+ *
+ * @param leitor Leitor da origem.
+ * @param valor Destino do inteiro lido.
+ * @return 1 se um inteiro foi lido, ou 0 se a entrada terminou ou não
+ *         contém um inteiro válido de 32 bits nessa posição.
+ */
+int leitor_ler_inteiro(LeitorInstancia *leitor, int *valor)
+{
+    int64_t lido;
+
+    if (leitor_ler_inteiro64(leitor, &lido) == 0 || lido < INT_MIN || lido > INT_MAX)
+    {
+        return 0;
+    }
+
+    *valor = (int)lido;
+    return 1;
+}
+
+/**
+ * @brief Lê um inteiro de 32 bits do formato binário, na ordem de bytes da máquina.
+ *
+ * @param leitor Leitor da origem.
+ * @param valor Destino do inteiro lido.
+ * @return 1 se o inteiro foi lido, ou 0 se a origem terminou antes.
+ */
+int leitor_ler_int32(LeitorInstancia *leitor, int *valor)
+{
+    int32_t lido;
+
+    if (leitor_garantir(leitor, sizeof(int32_t)) == 0)
+    {
+        return 0;
+    }
+    memcpy(&lido, leitor->dados + leitor->inicio, sizeof(int32_t));
+    leitor->inicio += sizeof(int32_t);
+    *valor = (int)lido;
+    return 1;
+}
+
+/**
+ * @brief Lê um inteiro de 64 bits do formato binário, na ordem de bytes da máquina.
+ *
+ * @param leitor Leitor da origem.
+ * @param valor Destino do inteiro lido.
+ * @return 1 se o inteiro foi lido, ou 0 se a origem terminou antes.
+ */
+int leitor_ler_int64(LeitorInstancia *leitor, int64_t *valor)
+{
+    if (leitor_garantir(leitor, sizeof(int64_t)) == 0)
+    {
+        return 0;
+    }
+    memcpy(valor, leitor->dados + leitor->inicio, sizeof(int64_t));
+    leitor->inicio += sizeof(int64_t);
+    return 1;
+}
+
+/**
+ * @brief Copia um bloco de bytes da origem para a memória.
+ *
+ * @param leitor Leitor da origem.
+ * @param destino Destino dos bytes.
+ * @param quantidade Quantidade de bytes a copiar.
+ * @return 1 se todos os bytes foram copiados, ou 0 se a origem terminou antes.
+ */
+int leitor_ler_bytes(LeitorInstancia *leitor, void *destino, size_t quantidade)
+{
+    unsigned char *saida = (unsigned char *)destino;
+
+    while (quantidade > 0)
+    {
+        if (leitor->inicio == leitor->fim && leitor_recarregar(leitor) == 0)
+        {
+            return 0;
+        }
+        size_t bloco = leitor->fim - leitor->inicio;
+        if (bloco > quantidade)
+        {
+            bloco = quantidade;
+        }
+        memcpy(saida, leitor->dados + leitor->inicio, bloco);
+        leitor->inicio += bloco;
+        saida += bloco;
+        quantidade -= bloco;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Calcula o menor tamanho, em bytes, dos valores de uma instância.
+ *
+ * No texto, cada valor ocupa ao menos um dígito precedido de um
+ * separador; nos formatos binários, o tamanho é exato.
+ *
+ * @param formato Um dos `FORMATO_INSTANCIA_*`.
+ * @param n_pontos Quantidade de pontos.
+ * @param n_intervalos Quantidade de intervalos.
+ * @return Quantidade mínima de bytes após o cabeçalho.
+ */
+size_t tamanho_minimo_instancia(int formato, int n_pontos, int n_intervalos)
+{
+    size_t n_valores = (size_t)n_pontos + 2 * (size_t)n_intervalos;
+    size_t tamanho = 2 * n_valores;
+
+    if (formato == FORMATO_INSTANCIA_BINARIO)
+    {
+        tamanho = (size_t)n_pontos * sizeof(int32_t) + (size_t)n_intervalos * sizeof(Intervalo);
+    }
+    else if (formato == FORMATO_INSTANCIA_BINARIO_64)
+    {
+        tamanho = n_valores * sizeof(int64_t);
+    }
+
+    return tamanho;
+}
+
+/**
+ * @brief Lê o cabeçalho da próxima instância de uma origem.
+ *
+ * Reconhece o formato pelo início da instância:
+ *
+ * - texto: `n_pontos n_intervalos`, seguidos das `n_pontos` posições
+ *   dos pontos e dos `n_intervalos` pares `inicio fim`, separados por
+ *   espaços ou quebras de linha, com coordenadas de até 64 bits; '#'
+ *   inicia um comentário até o fim da linha;
+ * - binário: a assinatura `ASSINATURA_INSTANCIA_BINARIA` ("CPI1"),
+ *   seguida de `n_pontos` e `n_intervalos` e de todos os valores na
+ *   mesma ordem do texto, como inteiros de 32 bits na ordem de bytes
+ *   da máquina;
+ * - binário de 64 bits: a assinatura `ASSINATURA_INSTANCIA_BINARIA_64`
+ *   ("CPI2"), com as quantidades em 32 bits e os valores como
+ *   inteiros de 64 bits na ordem de bytes da máquina.
+ *
+ * As quantidades são recusadas antes de qualquer alocação se passarem
+ * de `MAX_ELEMENTOS_INSTANCIA` ou, quando o restante da origem já é
+ * conhecido (arquivo mapeado ou lido até o fim), se os valores não
+ * couberem nos bytes que sobram (`tamanho_minimo_instancia`).
+ *
+ * @param leitor Leitor aberto por `leitor_abrir`.
+ * @param formato Destino do formato, um dos `FORMATO_INSTANCIA_*`.
+ * @param n_pontos Destino da quantidade de pontos.
+ * @param n_intervalos Destino da quantidade de intervalos.
+ * @return 1 se o cabeçalho foi lido, 0 se a origem terminou antes de
+ *         uma nova instância, ou -1 se o cabeçalho é inválido.
+ */
+int ler_cabecalho_instancia(LeitorInstancia *leitor, int *formato, int *n_pontos, int *n_intervalos)
+{
+    int c = leitor_pular_espacos(leitor);
+
+    if (c == -1)
+    {
+        return 0;
+    }
+
+    if (c == ASSINATURA_INSTANCIA_BINARIA[0])
+    {
+        if (leitor_garantir(leitor, 4) == 0)
+        {
+            return -1;
+        }
+        if (memcmp(leitor->dados + leitor->inicio, ASSINATURA_INSTANCIA_BINARIA, 4) == 0)
+        {
+            *formato = FORMATO_INSTANCIA_BINARIO;
+        }
+        else if (memcmp(leitor->dados + leitor->inicio, ASSINATURA_INSTANCIA_BINARIA_64, 4) == 0)
+        {
+            *formato = FORMATO_INSTANCIA_BINARIO_64;
+        }
+        else
+        {
+            return -1;
+        }
+        leitor->inicio += 4;
+        if (leitor_ler_int32(leitor, n_pontos) == 0 || leitor_ler_int32(leitor, n_intervalos) == 0)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        *formato = FORMATO_INSTANCIA_TEXTO;
+        if (leitor_ler_inteiro(leitor, n_pontos) == 0 || leitor_ler_inteiro(leitor, n_intervalos) == 0)
+        {
+            return -1;
+        }
+    }
+
+    if (*n_pontos < 0 || *n_intervalos < 0 || *n_pontos > MAX_ELEMENTOS_INSTANCIA || *n_intervalos > MAX_ELEMENTOS_INSTANCIA)
+    {
+        return -1;
+    }
+    if (leitor->esgotado && leitor->fim - leitor->inicio < tamanho_minimo_instancia(*formato, *n_pontos, *n_intervalos))
+    {
+        return -1;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Devolve o endereço do k-ésimo valor de uma instância, na ordem do arquivo.
+ *
+ * Os valores são as `n_pontos` posições dos pontos seguidas dos pares
+ * (início, fim) dos intervalos.
+ *
+ * @param pontos Vetor de pontos.
+ * @param n_pontos Quantidade de pontos.
+ * @param intervalos Vetor de intervalos.
+ * @param k Índice do valor.
+ * @return Ponteiro para a coordenada correspondente.
+ */
+int *valor_instancia(Ponto *pontos, int n_pontos, Intervalo *intervalos, size_t k)
+{
+    size_t j;
+
+    if (k < (size_t)n_pontos)
+    {
+        return &pontos[k].posicao;
+    }
+
+    j = k - (size_t)n_pontos;
+    return (j % 2 == 0) ? &intervalos[j / 2].inicio : &intervalos[j / 2].fim;
+}
+
+/**
+ * @brief Lê os valores de uma instância cujo cabeçalho já foi lido.
+ *
+ * Os pontos recebem identificadores de 1 a `n_pontos`, na ordem lida.
+ * Enquanto todas as coordenadas cabem em `int`, são gravadas
+ * diretamente nos vetores e `compressao` fica vazia. Na primeira que
+ * não cabe, as já lidas passam para um vetor de 64 bits, a leitura
+ * continua nele e, ao final, `comprimir_coordenadas` grava os postos
+ * densos nos vetores e preenche `compressao`.
+ *
+ * @param leitor Leitor posicionado logo após o cabeçalho.
+ * @param formato Formato devolvido por `ler_cabecalho_instancia`.
+ * @param pontos Vetor com espaço para `n_pontos` pontos.
+ * @param n_pontos Quantidade de pontos.
+ * @param intervalos Vetor com espaço para `n_intervalos` intervalos.
+ * @param n_intervalos Quantidade de intervalos.
+ * @param compressao Destino da tabela de coordenadas originais.
+ * @return 1 se a instância foi lida, ou 0 se a origem terminou antes,
+ *         um valor é inválido ou faltou memória.
+ */
+int ler_valores_instancia(LeitorInstancia *leitor, int formato, Ponto *pontos, int n_pontos, Intervalo *intervalos, int n_intervalos,
+                          CompressaoCoordenadas *compressao)
+{
+    size_t n_valores = (size_t)n_pontos + 2 * (size_t)n_intervalos;
+    int64_t *largos = NULL;
+    int64_t valor = 0;
+    int resultado = 1;
+
+    compressao->valores = NULL;
+    compressao->n_valores = 0;
+
+    for (int j = 0; j < n_pontos; j++)
+    {
+        pontos[j].id = j + 1;
+    }
+
+    if (formato == FORMATO_INSTANCIA_BINARIO)
+    {
+        for (int j = 0; j < n_pontos && resultado == 1; j++)
+        {
+            resultado = leitor_ler_int32(leitor, &pontos[j].posicao);
+        }
+
+        /**
+         * Cada `Intervalo` é formado por dois inteiros de 32 bits, na
+         * mesma ordem do arquivo: os pares são copiados em bloco.
+         */
+        if (resultado == 1)
+        {
+            resultado = leitor_ler_bytes(leitor, intervalos, (size_t)n_intervalos * sizeof(Intervalo));
+        }
+        return resultado;
+    }
+
+    for (size_t k = 0; k < n_valores && resultado == 1; k++)
+    {
+        if (formato == FORMATO_INSTANCIA_BINARIO_64)
+        {
+            resultado = leitor_ler_int64(leitor, &valor);
+        }
+        else
+        {
+            resultado = leitor_ler_inteiro64(leitor, &valor);
+        }
+
+        if (resultado == 1 && largos == NULL && (valor < INT_MIN || valor > INT_MAX))
+        {
+            largos = (int64_t *)malloc(n_valores * sizeof(int64_t));
+            if (largos == NULL)
+            {
+                resultado = 0;
+            }
+            for (size_t anterior = 0; anterior < k && largos != NULL; anterior++)
+            {
+                largos[anterior] = *valor_instancia(pontos, n_pontos, intervalos, anterior);
+            }
+        }
+
+        if (resultado == 1 && largos != NULL)
+        {
+            largos[k] = valor;
+        }
+        else if (resultado == 1)
+        {
+            *valor_instancia(pontos, n_pontos, intervalos, k) = (int)valor;
+        }
+    }
+
+    if (resultado == 1 && largos != NULL)
+    {
+        resultado = comprimir_coordenadas(largos, pontos, n_pontos, intervalos, n_intervalos, compressao);
+    }
+
+    free(largos);
+    return resultado;
+}
+
+/**
+ * @brief Ordena chaves de 64 bits sem sinal por radix sort LSD.
+ *
+ * Usa dígitos de `BITS_DIGITO_COMPRESSAO` bits e pula as passadas em
+ * que todas as chaves têm o mesmo dígito, comuns quando as
+ * coordenadas são marcas de tempo próximas entre si. O resultado pode
+ * terminar em `chaves` ou em `auxiliar`.
+ *
+ * @param chaves Chaves a ordenar.
+ * @param auxiliar Vetor de apoio com o mesmo tamanho.
+ * @param n Quantidade de chaves.
+ * @param contagem Vetor de apoio com `1 << BITS_DIGITO_COMPRESSAO` posições.
+ * @return O vetor (`chaves` ou `auxiliar`) que contém as chaves ordenadas.
+ */
+uint64_t *ordenar_chaves_radix(uint64_t *chaves, uint64_t *auxiliar, size_t n, size_t *contagem)
+{
+    size_t n_baldes = (size_t)1 << BITS_DIGITO_COMPRESSAO;
+    uint64_t mascara = (uint64_t)n_baldes - 1;
+
+    for (int deslocamento = 0; deslocamento < 64; deslocamento += BITS_DIGITO_COMPRESSAO)
+    {
+        size_t inicio = 0;
+        int trivial = 0;
+
+        memset(contagem, 0, n_baldes * sizeof(size_t));
+        for (size_t i = 0; i < n; i++)
+        {
+            contagem[(chaves[i] >> deslocamento) & mascara]++;
+        }
+
+        for (size_t b = 0; b < n_baldes; b++)
+        {
+            size_t quantidade = contagem[b];
+            trivial = trivial || quantidade == n;
+            contagem[b] = inicio;
+            inicio += quantidade;
+        }
+
+        if (trivial == 0)
+        {
+            uint64_t *troca;
+
+            for (size_t i = 0; i < n; i++)
+            {
+                auxiliar[contagem[(chaves[i] >> deslocamento) & mascara]++] = chaves[i];
+            }
+            troca = chaves;
+            chaves = auxiliar;
+            auxiliar = troca;
+        }
+    }
+
+    return chaves;
+}
+
+/**
+ * @brief Substitui as coordenadas de uma instância por postos densos.
+ *
+ * Os valores distintos são ordenados por radix sort, sobre as chaves
+ * com o bit de sinal invertido (o que preserva a ordem dos inteiros
+ * com sinal), e cada coordenada recebe, por busca binária, o índice do
+ * seu valor na tabela. Como a ordem entre todos os valores é mantida,
+ * um ponto está coberto por um intervalo na instância comprimida se e
+ * somente se estava na original.
+ *
+ * @param coordenadas Os `n_pontos + 2 * n_intervalos` valores na ordem
+ *                    de `valor_instancia`.
+ * @param pontos Vetor onde os postos das posições são gravados.
+ * @param n_pontos Quantidade de pontos.
+ * @param intervalos Vetor onde os postos dos extremos são gravados.
+ * @param n_intervalos Quantidade de intervalos.
+ * @param compressao Destino da tabela, devolvida com `liberar_compressao`.
+ * @return 1 se a instância foi comprimida, ou 0 em caso de falha de alocação.
+ */
+int comprimir_coordenadas(const int64_t *coordenadas, Ponto *pontos, int n_pontos, Intervalo *intervalos, int n_intervalos,
+                          CompressaoCoordenadas *compressao)
+{
+    size_t n_valores = (size_t)n_pontos + 2 * (size_t)n_intervalos;
+    uint64_t bit_sinal = (uint64_t)1 << 63;
+    uint64_t *chaves = (uint64_t *)malloc((n_valores + 1) * sizeof(uint64_t));
+    uint64_t *auxiliar = (uint64_t *)malloc((n_valores + 1) * sizeof(uint64_t));
+    size_t *contagem = (size_t *)malloc(((size_t)1 << BITS_DIGITO_COMPRESSAO) * sizeof(size_t));
+    int resultado = 0;
+
+    compressao->valores = NULL;
+    compressao->n_valores = 0;
+
+    if (chaves != NULL && auxiliar != NULL && contagem != NULL)
+    {
+        uint64_t *ordenadas;
+        size_t n_distintos = 0;
+
+        for (size_t k = 0; k < n_valores; k++)
+        {
+            chaves[k] = (uint64_t)coordenadas[k] ^ bit_sinal;
+        }
+        ordenadas = ordenar_chaves_radix(chaves, auxiliar, n_valores, contagem);
+
+        for (size_t k = 0; k < n_valores; k++)
+        {
+            if (n_distintos == 0 || ordenadas[k] != ordenadas[n_distintos - 1])
+            {
+                ordenadas[n_distintos++] = ordenadas[k];
+            }
+        }
+
+        compressao->valores = (int64_t *)malloc((n_distintos + 1) * sizeof(int64_t));
+        if (compressao->valores != NULL && n_distintos <= (size_t)INT_MAX)
+        {
+            for (size_t d = 0; d < n_distintos; d++)
+            {
+                compressao->valores[d] = (int64_t)(ordenadas[d] ^ bit_sinal);
+            }
+            compressao->n_valores = (int)n_distintos;
+
+            for (size_t k = 0; k < n_valores; k++)
+            {
+                size_t esquerda = 0;
+                size_t direita = n_distintos;
+
+                while (esquerda < direita)
+                {
+                    size_t meio = esquerda + (direita - esquerda) / 2;
+                    if (compressao->valores[meio] < coordenadas[k])
+                    {
+                        esquerda = meio + 1;
+                    }
+                    else
+                    {
+                        direita = meio;
+                    }
+                }
+                *valor_instancia(pontos, n_pontos, intervalos, k) = (int)esquerda;
+            }
+            resultado = 1;
+        }
+        else
+        {
+            liberar_compressao(compressao);
+        }
+    }
+
+    free(chaves);
+    free(auxiliar);
+    free(contagem);
+    return resultado;
+}
+
+/**
+ * @brief Libera a tabela de coordenadas originais.
+ *
+ * @param compressao Tabela preenchida por `comprimir_coordenadas`, ou vazia.
+ */
+void liberar_compressao(CompressaoCoordenadas *compressao)
+{
+    free(compressao->valores);
+    compressao->valores = NULL;
+    compressao->n_valores = 0;
+}
+
+/**
+ * @brief Devolve a coordenada original de um valor da instância.
+ *
+ * @param compressao Tabela da instância.
+ * @param valor Posição ou extremo, como guardado em `Ponto` ou `Intervalo`.
+ * @return A coordenada original, ou o próprio valor se a instância não foi comprimida.
+ */
+long long coordenada_original(const CompressaoCoordenadas *compressao, int valor)
+{
+    if (compressao->valores == NULL)
+    {
+        return valor;
+    }
+    return (long long)compressao->valores[valor];
+}
+
+/**
+ * @brief Compara dois tempos para ordenação crescente com `qsort`.
+ *
+ * @param a Ponteiro para o primeiro tempo.
+ * @param b Ponteiro para o segundo tempo.
+ * @return Valor negativo, zero ou positivo, conforme `a` seja menor, igual ou maior que `b`.
+ */
+int comparar_tempos(const void *a, const void *b)
+{
+    double tempo_a = *(const double *)a;
+    double tempo_b = *(const double *)b;
+    return (tempo_a > tempo_b) - (tempo_a < tempo_b);
+}
+
+/**
+ * @brief Resume uma série de tempos em mínimo, percentis, média e desvio padrão.
+ *
+ * @param amostras Tempos medidos (reordenados em ordem crescente).
+ * @param n_amostras Quantidade de tempos (ao menos 1).
+ * @param estatisticas Resumo calculado.
+ */
+void calcular_estatisticas_tempo(double *amostras, int n_amostras, EstatisticasTempo *estatisticas)
+{
+    double soma = 0.0;
+    double soma_quadrados = 0.0;
+
+    qsort(amostras, n_amostras, sizeof(double), comparar_tempos);
+
+    for (int k = 0; k < n_amostras; k++)
+    {
+        soma += amostras[k];
+    }
+    estatisticas->media = soma / n_amostras;
+    for (int k = 0; k < n_amostras; k++)
+    {
+        soma_quadrados += (amostras[k] - estatisticas->media) * (amostras[k] - estatisticas->media);
+    }
+
+    estatisticas->amostras = n_amostras;
+    estatisticas->minimo = amostras[0];
+    estatisticas->mediana = amostras[(int)ceil(0.50 * n_amostras) - 1];
+    estatisticas->p95 = amostras[(int)ceil(0.95 * n_amostras) - 1];
+    estatisticas->p99 = amostras[(int)ceil(0.99 * n_amostras) - 1];
+    estatisticas->desvio = n_amostras > 1 ? sqrt(soma_quadrados / (n_amostras - 1)) : 0.0;
+}
+
+/**
+ * @brief Fixa o processo em uma CPU, reduzindo a variação entre medições.
+ *
+ * As threads criadas depois herdam a afinidade: com o motor paralelo,
+ * todas passam a disputar a mesma CPU.
+ *
+ * @param cpu Índice da CPU.
+ * @return 1 se a afinidade foi definida, ou 0 em caso de falha.
+ */
+int fixar_cpu(int cpu)
+{
+    cpu_set_t conjunto;
+
+    if (cpu < 0 || cpu >= CPU_SETSIZE)
+    {
+        return 0;
+    }
+
+    CPU_ZERO(&conjunto);
+    CPU_SET(cpu, &conjunto);
+
+    return sched_setaffinity(0, sizeof(conjunto), &conjunto) == 0;
+}
+
+/**
+ * @brief Cria um diretório e os que faltarem no caminho até ele.
+ *
+ * @param caminho Diretório a criar; é alterado durante a chamada e restaurado ao final.
+ * @return 1 se o diretório existe ao final, ou 0 em caso de falha.
+ */
+int criar_diretorios(char *caminho)
+{
+    struct stat informacoes;
+
+    for (char *barra = strchr(caminho + 1, '/'); barra != NULL; barra = strchr(barra + 1, '/'))
+    {
+        *barra = '\0';
+        if (mkdir(caminho, 0755) != 0 && errno != EEXIST)
+        {
+            *barra = '/';
+            return 0;
+        }
+        *barra = '/';
+    }
+    if (mkdir(caminho, 0755) != 0 && errno != EEXIST)
+    {
+        return 0;
+    }
+
+    return stat(caminho, &informacoes) == 0 && S_ISDIR(informacoes.st_mode);
+}
+
+/**
+ * @brief Localiza a pasta `results` do projeto independentemente do diretório atual.
+ *
+ * Usa a variável de ambiente `VARIAVEL_PASTA_RESULTADOS`, se definida.
+ * Senão, procura `results` no diretório do executável e nos dois
+ * acima dele (o programa costuma ser compilado em `src/` ou na raiz),
+ * e, por último, usa `results` no diretório atual.
+ *
+ * @param destino Destino do caminho da pasta.
+ * @param tamanho Tamanho de `destino`.
+ */
+void localizar_pasta_resultados(char *destino, size_t tamanho)
+{
+    const char *variavel = getenv(VARIAVEL_PASTA_RESULTADOS);
+    char executavel[TAMANHO_CAMINHO_RESULTADOS];
+    ssize_t lidos;
+    int encontrada = 0;
+
+    if (variavel != NULL && variavel[0] != '\0')
+    {
+        snprintf(destino, tamanho, "%s", variavel);
+        return;
+    }
+
+    lidos = readlink("/proc/self/exe", executavel, sizeof(executavel) - 1);
+    if (lidos > 0)
+    {
+        char *barra;
+
+        executavel[lidos] = '\0';
+        barra = strrchr(executavel, '/');
+        for (int nivel = 0; nivel < 3 && barra != NULL && encontrada == 0; nivel++)
+        {
+            struct stat informacoes;
+
+            *barra = '\0';
+            snprintf(destino, tamanho, "%s/results", executavel);
+            encontrada = stat(destino, &informacoes) == 0 && S_ISDIR(informacoes.st_mode);
+            barra = strrchr(executavel, '/');
+        }
+    }
+
+    if (encontrada == 0)
+    {
+        snprintf(destino, tamanho, "results");
+    }
+}
+
+/**
+ * @brief Obtém a revisão do código para identificar as execuções.
+ *
+ * Usa a variável de ambiente `VARIAVEL_REVISAO`, se definida; senão, a
+ * revisão fixada na compilação por `REVISAO` ("desconhecida" se não
+ * foi informada). Nenhum processo externo é executado.
+ *
+ * @param destino Destino da revisão, com `TAMANHO_NOME_REGISTRO` bytes.
+ */
+void obter_revisao(char *destino)
+{
+    const char *variavel = getenv(VARIAVEL_REVISAO);
+
+    snprintf(destino, TAMANHO_NOME_REGISTRO, "%s", variavel != NULL && variavel[0] != '\0' ? variavel : REVISAO);
+}
+
+/**
+ * @brief Prepara o repositório de resultados de um programa.
+ *
+ * Sem `caminho`, o repositório é `<results>/<programa>/file/execucoes.csv`
+ * (ou `.bin`), com a pasta `results` localizada por
+ * `localizar_pasta_resultados` e as subpastas criadas se faltarem.
+ * O arquivo em si só é criado na primeira execução anexada.
+ *
+ * @param repositorio Repositório a preparar.
+ * @param caminho Arquivo do repositório, ou NULL para o padrão do programa.
+ * @param formato FORMATO_REGISTRO_CSV ou FORMATO_REGISTRO_BINARIO.
+ * @param programa "guloso" ou "backtracking".
+ * @return 1 se o repositório está pronto, ou 0 se a pasta não pôde ser criada.
+ */
+int repositorio_abrir(RepositorioResultados *repositorio, const char *caminho, int formato, const char *programa)
+{
+    int resultado = 1;
+
+    repositorio->formato = formato;
+    obter_revisao(repositorio->revisao);
+
+    if (caminho != NULL)
+    {
+        snprintf(repositorio->caminho, sizeof(repositorio->caminho), "%s", caminho);
+    }
+    else
+    {
+        char pasta[TAMANHO_CAMINHO_RESULTADOS - 4 * TAMANHO_NOME_REGISTRO];
+        char subpasta[TAMANHO_CAMINHO_RESULTADOS - TAMANHO_NOME_REGISTRO];
+
+        localizar_pasta_resultados(pasta, sizeof(pasta));
+        snprintf(subpasta, sizeof(subpasta), "%s/%s/file", pasta, programa);
+        resultado = criar_diretorios(subpasta);
+        snprintf(repositorio->caminho, sizeof(repositorio->caminho), "%s/execucoes.%s", subpasta,
+                 formato == FORMATO_REGISTRO_BINARIO ? "bin" : "csv");
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Inicia um registro com a identificação da instância e sem medições.
+ *
+ * @param registro Registro a iniciar.
+ * @param programa "guloso" ou "backtracking".
+ * @param instancia Identificador da instância; vírgulas e quebras de linha viram '_'.
+ * @param n_pontos Pontos da instância.
+ * @param n_intervalos Intervalos da instância.
+ */
+void registro_iniciar(RegistroExecucao *registro, const char *programa, const char *instancia, int n_pontos, int n_intervalos)
+{
+    memset(registro, 0, sizeof(*registro));
+    snprintf(registro->programa, sizeof(registro->programa), "%s", programa);
+    snprintf(registro->instancia, sizeof(registro->instancia), "%s", instancia);
+    for (char *c = registro->instancia; *c != '\0'; c++)
+    {
+        if (*c == ',' || *c == '\n' || *c == '\r')
+        {
+            *c = '_';
+        }
+    }
+    registro->n_pontos = n_pontos;
+    registro->n_intervalos = n_intervalos;
+    registro->threads = 1;
+}
+
+/**
+ * @brief Copia um campo para o registro binário e avança o cursor.
+ *
+ * @param cursor Posição de escrita no registro.
+ * @param valor Bytes do campo.
+ * @param tamanho Tamanho do campo.
+ */
+void escrever_campo_registro(unsigned char **cursor, const void *valor, size_t tamanho)
+{
+    memcpy(*cursor, valor, tamanho);
+    *cursor += tamanho;
+}
+
+/**
+ * @brief Monta o registro binário de uma execução.
+ *
+ * O registro tem `TAMANHO_REGISTRO_BINARIO` bytes, sem preenchimento
+ * entre os campos e na ordem de bytes da máquina: `horario` (int64),
+ * `revisao`, `programa`, `instancia` e `motor` (texto terminado em
+ * zero, com 16, 16, 64 e 16 bytes), `n_pontos`, `n_intervalos`,
+ * `threads`, `n_solucao` e `amostras` (int32), `tempo_ms` e os seis
+ * tempos de busca (double)
+ * e `pico_memoria_bytes`, `n_alocacoes`, `memoria_kb` e
+ * `nos_visitados` (int64).
+ *
+ * @param repositorio Repositório, de onde vem a revisão.
+ * @param registro Execução a registrar.
+ * @param horario Momento do registro, em segundos desde a época Unix.
+ * @param destino Destino dos `TAMANHO_REGISTRO_BINARIO` bytes.
+ */
+void montar_registro_binario(const RepositorioResultados *repositorio, const RegistroExecucao *registro, int64_t horario,
+                             unsigned char *destino)
+{
+    unsigned char *cursor = destino;
+    char revisao[TAMANHO_NOME_REGISTRO] = {0};
+    int32_t inteiros[5];
+    double tempos[7];
+    int64_t contagens[4];
+
+    snprintf(revisao, sizeof(revisao), "%s", repositorio->revisao);
+    inteiros[0] = registro->n_pontos;
+    inteiros[1] = registro->n_intervalos;
+    inteiros[2] = registro->threads;
+    inteiros[3] = registro->n_solucao;
+    inteiros[4] = registro->busca.amostras;
+    tempos[0] = registro->tempo;
+    tempos[1] = registro->busca.minimo;
+    tempos[2] = registro->busca.mediana;
+    tempos[3] = registro->busca.p95;
+    tempos[4] = registro->busca.p99;
+    tempos[5] = registro->busca.media;
+    tempos[6] = registro->busca.desvio;
+    contagens[0] = (int64_t)registro->pico_memoria;
+    contagens[1] = registro->n_alocacoes;
+    contagens[2] = registro->memoria_kb;
+    contagens[3] = registro->nos_visitados;
+
+    escrever_campo_registro(&cursor, &horario, sizeof(horario));
+    escrever_campo_registro(&cursor, revisao, sizeof(revisao));
+    escrever_campo_registro(&cursor, registro->programa, sizeof(registro->programa));
+    escrever_campo_registro(&cursor, registro->instancia, sizeof(registro->instancia));
+    escrever_campo_registro(&cursor, registro->motor, sizeof(registro->motor));
+    escrever_campo_registro(&cursor, inteiros, sizeof(inteiros));
+    escrever_campo_registro(&cursor, tempos, sizeof(tempos));
+    escrever_campo_registro(&cursor, contagens, sizeof(contagens));
+}
+
+/**
+ * @brief Anexa uma execução ao final do repositório.
+ *
+ * O arquivo é aberto em modo `O_APPEND` a cada chamada, e a linha (ou
+ * o registro binário) é escrita com um único `write`, junto com o
+ * cabeçalho quando o arquivo ainda está vazio. Em CSV, as colunas são
+ * `horario,revisao,programa,instancia,n_pontos,n_intervalos,motor,threads,
+ * amostras,tempo_ms,busca_min_ms,busca_mediana_ms,busca_p95_ms,busca_p99_ms,
+ * busca_media_ms,busca_desvio_ms,pico_memoria_bytes,n_alocacoes,
+ * memoria_kb,nos_visitados,n_intervalos_solucao`. O formato binário
+ * começa com `ASSINATURA_REGISTRO_BINARIO` e o tamanho de cada registro
+ * (int32), seguidos dos registros de `montar_registro_binario`.
+ *
+ * @param repositorio Repositório preparado por `repositorio_abrir`.
+ * @param registro Execução a registrar.
+ * @return 1 se a execução foi anexada, ou 0 em caso de falha.
+ */
+int repositorio_anexar(const RepositorioResultados *repositorio, const RegistroExecucao *registro)
+{
+    char linha[1024];
+    size_t tamanho = 0;
+    int64_t horario = (int64_t)time(NULL);
+    struct stat informacoes;
+    int resultado = 0;
+    int descritor = open(repositorio->caminho, O_WRONLY | O_APPEND | O_CREAT, 0644);
+
+    if (descritor < 0)
+    {
+        return 0;
+    }
+
+    if (fstat(descritor, &informacoes) == 0)
+    {
+        int vazio = informacoes.st_size == 0;
+
+        if (repositorio->formato == FORMATO_REGISTRO_BINARIO)
+        {
+            int32_t tamanho_registro = TAMANHO_REGISTRO_BINARIO;
+
+            if (vazio)
+            {
+                memcpy(linha, ASSINATURA_REGISTRO_BINARIO, 4);
+                memcpy(linha + 4, &tamanho_registro, sizeof(tamanho_registro));
+                tamanho = 4 + sizeof(tamanho_registro);
+            }
+            montar_registro_binario(repositorio, registro, horario, (unsigned char *)linha + tamanho);
+            tamanho += TAMANHO_REGISTRO_BINARIO;
+        }
+        else
+        {
+            int escritos = 0;
+
+            if (vazio)
+            {
+                escritos = snprintf(linha, sizeof(linha),
+                                    "horario,revisao,programa,instancia,n_pontos,n_intervalos,motor,threads,amostras,"
+                                    "tempo_ms,busca_min_ms,busca_mediana_ms,busca_p95_ms,busca_p99_ms,busca_media_ms,busca_desvio_ms,"
+                                    "pico_memoria_bytes,n_alocacoes,memoria_kb,nos_visitados,n_intervalos_solucao\n");
+            }
+            tamanho = (size_t)escritos;
+            escritos = snprintf(linha + tamanho, sizeof(linha) - tamanho,
+                                "%lld,%s,%s,%s,%d,%d,%s,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%zu,%" PRId64 ",%ld,%" PRId64 ",%d\n",
+                                (long long)horario, repositorio->revisao, registro->programa, registro->instancia,
+                                registro->n_pontos, registro->n_intervalos, registro->motor, registro->threads,
+                                registro->busca.amostras, registro->tempo, registro->busca.minimo, registro->busca.mediana,
+                                registro->busca.p95, registro->busca.p99, registro->busca.media, registro->busca.desvio,
+                                registro->pico_memoria, registro->n_alocacoes, registro->memoria_kb,
+                                registro->nos_visitados, registro->n_solucao);
+            tamanho += (size_t)escritos;
+        }
+
+        resultado = write(descritor, linha, tamanho) == (ssize_t)tamanho;
+    }
+
+    close(descritor);
+    return resultado;
+}
+
+/**
+ * Os três cenários fixos são os mesmos nos dois programas; cada
+ * solucionador copia os dados e ordena os intervalos conforme o seu
+ * próprio critério.
+ */
+static const Ponto pontos_cenario_pequeno[] =
+{
+    {1, 5}, {2, 10}, {3, 15}, {4, 20}, {5, 25},
+    {6, 30}, {7, 35}, {8, 40}
+};
+
+static const Intervalo intervalos_cenario_pequeno[] =
+{
+    {0, 12}, {8, 22}, {15, 28}, {25, 42}, {5, 18},
+    {18, 32}, {30, 45}, {3, 15}, {20, 35}, {12, 26}
+};
+
+static const Ponto pontos_cenario_medio[] =
+{
+    {1, 8}, {2, 16}, {3, 24}, {4, 32}, {5, 40},
+    {6, 48}, {7, 56}, {8, 64}, {9, 72}, {10, 80}
+};
+
+static const Intervalo intervalos_cenario_medio[] =
+{
+    {0, 20}, {12, 35}, {25, 45}, {38, 58}, {50, 75},
+    {65, 85}, {5, 28}, {20, 42}, {35, 55}, {48, 68},
+    {60, 82}, {15, 38}
+};
+
+static const Ponto pontos_cenario_grande[] =
+{
+    {1, 5}, {2, 12}, {3, 18}, {4, 25}, {5, 32},
+    {6, 38}, {7, 45}, {8, 52}, {9, 58}, {10, 65},
+    {11, 72}, {12, 80}
+};
+
+static const Intervalo intervalos_cenario_grande[] =
+{
+    {0, 15}, {10, 28}, {20, 35}, {30, 48}, {40, 58},
+    {50, 68}, {60, 85}, {5, 20}, {15, 32}, {25, 42},
+    {35, 52}, {45, 62}, {55, 75}, {70, 85}, {8, 26}
+};
+
+static const CenarioCobertura cenarios[N_CENARIOS] =
+{
+    {"pequeno", 8, 10, pontos_cenario_pequeno, intervalos_cenario_pequeno},
+    {"medio", 10, 12, pontos_cenario_medio, intervalos_cenario_medio},
+    {"grande", 12, 15, pontos_cenario_grande, intervalos_cenario_grande}
+};
+
+/**
+ * @brief Devolve os dados de um dos cenários fixos.
+ *
+ * @param cenario Cenário (CENARIO_PEQUENO, CENARIO_MEDIO ou CENARIO_GRANDE).
+ * @return Ponteiro para o cenário, ou NULL se o índice for inválido.
+ */
+const CenarioCobertura *obter_cenario(int cenario)
+{
+    const CenarioCobertura *resultado = NULL;
+
+    if (cenario >= 0 && cenario < N_CENARIOS)
+    {
+        resultado = &cenarios[cenario];
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Retorna o nome de um solucionador, como aceito por `--solucionador`.
+ *
+ * @param solucionador Solucionador (SOLUCIONADOR_*).
+ * @return Nome do solucionador, ou "desconhecido".
+ */
+const char *nome_solucionador(int solucionador)
+{
+    static const char *nomes[N_SOLUCIONADORES] = {"guloso", "varredura", "backtracking", "poda",
+                                                  "paralelo", "iterativo", "limitado", "dinamica"};
+    const char *resultado = "desconhecido";
+
+    if (solucionador >= 0 && solucionador < N_SOLUCIONADORES)
+    {
+        resultado = nomes[solucionador];
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Converte o nome de um solucionador no seu índice.
+ *
+ * @param nome Nome do solucionador.
+ * @return Índice SOLUCIONADOR_* correspondente, ou -1 se o nome for desconhecido.
+ */
+int solucionador_por_nome(const char *nome)
+{
+    int resultado = -1;
+
+    for (int s = 0; s < N_SOLUCIONADORES && resultado < 0; s++)
+    {
+        if (strcmp(nome, nome_solucionador(s)) == 0)
+        {
+            resultado = s;
+        }
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Preenche as opções com os valores padrão dos programas.
+ *
+ * O solucionador padrão é a varredura, que é ótima e a mais rápida; o
+ * solucionador paralelo usa uma thread por CPU disponível.
+ *
+ * @param opcoes Opções a preencher.
+ */
+void opcoes_cobertura_padrao(OpcoesCobertura *opcoes)
+{
+    long n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    opcoes->solucionador = SOLUCIONADOR_VARREDURA;
+    opcoes->usar_bitset = 0;
+    opcoes->aplicar_reducao = 0;
+    opcoes->n_threads = n_cpus > 0 ? (int)n_cpus : 1;
+    opcoes->profundidade_divisao = PROFUNDIDADE_DIVISAO_PADRAO;
+    opcoes->limite_tempo_ms = 0.0;
+    opcoes->limite_nos = 0;
+    opcoes->decompor = 0;
+}
+
+/**
+ * @brief Resolve a instância com o solucionador guloso.
+ *
+ * Os intervalos são ordenados pelo critério guloso em uma cópia da
+ * instância, como em `configurar_cenario`.
+ *
+ * @param instancia Instância a resolver.
+ * @param opcoes Opções da resolução.
+ * @param resultado Resultado a preencher.
+ * @return 1 em caso de sucesso, ou 0 se faltar memória.
+ */
+int resolver_cobertura_guloso(const InstanciaCobertura *instancia, const OpcoesCobertura *opcoes, ResultadoCobertura *resultado)
+{
+    Problema problema;
+    Metricas metricas;
+    int sucesso = 0;
+
+    inicializar_problema(&problema);
+    problema.configuracao.motor = opcoes->solucionador == SOLUCIONADOR_GULOSO ? MOTOR_GULOSO_CLASSICO : MOTOR_GULOSO_VARREDURA;
+    problema.configuracao.usar_bitset = opcoes->usar_bitset;
+    problema.configuracao.aplicar_reducao = opcoes->aplicar_reducao;
+
+    if (alocar_instancia(&problema, instancia->n_pontos, instancia->n_intervalos))
+    {
+        if (instancia->n_pontos > 0)
+        {
+            memcpy(problema.pontos, instancia->pontos, (size_t)instancia->n_pontos * sizeof(Ponto));
+        }
+        if (instancia->n_intervalos > 0)
+        {
+            memcpy(problema.intervalos, instancia->intervalos, (size_t)instancia->n_intervalos * sizeof(Intervalo));
+        }
+        qsort(problema.intervalos, problema.n_intervalos, sizeof(Intervalo), comparar_intervalos);
+
+        metricas = resolver_guloso(&problema);
+
+        resultado->n_solucao = problema.n_solucao;
+        resultado->solucao = (Intervalo *)malloc(((size_t)problema.n_solucao + 1) * sizeof(Intervalo));
+        if (resultado->solucao != NULL)
+        {
+            if (problema.n_solucao > 0)
+            {
+                memcpy(resultado->solucao, problema.solucao, (size_t)problema.n_solucao * sizeof(Intervalo));
+            }
+            resultado->cobertura_completa = problema.n_pontos_cobertos == problema.n_pontos;
+            resultado->otima = resultado->cobertura_completa && (opcoes->solucionador == SOLUCIONADOR_VARREDURA || problema.n_pontos == 0);
+            resultado->tempo_ms = metricas.tempo;
+            resultado->tempo_preparo_ms = metricas.tempo_preparo;
+            resultado->tempo_busca_ms = metricas.tempo_busca;
+            resultado->pico_memoria = metricas.pico_memoria;
+            resultado->n_alocacoes = metricas.n_alocacoes;
+            sucesso = 1;
+        }
+    }
+
+    liberar_problema(&problema);
+
+    return sucesso;
+}
+
+/**
+ * @brief Resolve a instância com um dos motores do backtracking.
+ *
+ * Os intervalos são ordenados por tamanho decrescente em uma cópia da
+ * instância, como em `configurar_cenario_backtracking`.
+ *
+ * @param instancia Instância a resolver.
+ * @param opcoes Opções da resolução.
+ * @param resultado Resultado a preencher.
+ * @return 1 em caso de sucesso, ou 0 se faltar memória.
+ */
+int resolver_cobertura_backtracking(const InstanciaCobertura *instancia, const OpcoesCobertura *opcoes, ResultadoCobertura *resultado)
+{
+    static const int motores[N_SOLUCIONADORES] = {-1, -1, MOTOR_BACKTRACKING_CLASSICO, MOTOR_BACKTRACKING_PODA,
+                                                  MOTOR_BACKTRACKING_PARALELO, MOTOR_BACKTRACKING_ITERATIVO,
+                                                  MOTOR_BACKTRACKING_LIMITADO, MOTOR_BACKTRACKING_DINAMICA};
+    ProblemaBacktracking problema;
+    MetricasBacktracking metricas;
+    int sucesso = 0;
+
+    inicializar_problema_backtracking(&problema);
+    problema.configuracao.motor = motores[opcoes->solucionador];
+    problema.configuracao.usar_bitset = opcoes->usar_bitset;
+    problema.configuracao.aplicar_reducao = opcoes->aplicar_reducao;
+    problema.configuracao.n_threads = opcoes->n_threads;
+    problema.configuracao.profundidade_divisao = opcoes->profundidade_divisao;
+    problema.configuracao.limite_tempo_ms = opcoes->limite_tempo_ms;
+    problema.configuracao.limite_nos = opcoes->limite_nos;
+
+    if (alocar_instancia_backtracking(&problema, instancia->n_pontos, instancia->n_intervalos))
+    {
+        if (instancia->n_pontos > 0)
+        {
+            memcpy(problema.pontos, instancia->pontos, (size_t)instancia->n_pontos * sizeof(Ponto));
+        }
+        if (instancia->n_intervalos > 0)
+        {
+            memcpy(problema.intervalos, instancia->intervalos, (size_t)instancia->n_intervalos * sizeof(Intervalo));
+        }
+        qsort(problema.intervalos, problema.n_intervalos, sizeof(Intervalo), comparar_intervalos_backtracking);
+
+        metricas = resolver_backtracking(&problema);
+
+        resultado->n_solucao = problema.n_melhor_solucao == INT_MAX ? 0 : problema.n_melhor_solucao;
+        resultado->solucao = (Intervalo *)malloc(((size_t)resultado->n_solucao + 1) * sizeof(Intervalo));
+        if (resultado->solucao != NULL)
+        {
+            if (resultado->n_solucao > 0)
+            {
+                memcpy(resultado->solucao, problema.melhor_solucao, (size_t)resultado->n_solucao * sizeof(Intervalo));
+            }
+            resultado->cobertura_completa = problema.n_melhor_solucao != INT_MAX;
+            resultado->otima = resultado->cobertura_completa &&
+                               (problema.configuracao.motor != MOTOR_BACKTRACKING_LIMITADO || metricas.busca_concluida);
+            resultado->tempo_ms = metricas.tempo;
+            resultado->tempo_preparo_ms = metricas.tempo_preparo;
+            resultado->tempo_busca_ms = metricas.tempo_busca;
+            resultado->nos_visitados = metricas.nos_visitados;
+            resultado->limite_inferior = metricas.limite_inferior;
+            resultado->gap = metricas.gap;
+            resultado->pico_memoria = metricas.pico_memoria;
+            resultado->n_alocacoes = metricas.n_alocacoes;
+            resultado->profundidade_maxima = metricas.profundidade_maxima;
+            sucesso = 1;
+        }
+    }
+
+    liberar_problema_backtracking(&problema);
+
+    return sucesso;
+}
+
+/**
+ * @brief Resolve uma instância com qualquer um dos solucionadores.
+ *
+ * É a interface única da biblioteca: a mesma instância e o mesmo tipo
+ * de resultado servem ao guloso, à varredura e a todos os motores do
+ * backtracking, sem passar pelos programas de linha de comando. A
+ * instância não é alterada. Com `opcoes->decompor`, a instância é
+ * dividida por `resolver_cobertura_por_componentes`. Em todos os
+ * solucionadores, uma instância sem pontos tem como solução ótima a
+ * cobertura vazia, mesmo sem intervalos.
+ *
+ * @param instancia Instância a resolver.
+ * @param opcoes Solucionador e opções, ou NULL para `opcoes_cobertura_padrao`.
+ * @param resultado Resultado a preencher; a solução deve ser devolvida
+ *        com `liberar_resultado_cobertura`.
+ * @return 1 em caso de sucesso, ou 0 se o solucionador for inválido ou
+ *         faltar memória.
+ */
+int resolver_cobertura(const InstanciaCobertura *instancia, const OpcoesCobertura *opcoes, ResultadoCobertura *resultado)
+{
+    OpcoesCobertura padrao;
+    int sucesso = 0;
+
+    memset(resultado, 0, sizeof(*resultado));
+
+    if (opcoes == NULL)
+    {
+        opcoes_cobertura_padrao(&padrao);
+        opcoes = &padrao;
+    }
+
+    if (opcoes->decompor && opcoes->solucionador >= 0 && opcoes->solucionador < N_SOLUCIONADORES)
+    {
+        sucesso = resolver_cobertura_por_componentes(instancia, opcoes, resultado);
+    }
+    else if (opcoes->solucionador == SOLUCIONADOR_GULOSO || opcoes->solucionador == SOLUCIONADOR_VARREDURA)
+    {
+        sucesso = resolver_cobertura_guloso(instancia, opcoes, resultado);
+    }
+    else if (opcoes->solucionador > SOLUCIONADOR_VARREDURA && opcoes->solucionador < N_SOLUCIONADORES)
+    {
+        sucesso = resolver_cobertura_backtracking(instancia, opcoes, resultado);
+    }
+
+    return sucesso;
+}
+
+/**
+ * @brief Um componente independente da reta e o resultado da sua resolução.
+ *
+ * Os pontos e intervalos do componente ocupam faixas contíguas dos
+ * vetores do `ContextoComponentes`, na ordem relativa da instância.
+ */
+typedef struct
+{
+    int primeiro_ponto; /**< Posição do primeiro ponto do componente no vetor de pontos. */
+    int n_pontos; /**< Quantidade de pontos do componente. */
+    int primeiro_intervalo; /**< Posição do primeiro intervalo do componente no vetor de intervalos. */
+    int n_intervalos; /**< Quantidade de intervalos do componente. */
+    int sucesso; /**< Retorno de `resolver_cobertura` para o componente. */
+    ResultadoCobertura resultado; /**< Resultado do componente. */
+} ComponenteCobertura;
+
+/**
+ * @brief Componentes de uma instância e estado compartilhado pelas threads que os resolvem.
+ *
+ * Os componentes ficam em `componentes` na ordem da reta e são
+ * distribuídos pela ordem de `ordem`, do maior para o menor: cada thread
+ * pega o próximo pelo contador atômico, de modo que os componentes caros
+ * começam primeiro e os pequenos preenchem o fim.
+ */
+typedef struct
+{
+    Ponto *pontos; /**< Pontos agrupados por componente. */
+    Intervalo *intervalos; /**< Intervalos agrupados por componente. */
+    ComponenteCobertura *componentes; /**< Componentes, na ordem da reta. */
+    ComponenteCobertura **ordem; /**< Componentes, do maior para o menor. */
+    int n_componentes; /**< Quantidade de componentes. */
+    OpcoesCobertura opcoes; /**< Opções de cada componente, sem `decompor`. */
+    atomic_int proximo; /**< Próxima posição de `ordem` a resolver. */
+} ContextoComponentes;
+
+/**
+ * @brief Compara dois componentes pelo tamanho, do maior para o menor.
+ *
+ * Função compatível com `qsort`, sobre um vetor de ponteiros para
+ * componentes; no empate, vale a ordem da reta.
+ *
+ * @param a Ponteiro para o ponteiro do primeiro componente.
+ * @param b Ponteiro para o ponteiro do segundo componente.
+ * @return Valor negativo, positivo ou zero conforme a ordem relativa.
+ */
+int comparar_componentes(const void *a, const void *b)
+{
+    const ComponenteCobertura *componente_a = *(ComponenteCobertura *const *)a;
+    const ComponenteCobertura *componente_b = *(ComponenteCobertura *const *)b;
+    int64_t tamanho_a = (int64_t)componente_a->n_pontos + componente_a->n_intervalos;
+    int64_t tamanho_b = (int64_t)componente_b->n_pontos + componente_b->n_intervalos;
+    int resultado = 0;
+
+    if (tamanho_a != tamanho_b)
+    {
+        resultado = tamanho_a > tamanho_b ? -1 : 1;
+    }
+    else if (componente_a != componente_b)
+    {
+        resultado = componente_a < componente_b ? -1 : 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Libera os vetores de uma decomposição e os resultados dos componentes.
+ *
+ * @param contexto Decomposição a liberar.
+ */
+void liberar_componentes(ContextoComponentes *contexto)
+{
+    for (int c = 0; contexto->componentes != NULL && c < contexto->n_componentes; c++)
+    {
+        liberar_resultado_cobertura(&contexto->componentes[c].resultado);
+    }
+    free(contexto->pontos);
+    free(contexto->intervalos);
+    free(contexto->componentes);
+    free(contexto->ordem);
+    contexto->pontos = NULL;
+    contexto->intervalos = NULL;
+    contexto->componentes = NULL;
+    contexto->ordem = NULL;
+    contexto->n_componentes = 0;
+}
+
+/**
+ * @brief Divide uma instância nos seus componentes independentes.
+ *
+ * Com os pontos ordenados por posição, dois pontos vizinhos ficam no
+ * mesmo componente se algum intervalo cobre os dois. Cada intervalo
+ * cobre uma faixa contígua de postos (obtida por busca binária), e uma
+ * soma de prefixos sobre as faixas marca, em uma única passagem, os
+ * vizinhos ligados. Intervalos que não cobrem pontos são descartados.
+ * Por fim, pontos e intervalos são distribuídos por componente de forma
+ * estável, mantendo a ordem relativa da instância.
+ *
+ * @param instancia Instância a dividir (não é alterada).
+ * @param contexto Recebe os vetores agrupados e os componentes.
+ * @return 1 em caso de sucesso, ou 0 se faltar memória.
+ */
+int decompor_instancia(const InstanciaCobertura *instancia, ContextoComponentes *contexto)
+{
+    int n_pontos = instancia->n_pontos;
+    int n_intervalos = instancia->n_intervalos;
+    Ponto *ordenados = (Ponto *)malloc(((size_t)n_pontos + 1) * sizeof(Ponto));
+    int *ligacoes = (int *)calloc((size_t)n_pontos + 1, sizeof(int));
+    int *componente_do_ponto = (int *)malloc(((size_t)n_pontos + 1) * sizeof(int));
+    int *componente_do_intervalo = (int *)malloc(((size_t)n_intervalos + 1) * sizeof(int));
+    int sucesso = 0;
+
+    contexto->pontos = (Ponto *)malloc(((size_t)n_pontos + 1) * sizeof(Ponto));
+    contexto->intervalos = (Intervalo *)malloc(((size_t)n_intervalos + 1) * sizeof(Intervalo));
+    contexto->componentes = NULL;
+    contexto->ordem = NULL;
+    contexto->n_componentes = 0;
+
+    if (ordenados != NULL && ligacoes != NULL && componente_do_ponto != NULL && componente_do_intervalo != NULL &&
+        contexto->pontos != NULL && contexto->intervalos != NULL)
+    {
+        int n_componentes = 0;
+
+        /* `id` passa a guardar o índice do ponto na instância. */
+        for (int j = 0; j < n_pontos; j++)
+        {
+            ordenados[j].id = j;
+            ordenados[j].posicao = instancia->pontos[j].posicao;
+        }
+        qsort(ordenados, n_pontos, sizeof(Ponto), comparar_pontos);
+
+        for (int i = 0; i < n_intervalos; i++)
+        {
+            int primeiro = primeiro_ponto_a_partir(ordenados, n_pontos, instancia->intervalos[i].inicio);
+            int seguinte = instancia->intervalos[i].fim == INT_MAX
+                               ? n_pontos
+                               : primeiro_ponto_a_partir(ordenados, n_pontos, instancia->intervalos[i].fim + 1);
+
+            componente_do_intervalo[i] = seguinte > primeiro ? primeiro : -1;
+            if (seguinte - primeiro >= 2)
+            {
+                ligacoes[primeiro]++;
+                ligacoes[seguinte - 1]--;
+            }
+        }
+
+        /* O posto j fecha um componente se nenhuma faixa liga j a j + 1. */
+        for (int j = 0, abertas = 0; j < n_pontos; j++)
+        {
+            abertas += ligacoes[j];
+            componente_do_ponto[ordenados[j].id] = n_componentes;
+            if (abertas == 0 || j == n_pontos - 1)
+            {
+                n_componentes++;
+            }
+        }
+        for (int i = 0; i < n_intervalos; i++)
+        {
+            if (componente_do_intervalo[i] >= 0)
+            {
+                componente_do_intervalo[i] = componente_do_ponto[ordenados[componente_do_intervalo[i]].id];
+            }
+        }
+
+        contexto->componentes = (ComponenteCobertura *)calloc((size_t)n_componentes + 1, sizeof(ComponenteCobertura));
+        contexto->ordem = (ComponenteCobertura **)malloc(((size_t)n_componentes + 1) * sizeof(ComponenteCobertura *));
+        if (contexto->componentes != NULL && contexto->ordem != NULL)
+        {
+            ComponenteCobertura *componentes = contexto->componentes;
+
+            contexto->n_componentes = n_componentes;
+            for (int j = 0; j < n_pontos; j++)
+            {
+                componentes[componente_do_ponto[j]].n_pontos++;
+            }
+            for (int i = 0; i < n_intervalos; i++)
+            {
+                if (componente_do_intervalo[i] >= 0)
+                {
+                    componentes[componente_do_intervalo[i]].n_intervalos++;
+                }
+            }
+            for (int c = 0; c < n_componentes; c++)
+            {
+                if (c > 0)
+                {
+                    componentes[c].primeiro_ponto = componentes[c - 1].primeiro_ponto + componentes[c - 1].n_pontos;
+                    componentes[c].primeiro_intervalo = componentes[c - 1].primeiro_intervalo + componentes[c - 1].n_intervalos;
+                }
+                contexto->ordem[c] = &componentes[c];
+            }
+            for (int c = 0; c < n_componentes; c++)
+            {
+                componentes[c].n_pontos = 0;
+                componentes[c].n_intervalos = 0;
+            }
+
+            for (int j = 0; j < n_pontos; j++)
+            {
+                ComponenteCobertura *componente = &componentes[componente_do_ponto[j]];
+
+                contexto->pontos[componente->primeiro_ponto + componente->n_pontos++] = instancia->pontos[j];
+            }
+            for (int i = 0; i < n_intervalos; i++)
+            {
+                if (componente_do_intervalo[i] >= 0)
+                {
+                    ComponenteCobertura *componente = &componentes[componente_do_intervalo[i]];
+
+                    contexto->intervalos[componente->primeiro_intervalo + componente->n_intervalos++] = instancia->intervalos[i];
+                }
+            }
+
+            qsort(contexto->ordem, n_componentes, sizeof(ComponenteCobertura *), comparar_componentes);
+            sucesso = 1;
+        }
+    }
+
+    free(ordenados);
+    free(ligacoes);
+    free(componente_do_ponto);
+    free(componente_do_intervalo);
+    if (sucesso == 0)
+    {
+        liberar_componentes(contexto);
+    }
+
+    return sucesso;
+}
+
+/**
+ * @brief Resolve componentes até que não reste nenhum.
+ *
+ * @param argumento Ponteiro para o `ContextoComponentes`.
+ * @return NULL.
+ */
+void *executar_trabalhador_componentes(void *argumento)
+{
+    ContextoComponentes *contexto = (ContextoComponentes *)argumento;
+    int posicao;
+
+    while ((posicao = atomic_fetch_add(&contexto->proximo, 1)) < contexto->n_componentes)
+    {
+        ComponenteCobertura *componente = contexto->ordem[posicao];
+        InstanciaCobertura instancia;
+
+        instancia.pontos = contexto->pontos + componente->primeiro_ponto;
+        instancia.n_pontos = componente->n_pontos;
+        instancia.intervalos = contexto->intervalos + componente->primeiro_intervalo;
+        instancia.n_intervalos = componente->n_intervalos;
+        componente->sucesso = resolver_cobertura(&instancia, &contexto->opcoes, &componente->resultado);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Reúne os resultados dos componentes em um único resultado.
+ *
+ * As soluções são concatenadas na ordem da reta; nós, alocações, pico
+ * de memória e limitante inferior são somados (o limitante fica em
+ * INT_MAX, como no backtracking, se algum componente não tem cobertura).
+ *
+ * @param contexto Componentes já resolvidos.
+ * @param resultado Resultado a preencher (zerado).
+ * @return 1 em caso de sucesso, ou 0 se algum componente falhou ou faltar memória.
+ */
+int reunir_componentes(const ContextoComponentes *contexto, ResultadoCobertura *resultado)
+{
+    int n_solucao = 0;
+    int sucesso = 1;
+
+    for (int c = 0; c < contexto->n_componentes; c++)
+    {
+        sucesso &= contexto->componentes[c].sucesso;
+        n_solucao += contexto->componentes[c].resultado.n_solucao;
+    }
+
+    resultado->solucao = sucesso ? (Intervalo *)malloc(((size_t)n_solucao + 1) * sizeof(Intervalo)) : NULL;
+    if (resultado->solucao == NULL)
+    {
+        return 0;
+    }
+
+    resultado->cobertura_completa = 1;
+    resultado->otima = 1;
+    for (int c = 0; c < contexto->n_componentes; c++)
+    {
+        const ResultadoCobertura *parcial = &contexto->componentes[c].resultado;
+
+        if (parcial->n_solucao > 0)
+        {
+            memcpy(resultado->solucao + resultado->n_solucao, parcial->solucao, (size_t)parcial->n_solucao * sizeof(Intervalo));
+        }
+        resultado->n_solucao += parcial->n_solucao;
+        resultado->cobertura_completa &= parcial->cobertura_completa;
+        resultado->otima &= parcial->otima;
+        resultado->nos_visitados += parcial->nos_visitados;
+        if (parcial->limite_inferior == INT_MAX || resultado->limite_inferior == INT_MAX)
+        {
+            resultado->limite_inferior = INT_MAX;
+        }
+        else
+        {
+            resultado->limite_inferior += parcial->limite_inferior;
+        }
+        resultado->pico_memoria += parcial->pico_memoria;
+        resultado->n_alocacoes += parcial->n_alocacoes;
+        if (parcial->profundidade_maxima > resultado->profundidade_maxima)
+        {
+            resultado->profundidade_maxima = parcial->profundidade_maxima;
+        }
+    }
+    if (contexto->opcoes.solucionador == SOLUCIONADOR_LIMITADO && resultado->n_solucao > 0)
+    {
+        resultado->gap = (double)(resultado->n_solucao - resultado->limite_inferior) / resultado->n_solucao;
+    }
+    resultado->n_componentes = contexto->n_componentes;
+
+    return 1;
+}
+
+/**
+ * @brief Resolve separadamente, em paralelo, os componentes independentes da reta.
+ *
+ * Um intervalo só cobre pontos do seu componente, então a solução
+ * ótima da instância é a união das soluções ótimas dos componentes, e
+ * uma busca exponencial sobre a instância inteira vira várias buscas
+ * pequenas. Os componentes (de `decompor_instancia`) são resolvidos
+ * com o solucionador escolhido por até `opcoes->n_threads` threads, e
+ * as threads que sobram quando há menos componentes que threads são
+ * repartidas entre eles para o solucionador paralelo. Como pontos e
+ * intervalos mantêm a ordem relativa da instância, o guloso clássico
+ * escolhe os mesmos intervalos que escolheria na instância inteira.
+ *
+ * O tempo de preparo é o da decomposição, e o de busca é o tempo de
+ * parede da resolução dos componentes.
+ *
+ * @param instancia Instância a resolver (não é alterada).
+ * @param opcoes Solucionador e opções; `decompor` é ignorado.
+ * @param resultado Resultado a preencher, como em `resolver_cobertura`.
+ * @return 1 em caso de sucesso, ou 0 se o solucionador for inválido ou
+ *         faltar memória.
+ */
+int resolver_cobertura_por_componentes(const InstanciaCobertura *instancia, const OpcoesCobertura *opcoes, ResultadoCobertura *resultado)
+{
+    ContextoComponentes contexto;
+    struct timespec inicio, meio, fim;
+    int sucesso = 0;
+
+    memset(resultado, 0, sizeof(*resultado));
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+
+    if (opcoes->solucionador >= 0 && opcoes->solucionador < N_SOLUCIONADORES && decompor_instancia(instancia, &contexto))
+    {
+        int n_trabalhadores = opcoes->n_threads < contexto.n_componentes ? opcoes->n_threads : contexto.n_componentes;
+        pthread_t *threads;
+        int criadas = 0;
+
+        if (n_trabalhadores < 1)
+        {
+            n_trabalhadores = 1;
+        }
+        contexto.opcoes = *opcoes;
+        contexto.opcoes.decompor = 0;
+        contexto.opcoes.n_threads = opcoes->n_threads / n_trabalhadores > 1 ? opcoes->n_threads / n_trabalhadores : 1;
+        atomic_init(&contexto.proximo, 0);
+        threads = (pthread_t *)malloc((size_t)n_trabalhadores * sizeof(pthread_t));
+
+        clock_gettime(CLOCK_MONOTONIC, &meio);
+
+        /* A thread atual também resolve componentes; se alguma thread não for criada, as outras dão conta. */
+        while (threads != NULL && criadas < n_trabalhadores - 1 &&
+               pthread_create(&threads[criadas], NULL, executar_trabalhador_componentes, &contexto) == 0)
+        {
+            criadas++;
+        }
+        executar_trabalhador_componentes(&contexto);
+        for (int t = 0; t < criadas; t++)
+        {
+            pthread_join(threads[t], NULL);
+        }
+        free(threads);
+
+        clock_gettime(CLOCK_MONOTONIC, &fim);
+
+        sucesso = reunir_componentes(&contexto, resultado);
+        resultado->tempo_preparo_ms = (meio.tv_sec - inicio.tv_sec) * 1000.0 + (meio.tv_nsec - inicio.tv_nsec) / 1000000.0;
+        resultado->tempo_busca_ms = (fim.tv_sec - meio.tv_sec) * 1000.0 + (fim.tv_nsec - meio.tv_nsec) / 1000000.0;
+        resultado->tempo_ms = resultado->tempo_preparo_ms + resultado->tempo_busca_ms;
+
+        liberar_componentes(&contexto);
+    }
+
+    return sucesso;
+}
+
+/**
+ * @brief Libera a solução de um resultado de `resolver_cobertura`.
+ *
+ * @param resultado Resultado a liberar.
+ */
+void liberar_resultado_cobertura(ResultadoCobertura *resultado)
+{
+    free(resultado->solucao);
+    resultado->solucao = NULL;
+    resultado->n_solucao = 0;
+}
+
+/**
+ * @brief Resolve uma instância várias vezes e devolve a mediana dos tempos.
+ *
+ * O resultado da última execução fica em `resultado`; os anteriores são
+ * liberados.
+ *
+ * @param instancia Instância a resolver.
+ * @param opcoes Solucionador e opções.
+ * @param repeticoes Quantidade de execuções (ao menos 1).
+ * @param resultado Resultado da última execução.
+ * @param mediana Destino da mediana dos tempos totais, em milissegundos.
+ * @return 1 se todas as execuções tiveram sucesso, ou 0 caso contrário.
+ */
+int resolver_repetido(const InstanciaCobertura *instancia, const OpcoesCobertura *opcoes, int repeticoes, ResultadoCobertura *resultado,
+                      double *mediana)
+{
+    double *tempos = (double *)malloc((size_t)repeticoes * sizeof(double));
+    EstatisticasTempo estatisticas;
+    int sucesso = tempos != NULL;
+
+    memset(resultado, 0, sizeof(*resultado));
+    for (int k = 0; k < repeticoes && sucesso; k++)
+    {
+        if (k > 0)
+        {
+            liberar_resultado_cobertura(resultado);
+        }
+        sucesso = resolver_cobertura(instancia, opcoes, resultado);
+        if (sucesso)
+        {
+            tempos[k] = resultado->tempo_ms;
+        }
+    }
+
+    if (sucesso)
+    {
+        calcular_estatisticas_tempo(tempos, repeticoes, &estatisticas);
+        *mediana = estatisticas.mediana;
+    }
+
+    free(tempos);
+    return sucesso;
+}
+
+/**
+ * @brief Compara um solucionador guloso e um exato sobre a mesma instância.
+ *
+ * A instância é copiada uma única vez e, se algum dos dois pede
+ * `aplicar_reducao`, reduzida uma única vez; os dois solucionadores
+ * recebem então a mesma instância preparada, sem repetir a redução.
+ * Como a redução preserva a solução ótima, o exato continua ótimo
+ * sobre ela, e a razão de aproximação mede o guloso contra o ótimo da
+ * mesma instância. Cada solucionador é executado `repeticoes` vezes, e
+ * os tempos comparados são as medianas.
+ *
+ * @param instancia Instância a comparar.
+ * @param guloso Opções do guloso (`SOLUCIONADOR_GULOSO` ou `SOLUCIONADOR_VARREDURA`).
+ * @param exato Opções do exato (um dos solucionadores de backtracking).
+ * @param repeticoes Execuções de cada solucionador (valores menores que 1 valem 1).
+ * @param comparacao Destino da comparação, devolvida com `liberar_comparacao`.
+ * @return 1 em caso de sucesso, ou 0 se os solucionadores forem inválidos
+ *         ou faltar memória.
+ */
+int comparar_solucionadores(const InstanciaCobertura *instancia, const OpcoesCobertura *guloso, const OpcoesCobertura *exato, int repeticoes,
+                            ComparacaoCobertura *comparacao)
+{
+    size_t pontos = (size_t)instancia->n_pontos;
+    size_t intervalos = (size_t)instancia->n_intervalos;
+    size_t capacidade = ALINHAR_ARENA(pontos * sizeof(Ponto)) + ALINHAR_ARENA(intervalos * sizeof(Intervalo)) +
+                        ALINHAR_ARENA((intervalos + 1) * sizeof(FaixaReducao)) + ALINHAR_ARENA((intervalos + pontos + 1) * sizeof(int)) +
+                        2 * ALINHAR_ARENA((pontos + 1) * sizeof(int));
+    OpcoesCobertura opcoes_guloso = *guloso;
+    OpcoesCobertura opcoes_exato = *exato;
+    InstanciaCobertura preparada;
+    Arena arena;
+    struct timespec inicio, fim;
+    int sucesso = 0;
+
+    memset(comparacao, 0, sizeof(*comparacao));
+    if (guloso->solucionador > SOLUCIONADOR_VARREDURA || exato->solucionador < SOLUCIONADOR_BACKTRACKING ||
+        exato->solucionador >= N_SOLUCIONADORES)
+    {
+        return 0;
+    }
+    if (repeticoes < 1)
+    {
+        repeticoes = 1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+    if (arena_criar(&arena, capacidade, NULL))
+    {
+        Ponto *copia_pontos = (Ponto *)arena_alocar(&arena, pontos * sizeof(Ponto));
+        Intervalo *copia_intervalos = (Intervalo *)arena_alocar(&arena, intervalos * sizeof(Intervalo));
+
+        memcpy(copia_pontos, instancia->pontos, pontos * sizeof(Ponto));
+        memcpy(copia_intervalos, instancia->intervalos, intervalos * sizeof(Intervalo));
+        preparada.pontos = copia_pontos;
+        preparada.n_pontos = instancia->n_pontos;
+        preparada.intervalos = copia_intervalos;
+        preparada.n_intervalos = instancia->n_intervalos;
+
+        if (guloso->aplicar_reducao || exato->aplicar_reducao)
+        {
+            comparacao->reducao = reduzir_instancia(&arena, copia_pontos, &preparada.n_pontos, copia_intervalos, &preparada.n_intervalos);
+        }
+        opcoes_guloso.aplicar_reducao = 0;
+        opcoes_exato.aplicar_reducao = 0;
+        clock_gettime(CLOCK_MONOTONIC, &fim);
+
+        comparacao->n_pontos = preparada.n_pontos;
+        comparacao->n_intervalos = preparada.n_intervalos;
+        comparacao->tempo_preparo_ms = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
+
+        sucesso = resolver_repetido(&preparada, &opcoes_guloso, repeticoes, &comparacao->guloso, &comparacao->tempo_guloso_ms) &&
+                  resolver_repetido(&preparada, &opcoes_exato, repeticoes, &comparacao->exato, &comparacao->tempo_exato_ms);
+        arena_liberar(&arena);
+    }
+
+    if (sucesso)
+    {
+        if (comparacao->guloso.cobertura_completa && comparacao->exato.cobertura_completa)
+        {
+            comparacao->razao_aproximacao = comparacao->exato.n_solucao > 0
+                                                ? (double)comparacao->guloso.n_solucao / comparacao->exato.n_solucao
+                                                : 1.0;
+        }
+        if (comparacao->tempo_guloso_ms > 0.0)
+        {
+            comparacao->speedup = comparacao->tempo_exato_ms / comparacao->tempo_guloso_ms;
+        }
+    }
+    else
+    {
+        liberar_comparacao(comparacao);
+    }
+
+    return sucesso;
+}
+
+/**
+ * @brief Libera as soluções de uma comparação.
+ *
+ * @param comparacao Comparação preenchida por `comparar_solucionadores`.
+ */
+void liberar_comparacao(ComparacaoCobertura *comparacao)
+{
+    liberar_resultado_cobertura(&comparacao->guloso);
+    liberar_resultado_cobertura(&comparacao->exato);
+}
+
+/**
+ * @brief Cria um cache de soluções vazio.
+ *
+ * A capacidade limita a memória das entradas (chaves e soluções); a
+ * tabela de dispersão cresce à parte, dobrando quando há mais entradas
+ * que baldes.
+ *
+ * @param cache Cache a inicializar.
+ * @param capacidade_bytes Memória máxima das entradas.
+ * @return 1 se o cache foi criado, ou 0 se faltar memória.
+ */
+int cache_criar(CacheCobertura *cache, size_t capacidade_bytes)
+{
+    cache->baldes = (EntradaCache **)calloc(CACHE_BALDES_INICIAIS, sizeof(EntradaCache *));
+    cache->n_baldes = cache->baldes != NULL ? CACHE_BALDES_INICIAIS : 0;
+    cache->n_entradas = 0;
+    cache->mais_recente = NULL;
+    cache->menos_recente = NULL;
+    cache->capacidade_bytes = capacidade_bytes;
+    cache->bytes_em_uso = 0;
+    cache->acertos = 0;
+    cache->falhas = 0;
+    cache->remocoes = 0;
+
+    return cache->baldes != NULL;
+}
+
+/**
+ * @brief Libera todas as entradas e a tabela de um cache.
+ *
+ * @param cache Cache a liberar; pode ser criado de novo com `cache_criar`.
+ */
+void cache_liberar(CacheCobertura *cache)
+{
+    EntradaCache *entrada = cache->mais_recente;
+
+    while (entrada != NULL)
+    {
+        EntradaCache *proxima = entrada->proxima;
+
+        free(entrada->chave.coordenadas);
+        free(entrada->solucao);
+        free(entrada);
+        entrada = proxima;
+    }
+
+    free(cache->baldes);
+    cache->baldes = NULL;
+    cache->n_baldes = 0;
+    cache->n_entradas = 0;
+    cache->mais_recente = NULL;
+    cache->menos_recente = NULL;
+    cache->bytes_em_uso = 0;
+}
+
+/**
+ * @brief Mistura os bits de um valor de 64 bits (finalizador do SplitMix64).
+ *
+ * @param valor Valor a misturar.
+ * @return Valor misturado.
+ */
+uint64_t misturar_hash(uint64_t valor)
+{
+    valor = (valor ^ (valor >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    valor = (valor ^ (valor >> 27)) * 0x94D049BB133111EBULL;
+    return valor ^ (valor >> 31);
+}
+
+/**
+ * @brief Calcula a forma canônica de uma instância e o seu hash.
+ *
+ * Ordena cópias dos pontos e dos intervalos com os mesmos comparadores
+ * usados pelos solucionadores e subtrai de todas as coordenadas a menor
+ * posição de ponto. As coordenadas deslocadas são guardadas em 64 bits,
+ * o que evita transbordamento quando a instância usa toda a faixa de
+ * `int`.
+ *
+ * @param chave Chave a preencher; deve ser devolvida com `cache_liberar_chave`.
+ * @param pontos Pontos da instância (não são alterados).
+ * @param n_pontos Quantidade de pontos.
+ * @param intervalos Intervalos da instância (não são alterados).
+ * @param n_intervalos Quantidade de intervalos.
+ * @return 1 se a chave foi preparada, ou 0 se faltar memória.
+ */
+int cache_preparar_chave(ChaveCache *chave, const Ponto *pontos, int n_pontos, const Intervalo *intervalos, int n_intervalos)
+{
+    size_t n_coordenadas = (size_t)n_pontos + 2 * (size_t)n_intervalos;
+    Ponto *pontos_ordenados = (Ponto *)malloc(((size_t)n_pontos + 1) * sizeof(Ponto));
+    Intervalo *intervalos_ordenados = (Intervalo *)malloc(((size_t)n_intervalos + 1) * sizeof(Intervalo));
+    int resultado = 0;
+
+    chave->n_pontos = n_pontos;
+    chave->n_intervalos = n_intervalos;
+    chave->deslocamento = 0;
+    chave->hash = 0;
+    chave->coordenadas = (int64_t *)malloc((n_coordenadas + 1) * sizeof(int64_t));
+
+    if (pontos_ordenados != NULL && intervalos_ordenados != NULL && chave->coordenadas != NULL)
+    {
+        uint64_t hash = misturar_hash(((uint64_t)(uint32_t)n_pontos << 32) | (uint32_t)n_intervalos);
+        size_t k = 0;
+
+        if (n_pontos > 0)
+        {
+            memcpy(pontos_ordenados, pontos, (size_t)n_pontos * sizeof(Ponto));
+            qsort(pontos_ordenados, n_pontos, sizeof(Ponto), comparar_pontos);
+            chave->deslocamento = pontos_ordenados[0].posicao;
+        }
+        if (n_intervalos > 0)
+        {
+            memcpy(intervalos_ordenados, intervalos, (size_t)n_intervalos * sizeof(Intervalo));
+            qsort(intervalos_ordenados, n_intervalos, sizeof(Intervalo), comparar_intervalos_por_inicio);
+        }
+
+        for (int j = 0; j < n_pontos; j++)
+        {
+            chave->coordenadas[k++] = (int64_t)pontos_ordenados[j].posicao - chave->deslocamento;
+        }
+        for (int i = 0; i < n_intervalos; i++)
+        {
+            chave->coordenadas[k++] = (int64_t)intervalos_ordenados[i].inicio - chave->deslocamento;
+            chave->coordenadas[k++] = (int64_t)intervalos_ordenados[i].fim - chave->deslocamento;
+        }
+        for (k = 0; k < n_coordenadas; k++)
+        {
+            hash = misturar_hash(hash ^ (uint64_t)chave->coordenadas[k]);
+        }
+
+        chave->hash = hash;
+        resultado = 1;
+    }
+    else
+    {
+        free(chave->coordenadas);
+        chave->coordenadas = NULL;
+    }
+
+    free(pontos_ordenados);
+    free(intervalos_ordenados);
+
+    return resultado;
+}
+
+/**
+ * @brief Libera as coordenadas de uma chave que não foi entregue ao cache.
+ *
+ * @param chave Chave preparada por `cache_preparar_chave`.
+ */
+void cache_liberar_chave(ChaveCache *chave)
+{
+    free(chave->coordenadas);
+    chave->coordenadas = NULL;
+}
+
+/**
+ * @brief Procura no cache a entrada de uma chave, comparando as coordenadas.
+ *
+ * @param cache Cache consultado.
+ * @param chave Chave procurada.
+ * @return A entrada da chave, ou NULL se ela não estiver no cache.
+ */
+EntradaCache *procurar_entrada_cache(const CacheCobertura *cache, const ChaveCache *chave)
+{
+    size_t n_coordenadas = (size_t)chave->n_pontos + 2 * (size_t)chave->n_intervalos;
+    EntradaCache *entrada = cache->n_baldes > 0 ? cache->baldes[chave->hash & (uint64_t)(cache->n_baldes - 1)] : NULL;
+
+    while (entrada != NULL &&
+           (entrada->chave.hash != chave->hash || entrada->chave.n_pontos != chave->n_pontos ||
+            entrada->chave.n_intervalos != chave->n_intervalos ||
+            memcmp(entrada->chave.coordenadas, chave->coordenadas, n_coordenadas * sizeof(int64_t)) != 0))
+    {
+        entrada = entrada->proxima_balde;
+    }
+
+    return entrada;
+}
+
+/**
+ * @brief Retira uma entrada da lista LRU, sem liberá-la.
+ *
+ * @param cache Cache da entrada.
+ * @param entrada Entrada a retirar.
+ */
+void desligar_entrada_lru(CacheCobertura *cache, EntradaCache *entrada)
+{
+    if (entrada->anterior != NULL)
+    {
+        entrada->anterior->proxima = entrada->proxima;
+    }
+    else
+    {
+        cache->mais_recente = entrada->proxima;
+    }
+    if (entrada->proxima != NULL)
+    {
+        entrada->proxima->anterior = entrada->anterior;
+    }
+    else
+    {
+        cache->menos_recente = entrada->anterior;
+    }
+    entrada->anterior = NULL;
+    entrada->proxima = NULL;
+}
+
+/**
+ * @brief Coloca uma entrada no início da lista LRU (a usada mais recentemente).
+ *
+ * @param cache Cache da entrada.
+ * @param entrada Entrada fora da lista.
+ */
+void inserir_entrada_lru(CacheCobertura *cache, EntradaCache *entrada)
+{
+    entrada->anterior = NULL;
+    entrada->proxima = cache->mais_recente;
+    if (cache->mais_recente != NULL)
+    {
+        cache->mais_recente->anterior = entrada;
+    }
+    else
+    {
+        cache->menos_recente = entrada;
+    }
+    cache->mais_recente = entrada;
+}
+
+/**
+ * @brief Remove uma entrada do cache e libera sua memória.
+ *
+ * @param cache Cache da entrada.
+ * @param entrada Entrada a remover.
+ */
+void remover_entrada_cache(CacheCobertura *cache, EntradaCache *entrada)
+{
+    EntradaCache **elo = &cache->baldes[entrada->chave.hash & (uint64_t)(cache->n_baldes - 1)];
+
+    while (*elo != entrada)
+    {
+        elo = &(*elo)->proxima_balde;
+    }
+    *elo = entrada->proxima_balde;
+
+    desligar_entrada_lru(cache, entrada);
+    cache->bytes_em_uso -= entrada->bytes;
+    cache->n_entradas--;
+
+    free(entrada->chave.coordenadas);
+    free(entrada->solucao);
+    free(entrada);
+}
+
+/**
+ * @brief Dobra a quantidade de baldes e redistribui as entradas.
+ *
+ * Se faltar memória, a tabela atual é mantida: o cache continua
+ * correto, apenas com listas mais longas por balde.
+ *
+ * @param cache Cache a redimensionar.
+ */
+void crescer_tabela_cache(CacheCobertura *cache)
+{
+    int n_baldes = cache->n_baldes * 2;
+    EntradaCache **baldes = (EntradaCache **)calloc((size_t)n_baldes, sizeof(EntradaCache *));
+
+    if (baldes != NULL)
+    {
+        for (EntradaCache *entrada = cache->mais_recente; entrada != NULL; entrada = entrada->proxima)
+        {
+            EntradaCache **balde = &baldes[entrada->chave.hash & (uint64_t)(n_baldes - 1)];
+
+            entrada->proxima_balde = *balde;
+            *balde = entrada;
+        }
+
+        free(cache->baldes);
+        cache->baldes = baldes;
+        cache->n_baldes = n_baldes;
+    }
+}
+
+/**
+ * @brief Consulta a solução ótima guardada para uma instância.
+ *
+ * Em caso de acerto, a solução é escrita em `solucao` com as
+ * coordenadas da instância consultada (isto é, somando o deslocamento
+ * da sua chave), e a entrada passa a ser a usada mais recentemente.
+ *
+ * @param cache Cache consultado.
+ * @param chave Chave da instância, de `cache_preparar_chave`.
+ * @param solucao Vetor com espaço para `chave->n_intervalos` intervalos.
+ * @param n_solucao Recebe a quantidade de intervalos da solução, ou -1
+ *        se a instância não tem cobertura.
+ * @return 1 se a instância está no cache, ou 0 caso contrário.
+ */
+int cache_consultar(CacheCobertura *cache, const ChaveCache *chave, Intervalo *solucao, int *n_solucao)
+{
+    EntradaCache *entrada = procurar_entrada_cache(cache, chave);
+    int resultado = 0;
+
+    if (entrada != NULL)
+    {
+        for (int i = 0; i < entrada->n_solucao; i++)
+        {
+            solucao[i].inicio = (int)(entrada->solucao[2 * i] + chave->deslocamento);
+            solucao[i].fim = (int)(entrada->solucao[2 * i + 1] + chave->deslocamento);
+        }
+        *n_solucao = entrada->n_solucao;
+
+        desligar_entrada_lru(cache, entrada);
+        inserir_entrada_lru(cache, entrada);
+        cache->acertos++;
+        resultado = 1;
+    }
+    else
+    {
+        cache->falhas++;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Guarda no cache a solução ótima de uma instância.
+ *
+ * Remove as entradas usadas menos recentemente até que a nova caiba na
+ * capacidade. Uma entrada maior que a capacidade inteira não é
+ * guardada, e uma chave que já está no cache não é duplicada.
+ *
+ * Em caso de sucesso, as coordenadas de `chave` passam a pertencer ao
+ * cache e `chave->coordenadas` fica NULL; `cache_liberar_chave`
+ * continua podendo ser chamada.
+ *
+ * @param cache Cache que recebe a solução.
+ * @param chave Chave da instância, de `cache_preparar_chave`.
+ * @param solucao Intervalos da solução, nas coordenadas da instância.
+ * @param n_solucao Quantidade de intervalos da solução, ou -1 se a
+ *        instância não tem cobertura.
+ * @return 1 se a solução foi guardada, ou 0 caso contrário.
+ */
+int cache_registrar(CacheCobertura *cache, ChaveCache *chave, const Intervalo *solucao, int n_solucao)
+{
+    size_t n_pares = n_solucao > 0 ? (size_t)n_solucao : 0;
+    size_t bytes = sizeof(EntradaCache) + ((size_t)chave->n_pontos + 2 * (size_t)chave->n_intervalos) * sizeof(int64_t) +
+                   2 * n_pares * sizeof(int64_t);
+    int resultado = 0;
+
+    if (chave->coordenadas != NULL && cache->n_baldes > 0 && bytes <= cache->capacidade_bytes &&
+        procurar_entrada_cache(cache, chave) == NULL)
+    {
+        EntradaCache *entrada = (EntradaCache *)malloc(sizeof(EntradaCache));
+        int64_t *pares = (int64_t *)malloc((2 * n_pares + 1) * sizeof(int64_t));
+
+        if (entrada != NULL && pares != NULL)
+        {
+            EntradaCache **balde;
+
+            while (cache->bytes_em_uso + bytes > cache->capacidade_bytes)
+            {
+                remover_entrada_cache(cache, cache->menos_recente);
+                cache->remocoes++;
+            }
+
+            for (size_t i = 0; i < n_pares; i++)
+            {
+                pares[2 * i] = (int64_t)solucao[i].inicio - chave->deslocamento;
+                pares[2 * i + 1] = (int64_t)solucao[i].fim - chave->deslocamento;
+            }
+
+            entrada->chave = *chave;
+            entrada->chave.deslocamento = 0;
+            entrada->solucao = pares;
+            entrada->n_solucao = n_solucao;
+            entrada->bytes = bytes;
+            chave->coordenadas = NULL;
+
+            balde = &cache->baldes[entrada->chave.hash & (uint64_t)(cache->n_baldes - 1)];
+            entrada->proxima_balde = *balde;
+            *balde = entrada;
+            inserir_entrada_lru(cache, entrada);
+            cache->n_entradas++;
+            cache->bytes_em_uso += bytes;
+
+            if (cache->n_entradas > cache->n_baldes)
+            {
+                crescer_tabela_cache(cache);
+            }
+            resultado = 1;
+        }
+        else
+        {
+            free(entrada);
+            free(pares);
+        }
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Escreve os contadores de acertos, falhas e remoções de um cache.
+ *
+ * @param cache Cache a resumir.
+ * @param saida Fluxo que recebe a linha.
+ */
+void cache_exibir_estatisticas(const CacheCobertura *cache, FILE *saida)
+{
+    fprintf(saida, "Cache: %" PRId64 " acertos, %" PRId64 " falhas, %" PRId64 " remocoes, %d entradas, %zu de %zu bytes.\n",
+            cache->acertos, cache->falhas, cache->remocoes, cache->n_entradas, cache->bytes_em_uso, cache->capacidade_bytes);
+}
+
+/**
+ * @brief Resolve uma instância consultando antes o cache de soluções.
+ *
+ * Só os solucionadores que devolvem soluções ótimas usam o cache: o
+ * guloso clássico depende da ordem dos pontos e não é ótimo, e vai
+ * direto para `resolver_cobertura`, assim como um solucionador
+ * inválido. Em caso de acerto, o resultado traz a solução guardada,
+ * `do_cache` ligado e, como tempo, o da consulta.
+ * Em caso de falha, a instância é resolvida e a solução é guardada se
+ * for comprovadamente ótima ou se não houver cobertura (exceto no
+ * solucionador limitado, que pode ter esgotado o orçamento).
+ *
+ * @param cache Cache de soluções, ou NULL para resolver sem cache.
+ * @param instancia Instância a resolver.
+ * @param opcoes Solucionador e opções, ou NULL para `opcoes_cobertura_padrao`.
+ * @param resultado Resultado a preencher, como em `resolver_cobertura`.
+ * @return 1 em caso de sucesso, ou 0 se o solucionador for inválido ou
+ *         faltar memória.
+ */
+int resolver_cobertura_com_cache(CacheCobertura *cache, const InstanciaCobertura *instancia, const OpcoesCobertura *opcoes,
+                                 ResultadoCobertura *resultado)
+{
+    OpcoesCobertura padrao;
+    ChaveCache chave;
+    struct timespec inicio, fim;
+    int sucesso = 0;
+
+    if (opcoes == NULL)
+    {
+        opcoes_cobertura_padrao(&padrao);
+        opcoes = &padrao;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+
+    if (cache == NULL || opcoes->solucionador <= SOLUCIONADOR_GULOSO || opcoes->solucionador >= N_SOLUCIONADORES ||
+        cache_preparar_chave(&chave, instancia->pontos, instancia->n_pontos, instancia->intervalos, instancia->n_intervalos) == 0)
+    {
+        sucesso = resolver_cobertura(instancia, opcoes, resultado);
+    }
+    else
+    {
+        int n_solucao = 0;
+
+        memset(resultado, 0, sizeof(*resultado));
+        resultado->solucao = (Intervalo *)malloc(((size_t)instancia->n_intervalos + 1) * sizeof(Intervalo));
+        if (resultado->solucao != NULL && cache_consultar(cache, &chave, resultado->solucao, &n_solucao))
+        {
+            clock_gettime(CLOCK_MONOTONIC, &fim);
+            resultado->n_solucao = n_solucao > 0 ? n_solucao : 0;
+            resultado->cobertura_completa = n_solucao >= 0;
+            resultado->otima = resultado->cobertura_completa;
+            resultado->limite_inferior = resultado->n_solucao;
+            resultado->tempo_ms = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
+            resultado->tempo_busca_ms = resultado->tempo_ms;
+            resultado->do_cache = 1;
+            sucesso = 1;
+        }
+        else
+        {
+            free(resultado->solucao);
+            sucesso = resolver_cobertura(instancia, opcoes, resultado);
+            if (sucesso && (resultado->otima || (resultado->cobertura_completa == 0 && opcoes->solucionador != SOLUCIONADOR_LIMITADO)))
+            {
+                cache_registrar(cache, &chave, resultado->solucao, resultado->cobertura_completa ? resultado->n_solucao : -1);
+            }
+        }
+        cache_liberar_chave(&chave);
+    }
+
+    return sucesso;
+}
+
+/**
+ * @brief Instância do modo em lote, no problema do solucionador escolhido por `ConfiguracaoLote::programa`.
+ */
+typedef union
+{
+    Problema guloso; /**< Problema do guloso (PROGRAMA_GULOSO). */
+    ProblemaBacktracking backtracking; /**< Problema do backtracking (PROGRAMA_BACKTRACKING). */
+} ProblemaLote;
+
+/**
+ * @brief Métricas de uma resolução do modo em lote, no tipo do solucionador escolhido.
+ */
+typedef union
+{
+    Metricas guloso; /**< Métricas do guloso (PROGRAMA_GULOSO). */
+    MetricasBacktracking backtracking; /**< Métricas do backtracking (PROGRAMA_BACKTRACKING). */
+} MetricasLote;
+
+/**
+ * @brief Inicializa o problema do solucionador do lote com a configuração do lote.
+ *
+ * @param lote Configuração do lote.
+ * @param problema Problema a inicializar.
+ */
+void iniciar_problema_lote(const ConfiguracaoLote *lote, ProblemaLote *problema)
+{
+    if (lote->programa == PROGRAMA_GULOSO)
+    {
+        inicializar_problema(&problema->guloso);
+        problema->guloso.configuracao = *(const ConfiguracaoGuloso *)lote->configuracao;
+    }
+    else
+    {
+        inicializar_problema_backtracking(&problema->backtracking);
+        problema->backtracking.configuracao = *(const ConfiguracaoBacktracking *)lote->configuracao;
+    }
+}
+
+/**
+ * @brief Libera o problema do solucionador do lote.
+ *
+ * @param lote Configuração do lote.
+ * @param problema Problema a liberar.
+ */
+void liberar_problema_lote(const ConfiguracaoLote *lote, ProblemaLote *problema)
+{
+    if (lote->programa == PROGRAMA_GULOSO)
+    {
+        liberar_problema(&problema->guloso);
+    }
+    else
+    {
+        liberar_problema_backtracking(&problema->backtracking);
+    }
+}
+
+/**
+ * @brief Resolve uma vez a instância do lote pelo solucionador escolhido.
+ *
+ * O backtracking passa por `resolver_lote_backtracking`, que usa o
+ * cache e a decomposição em componentes quando configurados.
+ *
+ * @param lote Configuração do lote.
+ * @param problema Instância carregada.
+ * @param metricas Métricas da resolução.
+ * @param tempo_preparo Tempo de preparo da resolução, em milissegundos.
+ * @param tempo_busca Tempo de busca da resolução, em milissegundos.
+ */
+void resolver_problema_lote(const ConfiguracaoLote *lote, ProblemaLote *problema, MetricasLote *metricas, double *tempo_preparo,
+                            double *tempo_busca)
+{
+    if (lote->programa == PROGRAMA_GULOSO)
+    {
+        metricas->guloso = resolver_guloso(&problema->guloso);
+        *tempo_preparo = metricas->guloso.tempo_preparo;
+        *tempo_busca = metricas->guloso.tempo_busca;
+    }
+    else
+    {
+        metricas->backtracking = resolver_lote_backtracking(&problema->backtracking, lote->medicao.cache);
+        *tempo_preparo = metricas->backtracking.tempo_preparo;
+        *tempo_busca = metricas->backtracking.tempo_busca;
+    }
+}
+
+/**
+ * @brief Resolve uma instância do lote várias vezes e resume os tempos medidos.
+ *
+ * Guarda uma cópia da instância e a restaura antes de cada execução,
+ * já que a redução (e, no backtracking, a ordenação dos pontos) altera
+ * os vetores. As `aquecimento` primeiras execuções são descartadas; nas
+ * `repeticoes` seguintes, o tempo de preparo e o tempo de busca são
+ * resumidos separadamente.
+ *
+ * @param lote Configuração do lote, com as opções de medição.
+ * @param problema Instância carregada, com a configuração definida.
+ * @param metricas Métricas da última execução.
+ * @param preparo Resumo dos tempos de preparo.
+ * @param busca Resumo dos tempos de busca.
+ * @return 1 se as medições foram feitas, ou 0 se faltar memória.
+ */
+int medir_lote(const ConfiguracaoLote *lote, ProblemaLote *problema, MetricasLote *metricas, EstatisticasTempo *preparo,
+               EstatisticasTempo *busca)
+{
+    const ConfiguracaoMedicao *medicao = &lote->medicao;
+    int guloso = lote->programa == PROGRAMA_GULOSO;
+    Ponto *pontos_problema = guloso ? problema->guloso.pontos : problema->backtracking.pontos;
+    Intervalo *intervalos_problema = guloso ? problema->guloso.intervalos : problema->backtracking.intervalos;
+    int *n_pontos_problema = guloso ? &problema->guloso.n_pontos : &problema->backtracking.n_pontos;
+    int *n_intervalos_problema = guloso ? &problema->guloso.n_intervalos : &problema->backtracking.n_intervalos;
+    int n_pontos = *n_pontos_problema;
+    int n_intervalos = *n_intervalos_problema;
+    int n_execucoes = medicao->aquecimento + medicao->repeticoes;
+    Ponto *pontos = (Ponto *)malloc(((size_t)n_pontos + 1) * sizeof(Ponto));
+    Intervalo *intervalos = (Intervalo *)malloc(((size_t)n_intervalos + 1) * sizeof(Intervalo));
+    double *tempos_preparo = (double *)malloc((size_t)medicao->repeticoes * sizeof(double));
+    double *tempos_busca = (double *)malloc((size_t)medicao->repeticoes * sizeof(double));
+    int resultado = 0;
+
+    if (pontos != NULL && intervalos != NULL && tempos_preparo != NULL && tempos_busca != NULL)
+    {
+        memcpy(pontos, pontos_problema, (size_t)n_pontos * sizeof(Ponto));
+        memcpy(intervalos, intervalos_problema, (size_t)n_intervalos * sizeof(Intervalo));
+
+        for (int k = 0; k < n_execucoes; k++)
+        {
+            double tempo_preparo, tempo_busca;
+
+            if (k > 0)
+            {
+                *n_pontos_problema = n_pontos;
+                *n_intervalos_problema = n_intervalos;
+                memcpy(pontos_problema, pontos, (size_t)n_pontos * sizeof(Ponto));
+                memcpy(intervalos_problema, intervalos, (size_t)n_intervalos * sizeof(Intervalo));
+            }
+
+            resolver_problema_lote(lote, problema, metricas, &tempo_preparo, &tempo_busca);
+            if (k >= medicao->aquecimento)
+            {
+                tempos_preparo[k - medicao->aquecimento] = tempo_preparo;
+                tempos_busca[k - medicao->aquecimento] = tempo_busca;
+            }
+        }
+
+        calcular_estatisticas_tempo(tempos_preparo, medicao->repeticoes, preparo);
+        calcular_estatisticas_tempo(tempos_busca, medicao->repeticoes, busca);
+        resultado = 1;
+    }
+
+    free(pontos);
+    free(intervalos);
+    free(tempos_preparo);
+    free(tempos_busca);
+
+    return resultado;
+}
+
+/**
+ * @brief Resolve uma instância do modo em lote e escreve sua linha de resultado.
+ *
+ * O começo da linha, próprio de cada solucionador, vem de
+ * `escrever_resultado_lote_guloso` ou de
+ * `escrever_resultado_lote_backtracking`; em seguida vêm os contadores
+ * de hardware, se medidos, e, com `medicao.repeticoes` positivo, as
+ * estatísticas dos tempos de preparo e de busca de `medir_lote`. Com
+ * `medicao.resultados`, a execução também é anexada ao repositório,
+ * identificada por `origem:indice`. Com `medicao.edicoes` (guloso), a
+ * instância passa por `registrar_edicoes_lote`, e com
+ * `medicao.guloso_comparado` (backtracking), por
+ * `registrar_comparacao_lote_backtracking`, em vez de ser resolvida.
+ *
+ * @param lote Configuração do lote.
+ * @param problema Instância carregada, com a configuração definida.
+ * @param origem Nome da origem, registrado na primeira coluna.
+ * @param indice Posição da instância na origem, a partir de 1.
+ * @param saida Fluxo que recebe a linha de resultado.
+ */
+void registrar_instancia_lote(const ConfiguracaoLote *lote, ProblemaLote *problema, const char *origem, int indice, FILE *saida)
+{
+    const ConfiguracaoMedicao *medicao = &lote->medicao;
+    int guloso = lote->programa == PROGRAMA_GULOSO;
+    int n_pontos = guloso ? problema->guloso.n_pontos : problema->backtracking.n_pontos;
+    int n_intervalos = guloso ? problema->guloso.n_intervalos : problema->backtracking.n_intervalos;
+    int medir_contadores = guloso ? problema->guloso.configuracao.medir_contadores : problema->backtracking.configuracao.medir_contadores;
+    MetricasLote metricas;
+    EstatisticasTempo preparo, busca;
+    int medido = 0;
+
+    if (guloso && medicao->edicoes != NULL)
+    {
+        registrar_edicoes_lote(&problema->guloso, medicao->edicoes, origem, indice, saida);
+        return;
+    }
+    if (guloso == 0 && medicao->guloso_comparado >= 0)
+    {
+        registrar_comparacao_lote_backtracking(&problema->backtracking, medicao, origem, indice, saida);
+        return;
+    }
+
+    if (medicao->repeticoes > 0)
+    {
+        medido = medir_lote(lote, problema, &metricas, &preparo, &busca);
+        if (medido == 0)
+        {
+            fprintf(stderr, "Erro: memoria insuficiente para medir a instancia %d de %s.\n", indice, origem);
+        }
+    }
+    if (medido == 0)
+    {
+        double tempo_preparo, tempo_busca;
+
+        resolver_problema_lote(lote, problema, &metricas, &tempo_preparo, &tempo_busca);
+    }
+
+    if (guloso)
+    {
+        escrever_resultado_lote_guloso(&problema->guloso, &metricas.guloso, origem, indice, n_pontos, n_intervalos, saida);
+    }
+    else
+    {
+        escrever_resultado_lote_backtracking(&problema->backtracking, &metricas.backtracking, origem, indice, n_pontos, n_intervalos, saida);
+    }
+    if (medir_contadores)
+    {
+        escrever_contadores(saida, guloso ? metricas.guloso.contadores : metricas.backtracking.contadores);
+    }
+    if (medido)
+    {
+        fprintf(saida, ",%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f",
+                busca.amostras, preparo.mediana, busca.minimo, busca.mediana,
+                busca.p95, busca.p99, busca.media, busca.desvio);
+    }
+    else if (medicao->repeticoes > 0)
+    {
+        fprintf(saida, ",0,,,,,,,");
+    }
+    fprintf(saida, "\n");
+
+    if (medicao->resultados != NULL)
+    {
+        RegistroExecucao registro;
+        char instancia[TAMANHO_INSTANCIA_REGISTRO];
+
+        snprintf(instancia, sizeof(instancia), "%s:%d", origem, indice);
+        registro_iniciar(&registro, guloso ? "guloso" : "backtracking", instancia, n_pontos, n_intervalos);
+        if (guloso)
+        {
+            preencher_registro_guloso(&registro, &problema->guloso, &metricas.guloso);
+        }
+        else
+        {
+            preencher_registro_backtracking(&registro, &problema->backtracking.configuracao, &metricas.backtracking);
+        }
+        if (medido)
+        {
+            registro.busca = busca;
+        }
+        if (repositorio_anexar(medicao->resultados, &registro) == 0)
+        {
+            fprintf(stderr, "Erro ao anexar a instancia %d de %s em %s.\n", indice, origem, medicao->resultados->caminho);
+        }
+    }
+}
+
+/**
+ * @brief Resolve em lote todas as instâncias de uma origem.
+ *
+ * Diferente das execuções do menu, não exibe a solução nem as métricas
+ * detalhadas: escreve uma única linha CSV por instância em `saida`,
+ * com `registrar_instancia_lote`.
+ *
+ * @param lote Configuração do lote.
+ * @param caminho Caminho do arquivo, ou "-" para a entrada padrão.
+ * @param saida Fluxo que recebe as linhas de resultado.
+ * @return Quantidade de instâncias resolvidas, ou -1 se a origem não pôde ser aberta ou contém uma instância inválida.
+ */
+int resolver_lote_origem(const ConfiguracaoLote *lote, const char *caminho, FILE *saida)
+{
+    LeitorInstancia leitor;
+    int n_instancias = 0;
+    int lida = 1;
+
+    if (leitor_abrir(&leitor, caminho) == 0)
+    {
+        fprintf(stderr, "Erro ao abrir %s.\n", caminho);
+        return -1;
+    }
+
+    while (lida == 1)
+    {
+        ProblemaLote problema;
+
+        iniciar_problema_lote(lote, &problema);
+        lida = lote->programa == PROGRAMA_GULOSO ? ler_instancia(&leitor, &problema.guloso)
+                                                 : ler_instancia_backtracking(&leitor, &problema.backtracking);
+        if (lida == 1)
+        {
+            n_instancias++;
+            registrar_instancia_lote(lote, &problema, caminho, n_instancias, saida);
+        }
+        else if (lida == -1)
+        {
+            fprintf(stderr, "Erro: instancia %d invalida em %s.\n", n_instancias + 1, caminho);
+        }
+        liberar_problema_lote(lote, &problema);
+    }
+
+    leitor_fechar(&leitor);
+
+    return lida == -1 ? -1 : n_instancias;
+}
+
+/**
+ * @brief Resolve em lote uma instância sintética descrita por uma especificação.
+ *
+ * A especificação tem o formato `distribuicao:n_pontos:n_intervalos:semente`
+ * (por exemplo, `uniforme:100000:150000:42`) e é usada como nome da origem.
+ *
+ * @param lote Configuração do lote.
+ * @param especificacao Especificação da instância a gerar.
+ * @param saida Fluxo que recebe a linha de resultado.
+ * @return 1 se a instância foi gerada e resolvida, ou -1 se a especificação for inválida.
+ */
+int resolver_lote_gerado(const ConfiguracaoLote *lote, const char *especificacao, FILE *saida)
+{
+    ProblemaLote problema;
+    char nome[32];
+    int n_pontos = 0, n_intervalos = 0;
+    unsigned long long semente = 0;
+    int distribuicao = -1;
+    int consumidos = 0;
+    int gerada = 0;
+    int resultado = -1;
+
+    if (sscanf(especificacao, "%31[^:]:%d:%d:%llu%n", nome, &n_pontos, &n_intervalos, &semente, &consumidos) == 4 &&
+        especificacao[consumidos] == '\0')
+    {
+        distribuicao = distribuicao_por_nome(nome);
+    }
+
+    iniciar_problema_lote(lote, &problema);
+    if (distribuicao >= 0)
+    {
+        gerada = lote->programa == PROGRAMA_GULOSO
+                     ? gerar_instancia(&problema.guloso, n_pontos, n_intervalos, distribuicao, (uint64_t)semente)
+                     : gerar_instancia_backtracking(&problema.backtracking, n_pontos, n_intervalos, distribuicao, (uint64_t)semente);
+    }
+    if (gerada)
+    {
+        registrar_instancia_lote(lote, &problema, especificacao, 1, saida);
+        resultado = 1;
+    }
+    else
+    {
+        fprintf(stderr, "Erro: instancia gerada invalida: %s.\n", especificacao);
+    }
+    liberar_problema_lote(lote, &problema);
+
+    return resultado;
+}
+
+/**
+ * @brief Resolve em lote as origens listadas em um manifesto.
+ *
+ * O manifesto é um arquivo de texto com um caminho de origem por linha.
+ * Linhas vazias e linhas iniciadas por `#` são ignoradas. Os caminhos
+ * são relativos ao diretório de trabalho atual.
+ *
+ * @param lote Configuração do lote.
+ * @param caminho Caminho do manifesto.
+ * @param saida Fluxo que recebe as linhas de resultado.
+ * @return Quantidade total de instâncias resolvidas, ou -1 se alguma origem falhou.
+ */
+int resolver_lote_manifesto(const ConfiguracaoLote *lote, const char *caminho, FILE *saida)
+{
+    FILE *manifesto = fopen(caminho, "r");
+    char linha[TAMANHO_LINHA_MANIFESTO];
+    int n_instancias = 0;
+    int falhou = 0;
+
+    if (manifesto == NULL)
+    {
+        fprintf(stderr, "Erro ao abrir o manifesto %s.\n", caminho);
+        return -1;
+    }
+
+    while (fgets(linha, sizeof(linha), manifesto) != NULL)
+    {
+        size_t tamanho = strcspn(linha, "\r\n");
+        int resolvidas;
+
+        linha[tamanho] = '\0';
+        if (tamanho == 0 || linha[0] == '#')
+        {
+            continue;
+        }
+
+        resolvidas = resolver_lote_origem(lote, linha, saida);
+        if (resolvidas < 0)
+        {
+            falhou = 1;
+        }
+        else
+        {
+            n_instancias += resolvidas;
+        }
+    }
+
+    fclose(manifesto);
+
+    return falhou ? -1 : n_instancias;
+}
+
+/**
+ * @brief Escreve o cabeçalho CSV das linhas de resultado do lote.
+ *
+ * As colunas seguem `registrar_instancia_lote`: as do solucionador,
+ * as dos contadores de hardware e as das estatísticas de tempo. As
+ * edições do guloso e a comparação do backtracking têm cabeçalhos
+ * próprios.
+ *
+ * @param lote Configuração do lote.
+ * @param saida Fluxo que recebe o cabeçalho.
+ */
+void escrever_cabecalho_lote(const ConfiguracaoLote *lote, FILE *saida)
+{
+    int guloso = lote->programa == PROGRAMA_GULOSO;
+    int medir_contadores = guloso ? ((const ConfiguracaoGuloso *)lote->configuracao)->medir_contadores
+                                  : ((const ConfiguracaoBacktracking *)lote->configuracao)->medir_contadores;
+
+    if (guloso && lote->medicao.edicoes != NULL)
+    {
+        fprintf(saida, "origem,instancia,edicao,operacao,n_pontos,n_intervalos,tempo_ms,n_intervalos_solucao,n_descobertos,passos_refeitos,"
+                       "passos_removidos\n");
+    }
+    else if (guloso == 0 && lote->medicao.guloso_comparado >= 0)
+    {
+        fprintf(saida, "origem,instancia,n_pontos,n_intervalos,guloso,exato,preparo_compartilhado_ms,tempo_guloso_ms,tempo_exato_ms,speedup,"
+                       "n_solucao_guloso,n_solucao_exato,otima,limite_inferior,razao_aproximacao,pico_memoria_guloso_bytes,"
+                       "pico_memoria_exato_bytes\n");
+    }
+    else
+    {
+        if (guloso)
+        {
+            fprintf(saida, "origem,instancia,n_pontos,n_intervalos,motor,tempo_ms,n_intervalos_solucao,qualidade,cobertura_completa,"
+                           "pico_memoria_bytes,n_alocacoes");
+        }
+        else
+        {
+            fprintf(saida, "origem,instancia,n_pontos,n_intervalos,motor,tempo_ms,n_intervalos_solucao,nos_visitados,limite_inferior,gap,"
+                           "concluida,pico_memoria_bytes,n_alocacoes,profundidade_maxima");
+        }
+        if (medir_contadores)
+        {
+            fprintf(saida, ",ciclos,instrucoes,ipc,falhas_cache,falhas_desvio");
+        }
+        if (lote->medicao.repeticoes > 0)
+        {
+            fprintf(saida, ",repeticoes,preparo_mediana_ms,busca_min_ms,busca_mediana_ms,busca_p95_ms,busca_p99_ms,busca_media_ms,busca_desvio_ms");
+        }
+        fprintf(saida, "\n");
+    }
+}
+
+/**
+ * @brief Executa o modo em lote descrito por uma configuração já lida da linha de comando.
+ *
+ * Abre o repositório de resultados e o arquivo de saída, fixa a CPU e
+ * cria o cache, se pedidos, e resolve cada origem na ordem de
+ * `lote->origens`. Todas as linhas de resultado são escritas no mesmo
+ * fluxo, precedidas por um único cabeçalho CSV, e as mensagens de erro
+ * vão para a saída de erro para não misturar com os resultados. Ao
+ * final, as estatísticas do cache vão para a saída de erro.
+ *
+ * @param lote Configuração do lote; `medicao.resultados` e `medicao.cache` são preenchidos aqui.
+ * @return 0 se todas as origens foram resolvidas, 1 caso contrário.
+ */
+int executar_lote(ConfiguracaoLote *lote)
+{
+    const char *programa = lote->programa == PROGRAMA_GULOSO ? "guloso" : "backtracking";
+    int medir_contadores = lote->programa == PROGRAMA_GULOSO ? ((const ConfiguracaoGuloso *)lote->configuracao)->medir_contadores
+                                                             : ((const ConfiguracaoBacktracking *)lote->configuracao)->medir_contadores;
+    RepositorioResultados repositorio;
+    CacheCobertura cache;
+    FILE *saida = stdout;
+    int falhou = 0;
+
+    lote->medicao.resultados = NULL;
+    lote->medicao.cache = NULL;
+
+    if (lote->registrar)
+    {
+        if (repositorio_abrir(&repositorio, lote->caminho_registro, lote->formato_registro, programa) == 0)
+        {
+            fprintf(stderr, "Erro ao preparar o repositorio de resultados em %s.\n", repositorio.caminho);
+            return 1;
+        }
+        lote->medicao.resultados = &repositorio;
+    }
+
+    if (lote->caminho_saida != NULL)
+    {
+        saida = fopen(lote->caminho_saida, "w");
+        if (saida == NULL)
+        {
+            fprintf(stderr, "Erro ao abrir %s para escrita.\n", lote->caminho_saida);
+            return 1;
+        }
+    }
+
+    if (lote->medicao.cpu >= 0 && fixar_cpu(lote->medicao.cpu) == 0)
+    {
+        fprintf(stderr, "Aviso: nao foi possivel fixar o processo na CPU %d.\n", lote->medicao.cpu);
+    }
+
+    if (lote->megabytes_cache > 0)
+    {
+        if (cache_criar(&cache, (size_t)lote->megabytes_cache << 20))
+        {
+            lote->medicao.cache = &cache;
+        }
+        else
+        {
+            fprintf(stderr, "Aviso: memoria insuficiente para o cache; as instancias serao resolvidas sem ele.\n");
+        }
+    }
+
+    if (medir_contadores)
+    {
+        ContadoresHardware contadores;
+
+        if (contadores_abrir(&contadores) < N_CONTADORES_HARDWARE)
+        {
+            fprintf(stderr, "Aviso: contadores de hardware indisponiveis ficam em branco (veja /proc/sys/kernel/perf_event_paranoid).\n");
+        }
+        contadores_fechar(&contadores);
+    }
+
+    escrever_cabecalho_lote(lote, saida);
+
+    for (int i = 0; i < lote->n_origens; i++)
+    {
+        const OrigemLote *origem = &lote->origens[i];
+
+        if (origem->tipo == ORIGEM_LOTE_ENTRADA)
+        {
+            falhou |= resolver_lote_origem(lote, origem->valor, saida) < 0;
+        }
+        else if (origem->tipo == ORIGEM_LOTE_MANIFESTO)
+        {
+            falhou |= resolver_lote_manifesto(lote, origem->valor, saida) < 0;
+        }
+        else
+        {
+            falhou |= resolver_lote_gerado(lote, origem->valor, saida) < 0;
+        }
+    }
+
+    if (saida != stdout)
+    {
+        fclose(saida);
+    }
+    else
+    {
+        fflush(saida);
+    }
+
+    if (lote->medicao.cache != NULL)
+    {
+        cache_exibir_estatisticas(lote->medicao.cache, stderr);
+        cache_liberar(lote->medicao.cache);
+        lote->medicao.cache = NULL;
+    }
+    lote->medicao.resultados = NULL;
+
+    return falhou;
+}
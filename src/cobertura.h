@@ -0,0 +1,861 @@
+#ifndef COBERTURA_H
+#define COBERTURA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+/**
+ * Em x86 com GCC ou Clang, núcleos com AVX2 são escolhidos em tempo de
+ * execução, com `__builtin_cpu_supports`, mesmo quando o programa não
+ * é compilado com `-mavx2` ou `-march=native`.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define DESPACHO_AVX2
+#endif
+
+#if defined(__AVX2__) || defined(__AVX512F__) || defined(DESPACHO_AVX2)
+#include <immintrin.h>
+#endif
+
+#define TAMANHO_BUFFER_LEITOR (1 << 20)
+#define ASSINATURA_INSTANCIA_BINARIA "CPI1"
+#define ASSINATURA_INSTANCIA_BINARIA_64 "CPI2"
+
+#define FORMATO_INSTANCIA_TEXTO 0
+#define FORMATO_INSTANCIA_BINARIO 1
+#define FORMATO_INSTANCIA_BINARIO_64 2
+
+/** Maior quantidade de pontos, ou de intervalos, aceita no cabeçalho de uma instância. */
+#define MAX_ELEMENTOS_INSTANCIA 100000000
+
+#define BITS_DIGITO_COMPRESSAO 16
+
+#define ALINHAMENTO_ARENA 64
+#define ALINHAR_ARENA(tamanho) (((tamanho) + (ALINHAMENTO_ARENA - 1)) & ~(size_t)(ALINHAMENTO_ARENA - 1))
+
+#define DISTRIBUICAO_UNIFORME 0
+#define DISTRIBUICAO_AGRUPADA 1
+#define DISTRIBUICAO_SOBREPOSTA 2
+#define DISTRIBUICAO_ANINHADA 3
+#define DISTRIBUICAO_ADVERSARIA 4
+#define N_DISTRIBUICOES 5
+
+#define CONTADOR_CICLOS 0
+#define CONTADOR_INSTRUCOES 1
+#define CONTADOR_FALHAS_CACHE 2
+#define CONTADOR_FALHAS_DESVIO 3
+#define N_CONTADORES_HARDWARE 4
+
+#define CENARIO_PEQUENO 0
+#define CENARIO_MEDIO 1
+#define CENARIO_GRANDE 2
+#define N_CENARIOS 3
+
+#define SOLUCIONADOR_GULOSO 0
+#define SOLUCIONADOR_VARREDURA 1
+#define SOLUCIONADOR_BACKTRACKING 2
+#define SOLUCIONADOR_PODA 3
+#define SOLUCIONADOR_PARALELO 4
+#define SOLUCIONADOR_ITERATIVO 5
+#define SOLUCIONADOR_LIMITADO 6
+#define SOLUCIONADOR_DINAMICA 7
+#define N_SOLUCIONADORES 8
+
+#define CACHE_BALDES_INICIAIS 64
+
+#define PROGRAMA_GULOSO 0
+#define PROGRAMA_BACKTRACKING 1
+
+#define ORIGEM_LOTE_ENTRADA 0
+#define ORIGEM_LOTE_MANIFESTO 1
+#define ORIGEM_LOTE_GERADA 2
+#define TAMANHO_LINHA_MANIFESTO 1024
+
+#define FORMATO_REGISTRO_CSV 0
+#define FORMATO_REGISTRO_BINARIO 1
+#define ASSINATURA_REGISTRO_BINARIO "CPR1"
+#define TAMANHO_REGISTRO_BINARIO 228
+#define TAMANHO_CAMINHO_RESULTADOS 1024
+#define TAMANHO_INSTANCIA_REGISTRO 64
+#define TAMANHO_NOME_REGISTRO 16
+#define VARIAVEL_PASTA_RESULTADOS "COBERTURA_RESULTADOS"
+#define VARIAVEL_REVISAO "COBERTURA_REVISAO"
+
+/* Revisão registrada nos resultados, fixada na compilação com -DREVISAO=\"<commit>\". */
+#ifndef REVISAO
+#define REVISAO "desconhecida"
+#endif
+
+/**
+ * @struct Intervalo
+ * @brief Representa um intervalo fechado na reta numérica.
+ *
+ * Esta estrutura é utilizada pelos dois solucionadores para modelar
+ * intervalos que podem cobrir pontos em uma dimensão linear.
+ * Um ponto é considerado coberto se sua posição estiver entre
+ * o início e o fim do intervalo (inclusive).
+ *
+ * No problema da cobertura de pontos, o objetivo é selecionar
+ * um subconjunto mínimo desses intervalos capaz de cobrir
+ * todos os pontos definidos.
+ */
+typedef struct
+{
+    int inicio; /**< Limite inicial do intervalo (inclusive). */
+    int fim; /**< Limite final do intervalo (inclusive). */
+} Intervalo;
+
+/**
+ * @struct Ponto
+ * @brief Representa um ponto na reta numérica a ser coberto por intervalos.
+ *
+ * Cada ponto possui um identificador único e uma posição inteira
+ * na reta numérica. No problema da cobertura de pontos, um ponto
+ * é considerado coberto se existir ao menos um intervalo cujo
+ * início e fim englobem sua posição.
+ *
+ * Essa estrutura é utilizada pelos dois solucionadores para verificar
+ * a cobertura dos pontos durante a escolha dos intervalos.
+ */
+typedef struct
+{
+    int id; /**< Identificador único do ponto. */
+    int posicao; /**< Posição do ponto na reta numérica. */
+} Ponto;
+
+/**
+ * @struct CompressaoCoordenadas
+ * @brief Tabela que devolve as coordenadas originais de uma instância comprimida.
+ *
+ * Instâncias com coordenadas fora do intervalo de `int` (por exemplo,
+ * marcas de tempo de 64 bits) são lidas com as posições e os extremos
+ * substituídos por postos densos: o posto de um valor é a quantidade
+ * de valores distintos menores que ele. A ordem entre pontos e
+ * extremos é preservada, então a cobertura e a solução ótima não
+ * mudam, e os laços dos solucionadores continuam em inteiros de 32
+ * bits. `valores[posto]` guarda a coordenada original de cada posto.
+ */
+typedef struct
+{
+    int64_t *valores; /**< Coordenadas originais distintas, em ordem crescente, ou NULL se a instância não foi comprimida. */
+    int n_valores; /**< Quantidade de valores distintos em `valores`. */
+} CompressaoCoordenadas;
+
+/**
+ * @struct ContabilidadeMemoria
+ * @brief Contabilidade da memória usada por uma resolução.
+ *
+ * Soma os blocos entregues pela arena do problema, o que dispensa
+ * ferramentas externas como o valgrind para medir cada resolução.
+ */
+typedef struct
+{
+    size_t bytes_em_uso; /**< Bytes alocados e ainda não devolvidos. */
+    size_t pico_bytes; /**< Maior valor de `bytes_em_uso` desde o início da resolução. */
+    int64_t n_alocacoes; /**< Quantidade de alocações desde o início da resolução. */
+} ContabilidadeMemoria;
+
+/**
+ * @struct Arena
+ * @brief Região de memória contígua de onde são alocados os dados de uma instância.
+ *
+ * O bloco é reservado uma única vez e as alocações apenas avançam
+ * `usado`, sempre alinhadas a `ALINHAMENTO_ARENA` bytes. Não há
+ * liberação individual: um marcador devolve de uma vez tudo o que foi
+ * alocado depois dele, e `arena_liberar` devolve o bloco inteiro.
+ */
+typedef struct
+{
+    unsigned char *base; /**< Início do bloco reservado. */
+    size_t capacidade; /**< Tamanho do bloco, em bytes. */
+    size_t usado; /**< Bytes já alocados a partir de `base`. */
+    ContabilidadeMemoria *contabilidade; /**< Contabilidade que registra os blocos entregues, ou NULL. */
+} Arena;
+
+/**
+ * @struct LeitorInstancia
+ * @brief Origem de instâncias: arquivo mapeado em memória ou fluxo lido em blocos.
+ *
+ * Os bytes disponíveis ficam em `dados[inicio, fim)`. Com um arquivo
+ * mapeado, `dados` aponta para o mapeamento inteiro; com a entrada
+ * padrão ou um pipe, aponta para `buffer`, recarregado conforme a
+ * leitura avança.
+ */
+typedef struct
+{
+    int descritor; /**< Descritor da origem, ou -1 depois de fechada. */
+    const unsigned char *dados; /**< Bytes disponíveis para leitura. */
+    size_t inicio; /**< Próximo byte a consumir em `dados`. */
+    size_t fim; /**< Uma posição após o último byte disponível em `dados`. */
+    unsigned char *buffer; /**< Buffer de leitura em blocos (NULL quando mapeado). */
+    size_t tamanho_mapa; /**< Tamanho do mapeamento (0 quando lido em blocos). */
+    int esgotado; /**< 1 quando não há mais bytes a ler da origem. */
+} LeitorInstancia;
+
+/**
+ * @struct RepositorioResultados
+ * @brief Arquivo onde as execuções são acumuladas, uma linha (ou registro) por execução.
+ *
+ * O arquivo só cresce: cada execução é anexada ao final com uma única
+ * escrita em modo `O_APPEND`, então vários processos podem registrar
+ * no mesmo repositório sem que as linhas se misturem. O cabeçalho (ou
+ * a assinatura do formato binário) é escrito apenas quando o arquivo
+ * está vazio.
+ */
+typedef struct
+{
+    char caminho[TAMANHO_CAMINHO_RESULTADOS]; /**< Arquivo do repositório. */
+    int formato; /**< FORMATO_REGISTRO_CSV ou FORMATO_REGISTRO_BINARIO. */
+    char revisao[TAMANHO_NOME_REGISTRO]; /**< Revisão do código registrada em cada execução. */
+} RepositorioResultados;
+
+typedef struct CacheCobertura CacheCobertura;
+
+/**
+ * @struct ConfiguracaoMedicao
+ * @brief Opções de medição do modo em lote.
+ *
+ * Com `repeticoes` positivo, cada instância é resolvida `aquecimento`
+ * vezes sem registro e depois `repeticoes` vezes medidas, sempre a
+ * partir de uma cópia intacta da instância, e a linha de resultado
+ * ganha as estatísticas dos tempos de preparo e de busca. Com
+ * `resultados`, cada instância também é anexada ao repositório. Com
+ * `guloso_comparado`, cada instância é resolvida pelo guloso e pelo
+ * motor exato, e a linha passa a ser a da comparação. Com `cache`, as
+ * resoluções fora da comparação passam por `resolver_cobertura_com_cache`.
+ * Com `edicoes`, cada instância é carregada na cobertura incremental e
+ * recebe as edições do roteiro, com uma linha por edição.
+ */
+typedef struct
+{
+    int repeticoes; /**< Execuções medidas por instância, ou 0 para uma única execução sem estatísticas. */
+    int aquecimento; /**< Execuções descartadas antes das medidas. */
+    int cpu; /**< CPU à qual o processo é fixado, ou -1 para não fixar. */
+    const RepositorioResultados *resultados; /**< Repositório que recebe cada execução, ou NULL. */
+    int guloso_comparado; /**< Guloso (SOLUCIONADOR_GULOSO ou SOLUCIONADOR_VARREDURA) comparado ao motor exato, ou -1. */
+    CacheCobertura *cache; /**< Cache de soluções consultado antes de cada resolução exata, ou NULL. */
+    const char *edicoes; /**< Roteiro de edições aplicado a cada instância pelo guloso, ou NULL. */
+} ConfiguracaoMedicao;
+
+/**
+ * @struct OrigemLote
+ * @brief Uma origem de instâncias do modo em lote, na ordem da linha de comando.
+ */
+typedef struct
+{
+    int tipo; /**< ORIGEM_LOTE_ENTRADA, ORIGEM_LOTE_MANIFESTO ou ORIGEM_LOTE_GERADA. */
+    const char *valor; /**< Caminho do arquivo ou do manifesto, ou a especificação `d:n:m:semente`. */
+} OrigemLote;
+
+/**
+ * @struct ConfiguracaoLote
+ * @brief Tudo o que `executar_lote` precisa, já extraído da linha de comando pelo programa.
+ *
+ * `programa` escolhe o solucionador das instâncias, e `configuracao`
+ * aponta para a configuração dele (`ConfiguracaoGuloso` ou
+ * `ConfiguracaoBacktracking`), copiada para cada instância. O
+ * repositório e o cache de `medicao` são abertos por `executar_lote` a
+ * partir de `registrar` e `megabytes_cache`.
+ */
+typedef struct
+{
+    int programa; /**< PROGRAMA_GULOSO ou PROGRAMA_BACKTRACKING. */
+    const void *configuracao; /**< Configuração do solucionador de `programa`. */
+    ConfiguracaoMedicao medicao; /**< Opções de medição do lote. */
+    const char *caminho_saida; /**< Arquivo dos resultados, ou NULL para a saída padrão. */
+    int registrar; /**< 1 para anexar cada execução ao repositório de resultados. */
+    const char *caminho_registro; /**< Arquivo do repositório, ou NULL para o padrão do programa. */
+    int formato_registro; /**< FORMATO_REGISTRO_CSV ou FORMATO_REGISTRO_BINARIO. */
+    long megabytes_cache; /**< Capacidade do cache de soluções em MB, ou 0 sem cache. */
+    const OrigemLote *origens; /**< Origens, na ordem em que são resolvidas. */
+    int n_origens; /**< Quantidade de origens. */
+} ConfiguracaoLote;
+
+/**
+ * @struct EstatisticasTempo
+ * @brief Resumo estatístico de uma série de tempos, em milissegundos.
+ *
+ * Os percentis usam o critério do posto mais próximo, e o desvio padrão
+ * é o amostral (zero com uma única amostra).
+ */
+typedef struct
+{
+    int amostras; /**< Quantidade de tempos resumidos. */
+    double minimo; /**< Menor tempo. */
+    double mediana; /**< Percentil 50. */
+    double p95; /**< Percentil 95. */
+    double p99; /**< Percentil 99. */
+    double media; /**< Média aritmética. */
+    double desvio; /**< Desvio padrão amostral. */
+} EstatisticasTempo;
+
+/**
+ * @struct RegistroExecucao
+ * @brief Uma execução de um solucionador sobre uma instância, como é anexada ao repositório.
+ *
+ * `tempo` é o tempo total da última execução e `busca` resume os
+ * tempos de busca das execuções medidas (uma única amostra sem
+ * `--repeticoes`).
+ * `n_solucao` vale -1 quando a instância não tem cobertura possível, e
+ * `nos_visitados` é 0 nos motores gulosos.
+ */
+typedef struct
+{
+    char instancia[TAMANHO_INSTANCIA_REGISTRO]; /**< Identificador da instância (origem:índice ou cenário). */
+    char programa[TAMANHO_NOME_REGISTRO]; /**< "guloso" ou "backtracking". */
+    char motor[TAMANHO_NOME_REGISTRO]; /**< Nome do motor usado. */
+    int n_pontos; /**< Pontos da instância. */
+    int n_intervalos; /**< Intervalos da instância. */
+    int threads; /**< Threads usadas pela resolução. */
+    int n_solucao; /**< Intervalos da solução, ou -1 sem cobertura possível. */
+    double tempo; /**< Tempo total da última execução, em milissegundos. */
+    EstatisticasTempo busca; /**< Tempos de busca das execuções medidas, em milissegundos. */
+    size_t pico_memoria; /**< Pico de bytes em uso durante a resolução. */
+    int64_t n_alocacoes; /**< Alocações feitas durante a resolução. */
+    long memoria_kb; /**< `ru_maxrss` do processo ao final da resolução. */
+    int64_t nos_visitados; /**< Nós visitados na árvore de busca. */
+} RegistroExecucao;
+
+/**
+ * @struct ContadoresHardware
+ * @brief Contadores de hardware lidos em torno da busca.
+ *
+ * Cada contador é um descritor `perf_event` do Linux, restrito ao
+ * espaço de usuário e herdado pelas threads criadas enquanto ele está
+ * aberto. Contadores que o processador ou o kernel não oferecem ficam
+ * com descritor -1 e valor -1.
+ */
+typedef struct
+{
+    int descritores[N_CONTADORES_HARDWARE]; /**< Descritores abertos, indexados por CONTADOR_*, ou -1. */
+    long long valores[N_CONTADORES_HARDWARE]; /**< Contagens da última medição, ou -1 se indisponíveis. */
+} ContadoresHardware;
+
+/**
+ * @struct GeradorAleatorio
+ * @brief Estado do gerador pseudoaleatório das instâncias sintéticas.
+ *
+ * Implementa o SplitMix64: a sequência depende apenas da semente, de modo
+ * que a mesma semente reproduz a mesma instância em qualquer plataforma
+ * e nas duas implementações (gulosa e backtracking).
+ */
+typedef struct
+{
+    uint64_t estado; /**< Estado interno, avançado a cada número sorteado. */
+} GeradorAleatorio;
+
+/**
+ * @struct Reducao
+ * @brief Resumo da redução aplicada à instância antes da resolução.
+ *
+ * Registra quantos pontos e intervalos foram descartados por serem
+ * comprovadamente redundantes, sem alterar o tamanho da solução ótima.
+ */
+typedef struct
+{
+    int aplicada; /**< 1 se a redução foi executada, 0 caso contrário. */
+    int pontos_duplicados; /**< Pontos removidos por repetirem a posição de outro ponto. */
+    int pontos_dominados; /**< Pontos removidos porque cobrir outro ponto já garante sua cobertura. */
+    int intervalos_dominados; /**< Intervalos removidos por não cobrirem pontos ou estarem contidos em outro. */
+} Reducao;
+
+/**
+ * @struct FaixaReducao
+ * @brief Faixa de pontos cobertos por um intervalo, usada na redução.
+ *
+ * Com os pontos ordenados por posição, os pontos cobertos por um
+ * intervalo formam uma faixa contígua de índices `[primeiro, ultimo]`.
+ */
+typedef struct
+{
+    int primeiro; /**< Índice do primeiro ponto coberto pelo intervalo. */
+    int ultimo; /**< Índice do último ponto coberto pelo intervalo. */
+    int indice; /**< Índice do intervalo no vetor original. */
+} FaixaReducao;
+
+/**
+ * @struct CenarioCobertura
+ * @brief Um dos cenários fixos (pequeno, médio e grande) dos programas.
+ */
+typedef struct
+{
+    const char *nome; /**< Nome do cenário, em minúsculas, como registrado nos CSV. */
+    int n_pontos; /**< Quantidade de pontos. */
+    int n_intervalos; /**< Quantidade de intervalos. */
+    const Ponto *pontos; /**< Pontos do cenário. */
+    const Intervalo *intervalos; /**< Intervalos do cenário, na ordem em que são definidos. */
+} CenarioCobertura;
+
+/**
+ * @struct InstanciaCobertura
+ * @brief Instância do problema entregue a `resolver_cobertura`.
+ *
+ * Os vetores pertencem a quem chama e não são alterados: cada
+ * solucionador trabalha sobre uma cópia.
+ *
+ * As coordenadas são `int` de 32 bits. Uma instância com coordenadas
+ * de 64 bits chega aqui já em postos, calculados por
+ * `comprimir_coordenadas` (como faz `ler_valores_instancia`), e os
+ * extremos da solução voltam às coordenadas originais com
+ * `coordenada_original`.
+ */
+typedef struct
+{
+    const Ponto *pontos; /**< Pontos que devem ser cobertos. */
+    int n_pontos; /**< Quantidade de pontos. */
+    const Intervalo *intervalos; /**< Intervalos disponíveis. */
+    int n_intervalos; /**< Quantidade de intervalos. */
+} InstanciaCobertura;
+
+/**
+ * @struct OpcoesCobertura
+ * @brief Escolha do solucionador e suas opções, para `resolver_cobertura`.
+ *
+ * `opcoes_cobertura_padrao` preenche os mesmos valores padrão dos
+ * programas; as opções que não se aplicam ao solucionador escolhido
+ * são ignoradas.
+ */
+typedef struct
+{
+    int solucionador; /**< Solucionador (SOLUCIONADOR_*). */
+    int usar_bitset; /**< 1 para representar a cobertura em bitsets de 64 bits. */
+    int aplicar_reducao; /**< 1 para remover pontos e intervalos redundantes antes da resolução. */
+    int n_threads; /**< Threads do solucionador paralelo. */
+    int profundidade_divisao; /**< Profundidade em que o solucionador paralelo divide a árvore em tarefas. */
+    double limite_tempo_ms; /**< Orçamento de tempo do solucionador limitado (em ms), ou 0 para não limitar. */
+    int64_t limite_nos; /**< Orçamento de nós do solucionador limitado, ou 0 para não limitar. */
+    int decompor; /**< 1 para resolver em paralelo, com `n_threads` threads, os componentes independentes da reta. */
+} OpcoesCobertura;
+
+/**
+ * @struct ResultadoCobertura
+ * @brief Solução e métricas devolvidas por `resolver_cobertura`.
+ *
+ * Reúne as métricas dos dois solucionadores; as que não se aplicam ao
+ * solucionador usado ficam zeradas. A solução é alocada para quem
+ * chama e devolvida por `liberar_resultado_cobertura`.
+ */
+typedef struct
+{
+    Intervalo *solucao; /**< Intervalos escolhidos, ou NULL se não houver solução. */
+    int n_solucao; /**< Quantidade de intervalos escolhidos. */
+    int cobertura_completa; /**< 1 se a solução cobre todos os pontos. */
+    int otima; /**< 1 se a solução é comprovadamente de tamanho mínimo. */
+    double tempo_ms; /**< Tempo total da resolução, em milissegundos. */
+    double tempo_preparo_ms; /**< Parte do tempo gasta em redução, ordenação e alocação. */
+    double tempo_busca_ms; /**< Parte do tempo gasta na escolha ou na busca. */
+    int64_t nos_visitados; /**< Nós visitados (ou estados calculados) pelos solucionadores exatos. */
+    int limite_inferior; /**< Limitante inferior do tamanho ótimo (solucionador limitado). */
+    double gap; /**< Gap de otimalidade (solucionador limitado). */
+    size_t pico_memoria; /**< Pico de bytes em uso durante a resolução, incluindo a instância. */
+    int64_t n_alocacoes; /**< Quantidade de alocações feitas durante a resolução. */
+    int profundidade_maxima; /**< Maior profundidade de recursão ou de pilha da busca. */
+    int do_cache; /**< 1 se a solução veio do cache de `resolver_cobertura_com_cache`. */
+    int n_componentes; /**< Componentes independentes resolvidos separadamente (com `decompor`), ou 0. */
+} ResultadoCobertura;
+
+/**
+ * @struct ComparacaoCobertura
+ * @brief Um solucionador guloso e um exato executados sobre a mesma instância.
+ *
+ * Preenchida por `comparar_solucionadores`. Os tempos são as medianas
+ * das repetições, e `guloso` e `exato` guardam o resultado da última.
+ * `razao_aproximacao` é a razão entre os tamanhos das soluções gulosa e
+ * exata; se o exato não comprovou a otimalidade (motor limitado fora do
+ * orçamento), é relativa à melhor solução encontrada, e
+ * `exato.limite_inferior` dá o limitante da razão verdadeira.
+ */
+typedef struct
+{
+    ResultadoCobertura guloso; /**< Resultado do solucionador guloso. */
+    ResultadoCobertura exato; /**< Resultado do solucionador exato. */
+    Reducao reducao; /**< Redução aplicada uma única vez antes dos dois solucionadores. */
+    int n_pontos; /**< Pontos depois do preparo compartilhado. */
+    int n_intervalos; /**< Intervalos depois do preparo compartilhado. */
+    double tempo_preparo_ms; /**< Tempo do preparo compartilhado (cópia e redução). */
+    double tempo_guloso_ms; /**< Mediana dos tempos do guloso. */
+    double tempo_exato_ms; /**< Mediana dos tempos do exato. */
+    double razao_aproximacao; /**< Solução gulosa / solução exata, ou 0 se alguma não cobre os pontos. */
+    double speedup; /**< Tempo do exato / tempo do guloso. */
+} ComparacaoCobertura;
+
+/**
+ * @struct ChaveCache
+ * @brief Forma canônica de uma instância, usada como chave do cache de soluções.
+ *
+ * Os pontos são ordenados por `comparar_pontos` e os intervalos por
+ * `comparar_intervalos_por_inicio`, e todas as coordenadas são
+ * deslocadas pela menor posição de ponto. Assim, a mesma instância com
+ * os pontos e intervalos em outra ordem, ou transladada por uma
+ * constante, tem a mesma chave.
+ */
+typedef struct
+{
+    uint64_t hash; /**< Hash das coordenadas canônicas. */
+    int n_pontos; /**< Quantidade de pontos. */
+    int n_intervalos; /**< Quantidade de intervalos. */
+    int64_t *coordenadas; /**< Posições dos pontos seguidas dos pares (início, fim) dos intervalos, já deslocadas. */
+    int64_t deslocamento; /**< Coordenada subtraída de todas as posições (a menor posição de ponto). */
+} ChaveCache;
+
+typedef struct EntradaCache EntradaCache;
+
+/**
+ * @struct EntradaCache
+ * @brief Solução ótima guardada no cache para uma instância canônica.
+ */
+struct EntradaCache
+{
+    ChaveCache chave; /**< Instância canônica; `deslocamento` não é usado. */
+    int64_t *solucao; /**< Pares (início, fim) dos intervalos da solução, deslocados como a chave. */
+    int n_solucao; /**< Quantidade de intervalos da solução, ou -1 se a instância não tem cobertura. */
+    size_t bytes; /**< Memória ocupada pela entrada, contada na capacidade do cache. */
+    EntradaCache *anterior; /**< Entrada usada mais recentemente que esta, ou NULL. */
+    EntradaCache *proxima; /**< Entrada usada menos recentemente que esta, ou NULL. */
+    EntradaCache *proxima_balde; /**< Próxima entrada do mesmo balde da tabela de dispersão. */
+};
+
+/**
+ * @struct CacheCobertura
+ * @brief Cache de soluções ótimas com capacidade em bytes e remoção LRU.
+ *
+ * As entradas ficam em uma tabela de dispersão pelo hash da chave e em
+ * uma lista da usada mais recentemente à menos recentemente: ao
+ * faltar espaço, as entradas do fim da lista são removidas.
+ */
+struct CacheCobertura
+{
+    EntradaCache **baldes; /**< Tabela de dispersão, com `n_baldes` listas de entradas. */
+    int n_baldes; /**< Quantidade de baldes, potência de 2. */
+    int n_entradas; /**< Quantidade de entradas guardadas. */
+    EntradaCache *mais_recente; /**< Início da lista LRU. */
+    EntradaCache *menos_recente; /**< Fim da lista LRU, a próxima entrada a ser removida. */
+    size_t capacidade_bytes; /**< Memória máxima das entradas. */
+    size_t bytes_em_uso; /**< Memória ocupada pelas entradas guardadas. */
+    int64_t acertos; /**< Consultas que encontraram a instância. */
+    int64_t falhas; /**< Consultas que não encontraram a instância. */
+    int64_t remocoes; /**< Entradas removidas para liberar espaço. */
+};
+
+/* Memória: contabilidade e arena. */
+void contabilizar_memoria(ContabilidadeMemoria *contabilidade, size_t liberados, size_t alocados);
+int arena_criar(Arena *arena, size_t capacidade, ContabilidadeMemoria *contabilidade);
+void *arena_alocar(Arena *arena, size_t tamanho);
+size_t arena_marcador(const Arena *arena);
+void arena_restaurar(Arena *arena, size_t marcador);
+void arena_liberar(Arena *arena);
+
+/* Contadores de hardware (perf_event no Linux). */
+int abrir_contador_hardware(int contador);
+int contadores_abrir(ContadoresHardware *contadores);
+void contadores_iniciar(ContadoresHardware *contadores);
+void contadores_parar(ContadoresHardware *contadores);
+void contadores_fechar(ContadoresHardware *contadores);
+void escrever_contadores(FILE *saida, const long long *contadores);
+
+/* Ordenação, busca nas posições e redução da instância. */
+int comparar_pontos(const void *a, const void *b);
+int comparar_intervalos_por_inicio(const void *a, const void *b);
+int comparar_faixas_reducao(const void *a, const void *b);
+int primeiro_ponto_a_partir(const Ponto *pontos, int n_pontos, int valor);
+int primeira_posicao_a_partir(const int *posicoes, int n_posicoes, int valor);
+Reducao reduzir_instancia(Arena *arena, Ponto *pontos, int *n_pontos, Intervalo *intervalos, int *n_intervalos);
+
+/* Instâncias: cenários fixos, geração sintética e leitura. */
+const CenarioCobertura *obter_cenario(int cenario);
+const char *nome_distribuicao(int distribuicao);
+int distribuicao_por_nome(const char *nome);
+void gerar_blocos_adversarios(GeradorAleatorio *gerador, Ponto *pontos, int n_pontos, Intervalo *intervalos, int n_intervalos);
+void leitor_fechar(LeitorInstancia *leitor);
+int leitor_abrir(LeitorInstancia *leitor, const char *caminho);
+int leitor_abrir_descritor(LeitorInstancia *leitor, int descritor);
+int leitor_recarregar(LeitorInstancia *leitor);
+int leitor_garantir(LeitorInstancia *leitor, size_t quantidade);
+int leitor_pular_espacos(LeitorInstancia *leitor);
+int leitor_ler_inteiro(LeitorInstancia *leitor, int *valor);
+int leitor_ler_int32(LeitorInstancia *leitor, int *valor);
+int leitor_ler_inteiro64(LeitorInstancia *leitor, int64_t *valor);
+int leitor_ler_int64(LeitorInstancia *leitor, int64_t *valor);
+int leitor_ler_bytes(LeitorInstancia *leitor, void *destino, size_t quantidade);
+size_t tamanho_minimo_instancia(int formato, int n_pontos, int n_intervalos);
+int ler_cabecalho_instancia(LeitorInstancia *leitor, int *formato, int *n_pontos, int *n_intervalos);
+int ler_valores_instancia(LeitorInstancia *leitor, int formato, Ponto *pontos, int n_pontos, Intervalo *intervalos, int n_intervalos,
+                          CompressaoCoordenadas *compressao);
+int comprimir_coordenadas(const int64_t *coordenadas, Ponto *pontos, int n_pontos, Intervalo *intervalos, int n_intervalos,
+                          CompressaoCoordenadas *compressao);
+void liberar_compressao(CompressaoCoordenadas *compressao);
+long long coordenada_original(const CompressaoCoordenadas *compressao, int valor);
+
+/* Medição. */
+int comparar_tempos(const void *a, const void *b);
+void calcular_estatisticas_tempo(double *amostras, int n_amostras, EstatisticasTempo *estatisticas);
+int fixar_cpu(int cpu);
+int repositorio_abrir(RepositorioResultados *repositorio, const char *caminho, int formato, const char *programa);
+void registro_iniciar(RegistroExecucao *registro, const char *programa, const char *instancia, int n_pontos, int n_intervalos);
+int repositorio_anexar(const RepositorioResultados *repositorio, const RegistroExecucao *registro);
+
+/* Interface única dos solucionadores. */
+const char *nome_solucionador(int solucionador);
+int solucionador_por_nome(const char *nome);
+void opcoes_cobertura_padrao(OpcoesCobertura *opcoes);
+int resolver_cobertura(const InstanciaCobertura *instancia, const OpcoesCobertura *opcoes, ResultadoCobertura *resultado);
+int resolver_cobertura_por_componentes(const InstanciaCobertura *instancia, const OpcoesCobertura *opcoes, ResultadoCobertura *resultado);
+void liberar_resultado_cobertura(ResultadoCobertura *resultado);
+int comparar_solucionadores(const InstanciaCobertura *instancia, const OpcoesCobertura *guloso, const OpcoesCobertura *exato, int repeticoes,
+                            ComparacaoCobertura *comparacao);
+void liberar_comparacao(ComparacaoCobertura *comparacao);
+
+/* Cache de soluções. */
+int cache_criar(CacheCobertura *cache, size_t capacidade_bytes);
+void cache_liberar(CacheCobertura *cache);
+int cache_preparar_chave(ChaveCache *chave, const Ponto *pontos, int n_pontos, const Intervalo *intervalos, int n_intervalos);
+void cache_liberar_chave(ChaveCache *chave);
+int cache_consultar(CacheCobertura *cache, const ChaveCache *chave, Intervalo *solucao, int *n_solucao);
+int cache_registrar(CacheCobertura *cache, ChaveCache *chave, const Intervalo *solucao, int n_solucao);
+void cache_exibir_estatisticas(const CacheCobertura *cache, FILE *saida);
+int resolver_cobertura_com_cache(CacheCobertura *cache, const InstanciaCobertura *instancia, const OpcoesCobertura *opcoes,
+                                 ResultadoCobertura *resultado);
+
+/* Modo em lote. */
+int resolver_lote_origem(const ConfiguracaoLote *lote, const char *caminho, FILE *saida);
+int resolver_lote_gerado(const ConfiguracaoLote *lote, const char *especificacao, FILE *saida);
+int resolver_lote_manifesto(const ConfiguracaoLote *lote, const char *caminho, FILE *saida);
+void escrever_cabecalho_lote(const ConfiguracaoLote *lote, FILE *saida);
+int executar_lote(ConfiguracaoLote *lote);
+
+/**
+ * Os núcleos abaixo ficam no cabeçalho para que o compilador os expanda
+ * nos laços internos dos solucionadores, em vez de chamá-los entre
+ * unidades de tradução.
+ */
+
+/**
+ * @brief Verifica se um ponto está coberto por um intervalo.
+ *
+ * Determina se a posição do ponto está dentro dos limites do intervalo,
+ * incluindo as extremidades.
+ *
+ * Recebe apenas as coordenadas, e não as estruturas inteiras.
+ *
+ * @param posicao Posição do ponto.
+ * @param inicio Início do intervalo.
+ * @param fim Fim do intervalo.
+ * @return 1 se o ponto estiver coberto, 0 caso contrário.
+ */
+static inline int ponto_coberto_por_intervalo(int posicao, int inicio, int fim)
+{
+    return (posicao >= inicio) & (posicao <= fim);
+}
+
+/**
+ * @brief Calcula quantas palavras de 64 bits são necessárias para um bitset.
+ *
+ * Na representação de cobertura em bitset, cada ponto ocupa um único bit,
+ * de modo que um conjunto de `n_pontos` pontos é armazenado em
+ * `ceil(n_pontos / 64)` palavras de 64 bits.
+ *
+ * @param n_pontos Quantidade de pontos representados.
+ * @return Quantidade de palavras de 64 bits do bitset.
+ */
+static inline int calcular_palavras_bitset(int n_pontos)
+{
+    return (n_pontos + 63) / 64;
+}
+
+#if defined(__AVX2__) && !(defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__))
+/**
+ * @brief Conta os bits ligados de um vetor AVX2 de 256 bits.
+ *
+ * O AVX2 não possui instrução de popcount vetorial, então a contagem
+ * é feita por tabela de nibbles com `_mm256_shuffle_epi8`, e as
+ * contagens de cada byte são somadas em quatro acumuladores de 64 bits
+ * com `_mm256_sad_epu8`.
+ *
+ * @param v Vetor de 256 bits cujos bits serão contados.
+ * @return Vetor com a contagem parcial de cada uma das quatro palavras.
+ */
+static inline __m256i bitset_popcount_avx2(__m256i v)
+{
+    const __m256i tabela = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    __m256i baixo = _mm256_and_si256(v, nibble);
+    __m256i alto = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+    __m256i contagem = _mm256_add_epi8(_mm256_shuffle_epi8(tabela, baixo), _mm256_shuffle_epi8(tabela, alto));
+    return _mm256_sad_epu8(contagem, _mm256_setzero_si256());
+}
+
+/**
+ * @brief Soma as quatro palavras de 64 bits de um vetor AVX2.
+ *
+ * @param v Vetor com quatro acumuladores de 64 bits.
+ * @return Soma dos quatro acumuladores.
+ */
+static inline int bitset_somar_avx2(__m256i v)
+{
+    return (int)(_mm256_extract_epi64(v, 0) + _mm256_extract_epi64(v, 1) +
+                 _mm256_extract_epi64(v, 2) + _mm256_extract_epi64(v, 3));
+}
+#endif
+
+/**
+ * @brief Conta quantos bits estão ligados em um bitset.
+ *
+ * Usa AVX-512 (VPOPCNTQ) ou AVX2 quando o programa é compilado com
+ * suporte a essas extensões (por exemplo, com `-march=native`), e
+ * `__builtin_popcountll` palavra a palavra no caso geral.
+ *
+ * @param bits Vetor de palavras do bitset.
+ * @param n_palavras Quantidade de palavras do bitset.
+ * @return Quantidade de bits ligados.
+ */
+static inline int bitset_contar(const uint64_t *bits, int n_palavras)
+{
+    int total = 0;
+    int i = 0;
+
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+    __m512i acumulador = _mm512_setzero_si512();
+    for (; i + 8 <= n_palavras; i += 8)
+    {
+        acumulador = _mm512_add_epi64(acumulador, _mm512_popcnt_epi64(_mm512_loadu_si512((const void *)(bits + i))));
+    }
+    total += (int)_mm512_reduce_add_epi64(acumulador);
+#elif defined(__AVX2__)
+    __m256i acumulador = _mm256_setzero_si256();
+    for (; i + 4 <= n_palavras; i += 4)
+    {
+        acumulador = _mm256_add_epi64(acumulador, bitset_popcount_avx2(_mm256_loadu_si256((const __m256i *)(bits + i))));
+    }
+    total += bitset_somar_avx2(acumulador);
+#endif
+
+    for (; i < n_palavras; i++)
+    {
+        total += __builtin_popcountll(bits[i]);
+    }
+
+    return total;
+}
+
+/**
+ * @brief Conta quantos pontos de uma máscara ainda não estão cobertos.
+ *
+ * Calcula `popcount(mascara AND NOT cobertura)`, ou seja, a quantidade
+ * de pontos que passariam a ser cobertos se o intervalo representado
+ * por `mascara` fosse escolhido.
+ *
+ * @param mascara Bitset dos pontos cobertos por um intervalo.
+ * @param cobertura Bitset dos pontos já cobertos.
+ * @param n_palavras Quantidade de palavras dos bitsets.
+ * @return Quantidade de pontos novos cobertos pela máscara.
+ */
+static inline int bitset_contar_novos(const uint64_t *mascara, const uint64_t *cobertura, int n_palavras)
+{
+    int total = 0;
+    int i = 0;
+
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+    __m512i acumulador = _mm512_setzero_si512();
+    for (; i + 8 <= n_palavras; i += 8)
+    {
+        __m512i novos = _mm512_andnot_si512(_mm512_loadu_si512((const void *)(cobertura + i)),
+                                            _mm512_loadu_si512((const void *)(mascara + i)));
+        acumulador = _mm512_add_epi64(acumulador, _mm512_popcnt_epi64(novos));
+    }
+    total += (int)_mm512_reduce_add_epi64(acumulador);
+#elif defined(__AVX2__)
+    __m256i acumulador = _mm256_setzero_si256();
+    for (; i + 4 <= n_palavras; i += 4)
+    {
+        __m256i novos = _mm256_andnot_si256(_mm256_loadu_si256((const __m256i *)(cobertura + i)),
+                                            _mm256_loadu_si256((const __m256i *)(mascara + i)));
+        acumulador = _mm256_add_epi64(acumulador, bitset_popcount_avx2(novos));
+    }
+    total += bitset_somar_avx2(acumulador);
+#endif
+
+    for (; i < n_palavras; i++)
+    {
+        total += __builtin_popcountll(mascara[i] & ~cobertura[i]);
+    }
+
+    return total;
+}
+
+/**
+ * @brief Calcula a união de dois bitsets e conta os bits do resultado.
+ *
+ * Grava em `destino` a operação `a OR b` e retorna a quantidade de bits
+ * ligados em `destino`. `destino` pode ser o próprio `a`, permitindo
+ * a união no lugar.
+ *
+ * @param destino Bitset que recebe a união.
+ * @param a Primeiro bitset.
+ * @param b Segundo bitset.
+ * @param n_palavras Quantidade de palavras dos bitsets.
+ * @return Quantidade de bits ligados na união.
+ */
+static inline int bitset_uniao_contar(uint64_t *destino, const uint64_t *a, const uint64_t *b, int n_palavras)
+{
+    int total = 0;
+    int i = 0;
+
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+    __m512i acumulador = _mm512_setzero_si512();
+    for (; i + 8 <= n_palavras; i += 8)
+    {
+        __m512i uniao = _mm512_or_si512(_mm512_loadu_si512((const void *)(a + i)), _mm512_loadu_si512((const void *)(b + i)));
+        _mm512_storeu_si512((void *)(destino + i), uniao);
+        acumulador = _mm512_add_epi64(acumulador, _mm512_popcnt_epi64(uniao));
+    }
+    total += (int)_mm512_reduce_add_epi64(acumulador);
+#elif defined(__AVX2__)
+    __m256i acumulador = _mm256_setzero_si256();
+    for (; i + 4 <= n_palavras; i += 4)
+    {
+        __m256i uniao = _mm256_or_si256(_mm256_loadu_si256((const __m256i *)(a + i)), _mm256_loadu_si256((const __m256i *)(b + i)));
+        _mm256_storeu_si256((__m256i *)(destino + i), uniao);
+        acumulador = _mm256_add_epi64(acumulador, bitset_popcount_avx2(uniao));
+    }
+    total += bitset_somar_avx2(acumulador);
+#endif
+
+    for (; i < n_palavras; i++)
+    {
+        destino[i] = a[i] | b[i];
+        total += __builtin_popcountll(destino[i]);
+    }
+
+    return total;
+}
+
+/**
+ * @brief Sorteia o próximo número de 64 bits do gerador.
+ *
+ * @param gerador Gerador pseudoaleatório.
+ * @return Número pseudoaleatório uniforme em [0, 2^64).
+ */
+static inline uint64_t gerador_proximo(GeradorAleatorio *gerador)
+{
+    uint64_t z = (gerador->estado += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Sorteia um inteiro em [0, limite).
+ *
+ * @param gerador Gerador pseudoaleatório.
+ * @param limite Limite superior exclusivo (deve ser positivo).
+ * @return Inteiro pseudoaleatório em [0, limite).
+ */
+static inline int gerador_uniforme(GeradorAleatorio *gerador, int limite)
+{
+    return (int)(gerador_proximo(gerador) % (uint64_t)limite);
+}
+
+#endif
@@ -1,3 +1,5 @@
+#define _GNU_SOURCE
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -5,736 +7,17 @@
 #include <sys/resource.h>
 #include <math.h>
 #include <limits.h>
+#include <stdint.h>
+#include <sched.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-#define MAX_PONTOS 1000
-#define MAX_INTERVALOS 1000
-#define MAX_PATH 1024
-
-/**
- * @brief Representa um intervalo numérico fechado.
- *
- * Esta estrutura define um intervalo contínuo na linha dos números inteiros,
- * indo do valor `inicio` até o valor `fim`. No contexto do problema de
- * cobertura de pontos, um intervalo é usado para verificar quais pontos
- * estão contidos dentro de seus limites.
- *
- * Um ponto é considerado coberto se sua posição satisfaz:
- * inicio ≤ posição ≤ fim.
- */
-typedef struct
-{
-    int inicio;  /**< Limite inferior (início) do intervalo */
-    int fim; /**< Limite superior (fim) do intervalo */
-} Intervalo;
-
-/**
- * @brief Representa um ponto em uma linha numérica.
- *
- * Esta estrutura modela um ponto identificado por um `id` e associado
- * a uma posição inteira na linha dos números. No problema de cobertura
- * de pontos, cada ponto deve ser coberto por pelo menos um intervalo.
- *
- * Um ponto é considerado coberto quando sua posição está dentro dos
- * limites de algum intervalo selecionado.
- */
-typedef struct
-{
-    int id; /**< Identificador único do ponto (usado para exibição e controle) */
-    int posicao; /**< Posição do ponto na linha numérica */
-} Ponto;
-
-/**
- * @brief Estrutura principal do problema de cobertura de pontos usando backtracking.
- *
- * Esta estrutura centraliza todos os dados necessários para a execução
- * do algoritmo de backtracking, incluindo:
- * - os pontos que devem ser cobertos;
- * - os intervalos disponíveis para cobertura;
- * - a solução em construção (parcial);
- * - a melhor solução encontrada até o momento;
- * - métricas de desempenho e qualidade.
- *
- * Ela permite organizar o estado do problema durante a busca na árvore
- * de soluções, facilitando a aplicação de podas e a coleta de métricas.
- */
-typedef struct
-{
-    Intervalo *intervalos; /**< Vetor com todos os intervalos disponíveis */
-    int n_intervalos; /**< Quantidade total de intervalos */
-    Ponto *pontos;  /**< Vetor com os pontos que devem ser cobertos */
-    int n_pontos;  /**< Quantidade total de pontos */
-    int *pontos_cobertos; /**< Vetor auxiliar para marcar pontos já cobertos */
-    int n_pontos_cobertos; /**< Quantidade de pontos atualmente cobertos */
-    Intervalo *solucao_atual; /**< Conjunto de intervalos da solução parcial */
-    int n_solucao_atual;  /**< Tamanho da solução parcial atual */
-    Intervalo *melhor_solucao; /**< Melhor solução completa encontrada */
-    int n_melhor_solucao; /**< Quantidade de intervalos da melhor solução */
-    double tempo_execucao;  /**< Tempo total de execução do algoritmo (em ms) */
-    long memoria_utilizada; /**< Memória máxima utilizada pelo processo (em KB) */
-    double qualidade;  /**< Qualidade da solução encontrada */
-    int nos_visitados; /**< Número de nós visitados na árvore de busca */
-} ProblemaBacktracking;
+#include "solucionadorBacktracking.h"
 
-/**
- * @brief Estrutura que armazena as métricas de desempenho do algoritmo de backtracking.
- *
- * Esta estrutura é utilizada para registrar e transportar os resultados
- * da execução do algoritmo, permitindo analisar seu desempenho em
- * diferentes cenários de teste (pequeno, médio e grande).
- *
- * As métricas incluem tempo de execução, uso de memória, qualidade da
- * solução encontrada e o esforço computacional medido pelo número de
- * nós visitados.
- */
-typedef struct
-{
-    double tempo; /**< Tempo total de execução do algoritmo (em milissegundos) */
-    long memoria; /**< Memória máxima utilizada durante a execução (em KB) */
-    double qualidade;  /**< Qualidade da solução (1 - intervalos_usados / intervalos_totais) */
-    int n_solucao;  /**< Número de intervalos da solução final encontrada */
-    int nos_visitados; /**< Quantidade de nós visitados na árvore de busca */
-} MetricasBacktracking;
-
-/**
- * @brief Inicializa a estrutura do problema de backtracking.
- *
- * Esta função prepara a estrutura `ProblemaBacktracking` para uso,
- * garantindo que todos os ponteiros estejam nulos e que os contadores
- * e métricas iniciem com valores seguros.
- *
- * Em especial, o campo `n_melhor_solucao` é inicializado com `INT_MAX`
- * para permitir que qualquer solução válida encontrada seja considerada
- * melhor na primeira comparação.
- *
- * Essa inicialização é essencial antes de configurar cenários ou
- * executar o algoritmo de backtracking, evitando erros de memória
- * e comportamentos indefinidos.
- *
- * @param problema Ponteiro para a estrutura do problema a ser inicializada.
- */
-void inicializar_problema_backtracking(ProblemaBacktracking *problema)
-{
-    problema->intervalos = NULL;
-    problema->pontos = NULL;
-    problema->pontos_cobertos = NULL;
-    problema->solucao_atual = NULL;
-    problema->melhor_solucao = NULL;
-    problema->n_intervalos = 0;
-    problema->n_pontos = 0;
-    problema->n_pontos_cobertos = 0;
-    problema->n_solucao_atual = 0;
-    problema->n_melhor_solucao = INT_MAX;
-    problema->tempo_execucao = 0.0;
-    problema->memoria_utilizada = 0;
-    problema->qualidade = 0.0;
-    problema->nos_visitados = 0;
-}
-
-/**
- * @brief Libera toda a memória alocada dinamicamente no problema de backtracking.
- *
- * Esta função é responsável por desalocar corretamente todos os vetores
- * alocados dinamicamente dentro da estrutura `ProblemaBacktracking`.
- * Após a liberação, os ponteiros são ajustados para `NULL`, evitando
- * acessos inválidos e possíveis erros de dupla liberação.
- *
- * Essa função deve ser chamada ao final da execução de cada cenário
- * ou quando o problema não for mais utilizado, garantindo boas
- * práticas de gerenciamento de memória em C.
- *
- * @param problema Ponteiro para a estrutura do problema cujos recursos
- *                 alocados devem ser liberados.
- */
-void liberar_problema_backtracking(ProblemaBacktracking *problema)
-{
-    if (problema->intervalos != NULL)
-    {
-        free(problema->intervalos);
-        problema->intervalos = NULL;
-    }
-    if (problema->pontos != NULL)
-    {
-        free(problema->pontos);
-        problema->pontos = NULL;
-    }
-    if (problema->pontos_cobertos != NULL)
-    {
-        free(problema->pontos_cobertos);
-        problema->pontos_cobertos = NULL;
-    }
-    if (problema->solucao_atual != NULL)
-    {
-        free(problema->solucao_atual);
-        problema->solucao_atual = NULL;
-    }
-    if (problema->melhor_solucao != NULL)
-    {
-        free(problema->melhor_solucao);
-        problema->melhor_solucao = NULL;
-    }
-} 
-
-/**
- * @brief Função de comparação de intervalos para ordenação.
- *
- * Esta função é utilizada pelo `qsort` para ordenar os intervalos
- * antes da execução do algoritmo de backtracking.
- *
- * O critério de ordenação é:
- * 1. Intervalos maiores vêm primeiro (ordem decrescente de tamanho);
- * 2. Em caso de empate, o intervalo com menor valor de início vem primeiro.
- *
- * A ordenação por tamanho é uma heurística importante, pois intervalos
- * maiores tendem a cobrir mais pontos, o que pode reduzir a profundidade
- * da árvore de busca e melhorar a eficiência das podas no backtracking.
- *
- * @param a Ponteiro genérico para o primeiro intervalo.
- * @param b Ponteiro genérico para o segundo intervalo.
- * @return Valor negativo se `a` deve vir antes de `b`,
- *         valor positivo se `a` deve vir depois de `b`,
- *         ou zero se ambos forem considerados equivalentes.
- */
-int comparar_intervalos_backtracking(const void *a, const void *b)
-{
-    int resultado = 0;
-    Intervalo *intervalo_a = (Intervalo *)a;
-    Intervalo *intervalo_b = (Intervalo *)b;
-
-    int tamanho_a = intervalo_a->fim - intervalo_a->inicio;
-    int tamanho_b = intervalo_b->fim - intervalo_b->inicio;
-
-    if (tamanho_a > tamanho_b)
-    {
-        resultado = -1;
-    }
-    else if (tamanho_a < tamanho_b)
-    {
-        resultado = 1;
-    }
-    else
-    {
-        if (intervalo_a->inicio < intervalo_b->inicio)
-        {
-            resultado = -1;
-        }
-        else if (intervalo_a->inicio > intervalo_b->inicio)
-        {
-            resultado = 1;
-        }
-        else
-        {
-            resultado = 0;
-        }
-    }
-
-    return resultado;
-}
-
-/**
- * @brief Função de comparação de pontos para ordenação.
- *
- * Esta função é utilizada pelo `qsort` para ordenar os pontos
- * em ordem crescente de posição na linha numérica.
- *
- * A ordenação dos pontos facilita operações de verificação
- * de cobertura e análise dos resultados, tornando o
- * comportamento do algoritmo mais previsível e organizado.
- *
- * @param a Ponteiro genérico para o primeiro ponto.
- * @param b Ponteiro genérico para o segundo ponto.
- * @return Valor negativo se `a` deve vir antes de `b`,
- *         valor positivo se `a` deve vir depois de `b`,
- *         ou zero se ambos tiverem a mesma posição.
- */
-int comparar_pontos_backtracking(const void *a, const void *b)
-{
-    int resultado = 0;
-    Ponto *ponto_a = (Ponto *)a;
-    Ponto *ponto_b = (Ponto *)b;
-
-    if (ponto_a->posicao < ponto_b->posicao)
-    {
-        resultado = -1;
-    }
-    else if (ponto_a->posicao > ponto_b->posicao)
-    {
-        resultado = 1;
-    }
-    else
-    {
-        resultado = 0;
-    }
-
-    return resultado;
-}
-
-/**
- * @brief Configura o cenário pequeno para o algoritmo de backtracking.
- *
- * Este cenário é determinístico e foi projetado para testes iniciais
- * e validação do funcionamento do algoritmo.
- *
- * Ele contém:
- * - 8 pontos fixos, distribuídos ao longo da linha numérica;
- * - 10 intervalos fixos, construídos de forma a garantir que todos
- *   os pontos possam ser cobertos.
- *
- * Por ser um cenário de tamanho reduzido, ele permite observar
- * com clareza o comportamento do backtracking, as decisões de poda
- * e a formação da solução ótima.
- *
- * Ao final da configuração, os intervalos são ordenados por tamanho
- * (do maior para o menor), utilizando uma heurística que tende a
- * melhorar o desempenho do algoritmo.
- *
- * @param problema Ponteiro para a estrutura do problema a ser configurada.
- */
-void configurar_cenario_pequeno_backtracking(ProblemaBacktracking* problema) {
-    // 8 pontos fixos
-    problema->n_pontos = 8;
-    problema->pontos = (Ponto *)malloc(8 * sizeof(Ponto));
-    problema->pontos[0] = (Ponto){1, 5};
-    problema->pontos[1] = (Ponto){2, 10};
-    problema->pontos[2] = (Ponto){3, 15};
-    problema->pontos[3] = (Ponto){4, 20};
-    problema->pontos[4] = (Ponto){5, 25};
-    problema->pontos[5] = (Ponto){6, 30};
-    problema->pontos[6] = (Ponto){7, 35};
-    problema->pontos[7] = (Ponto){8, 40};
-    
-    // 10 intervalos fixos que cobrem todos os pontos
-    problema->n_intervalos = 10;
-    problema->intervalos = (Intervalo *)malloc(10 * sizeof(Intervalo));
-    problema->intervalos[0] = (Intervalo){0, 12};
-    problema->intervalos[1] = (Intervalo){8, 22};
-    problema->intervalos[2] = (Intervalo){15, 28};
-    problema->intervalos[3] = (Intervalo){25, 42};
-    problema->intervalos[4] = (Intervalo){5, 18};
-    problema->intervalos[5] = (Intervalo){18, 32};
-    problema->intervalos[6] = (Intervalo){30, 45};
-    problema->intervalos[7] = (Intervalo){3, 15};
-    problema->intervalos[8] = (Intervalo){20, 35};
-    problema->intervalos[9] = (Intervalo){12, 26};
-    
-    qsort(problema->intervalos, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos_backtracking);
-}
-
-/**
- * @brief Configura o cenário médio para o algoritmo de backtracking.
- *
- * Este cenário é determinístico e representa um nível intermediário
- * de complexidade em relação ao cenário pequeno.
- *
- * Ele contém:
- * - 10 pontos fixos, distribuídos de forma uniforme na linha numérica;
- * - 12 intervalos fixos, projetados para garantir a cobertura de todos
- *   os pontos.
- *
- * O cenário médio permite avaliar o impacto do aumento do espaço de
- * busca no desempenho do algoritmo, especialmente no número de nós
- * visitados e no tempo de execução.
- *
- * Assim como nos demais cenários, os intervalos são ordenados por
- * tamanho (ordem decrescente), utilizando uma heurística que tende a
- * melhorar a eficiência das podas no backtracking.
- *
- * @param problema Ponteiro para a estrutura do problema a ser configurada.
- */
-void configurar_cenario_medio_backtracking(ProblemaBacktracking* problema) {
-    // 10 pontos fixos
-    problema->n_pontos = 10;
-    problema->pontos = (Ponto *)malloc(10 * sizeof(Ponto));
-    problema->pontos[0] = (Ponto){1, 8};
-    problema->pontos[1] = (Ponto){2, 16};
-    problema->pontos[2] = (Ponto){3, 24};
-    problema->pontos[3] = (Ponto){4, 32};
-    problema->pontos[4] = (Ponto){5, 40};
-    problema->pontos[5] = (Ponto){6, 48};
-    problema->pontos[6] = (Ponto){7, 56};
-    problema->pontos[7] = (Ponto){8, 64};
-    problema->pontos[8] = (Ponto){9, 72};
-    problema->pontos[9] = (Ponto){10, 80};
-    
-    // 12 intervalos fixos que cobrem todos os pontos
-    problema->n_intervalos = 12;
-    problema->intervalos = (Intervalo *)malloc(12 * sizeof(Intervalo));
-    problema->intervalos[0] = (Intervalo){0, 20};
-    problema->intervalos[1] = (Intervalo){12, 35};
-    problema->intervalos[2] = (Intervalo){25, 45};
-    problema->intervalos[3] = (Intervalo){38, 58};
-    problema->intervalos[4] = (Intervalo){50, 75};
-    problema->intervalos[5] = (Intervalo){65, 85};
-    problema->intervalos[6] = (Intervalo){5, 28};
-    problema->intervalos[7] = (Intervalo){20, 42};
-    problema->intervalos[8] = (Intervalo){35, 55};
-    problema->intervalos[9] = (Intervalo){48, 68};
-    problema->intervalos[10] = (Intervalo){60, 82};
-    problema->intervalos[11] = (Intervalo){15, 38};
-    
-    qsort(problema->intervalos, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos_backtracking);
-}
-
-/**
- * @brief Configura um cenário grande para o problema de cobertura de pontos usando backtracking.
- *
- * Este cenário é utilizado para testar o algoritmo em uma instância
- * de maior complexidade, com mais pontos e intervalos, aumentando
- * o espaço de busca explorado pelo backtracking.
- *
- * O cenário contém:
- * - 12 pontos fixos distribuídos ao longo do eixo numérico
- * - 15 intervalos fixos, todos capazes de cobrir os pontos
- *
- * Ao final da configuração, os intervalos são ordenados em ordem
- * decrescente de tamanho (e critério secundário de início),
- * o que pode ajudar a reduzir a profundidade da busca ao priorizar
- * intervalos mais abrangentes.
- *
- * @param problema Ponteiro para a estrutura do problema de backtracking
- */
-void configurar_cenario_grande_backtracking(ProblemaBacktracking* problema) {
-    // 12 pontos fixos
-    problema->n_pontos = 12;
-    problema->pontos = (Ponto *)malloc(12 * sizeof(Ponto));
-    problema->pontos[0] = (Ponto){1, 5};
-    problema->pontos[1] = (Ponto){2, 12};
-    problema->pontos[2] = (Ponto){3, 18};
-    problema->pontos[3] = (Ponto){4, 25};
-    problema->pontos[4] = (Ponto){5, 32};
-    problema->pontos[5] = (Ponto){6, 38};
-    problema->pontos[6] = (Ponto){7, 45};
-    problema->pontos[7] = (Ponto){8, 52};
-    problema->pontos[8] = (Ponto){9, 58};
-    problema->pontos[9] = (Ponto){10, 65};
-    problema->pontos[10] = (Ponto){11, 72};
-    problema->pontos[11] = (Ponto){12, 80};
-    
-    // 15 intervalos fixos que cobrem todos os pontos
-    problema->n_intervalos = 15;
-    problema->intervalos = (Intervalo *)malloc(15 * sizeof(Intervalo));
-    problema->intervalos[0] = (Intervalo){0, 15};
-    problema->intervalos[1] = (Intervalo){10, 28};
-    problema->intervalos[2] = (Intervalo){20, 35};
-    problema->intervalos[3] = (Intervalo){30, 48};
-    problema->intervalos[4] = (Intervalo){40, 58};
-    problema->intervalos[5] = (Intervalo){50, 68};
-    problema->intervalos[6] = (Intervalo){60, 85};
-    problema->intervalos[7] = (Intervalo){5, 20};
-    problema->intervalos[8] = (Intervalo){15, 32};
-    problema->intervalos[9] = (Intervalo){25, 42};
-    problema->intervalos[10] = (Intervalo){35, 52};
-    problema->intervalos[11] = (Intervalo){45, 62};
-    problema->intervalos[12] = (Intervalo){55, 75};
-    problema->intervalos[13] = (Intervalo){70, 85};
-    problema->intervalos[14] = (Intervalo){8, 26};
-    
-    qsort(problema->intervalos, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos_backtracking);
-}
-
-/**
- * @brief Verifica se um ponto é coberto por um intervalo.
- *
- * Esta função testa se a posição de um ponto está contida
- * dentro dos limites de um intervalo fechado [início, fim].
- *
- * Ela é utilizada como operação básica do algoritmo de
- * backtracking para decidir se um ponto já foi coberto
- * por um determinado intervalo escolhido na solução.
- *
- * @param ponto Estrutura que representa o ponto a ser verificado.
- * @param intervalo Estrutura que representa o intervalo considerado.
- * @return 1 se o ponto estiver dentro do intervalo (coberto),
- *         ou 0 caso contrário.
- */
-int ponto_coberto_por_intervalo_backtracking(Ponto ponto, Intervalo intervalo)
-{
-    int resultado = 0;
-    if (ponto.posicao >= intervalo.inicio && ponto.posicao <= intervalo.fim)
-    {
-        resultado = 1;
-    }
-    else
-    {
-        resultado = 0;
-    }
-    return resultado;
-}
-
-/**
- * @brief Verifica se a solução parcial atual cobre todos os pontos do problema.
- *
- * Esta função analisa os intervalos presentes na solução parcial
- * (`solucao_atual`) e verifica se, juntos, eles cobrem todos os
- * pontos definidos no problema.
- *
- * Para isso, é criado um vetor auxiliar de cobertura, onde cada
- * posição indica se um ponto já foi coberto (1) ou não (0).
- * Esse vetor é utilizado apenas temporariamente durante a verificação.
- *
- * A função é usada pelo algoritmo de backtracking para decidir
- * se uma solução parcial já é válida (cobre todos os pontos)
- * ou se ainda é necessário adicionar mais intervalos.
- *
- * @param problema Ponteiro para a estrutura que representa o problema.
- * @return 1 se todos os pontos estiverem cobertos pela solução atual,
- *         ou 0 caso contrário.
- */
-int verificar_cobertura_parcial(ProblemaBacktracking *problema)
-{
-    int resultado = 0;
-    int *cobertura_temp = NULL;
-    int pontos_cobertos = 0;
-
-    cobertura_temp = (int *)calloc(problema->n_pontos, sizeof(int));
-    if (cobertura_temp == NULL)
-    {
-        resultado = 0;
-    }
-    else
-    {
-        for (int i = 0; i < problema->n_solucao_atual; i++)
-        {
-            for (int j = 0; j < problema->n_pontos; j++)
-            {
-                if (cobertura_temp[j] == 0)
-                {
-                    if (ponto_coberto_por_intervalo_backtracking(problema->pontos[j], problema->solucao_atual[i]))
-                    {
-                        cobertura_temp[j] = 1;
-                        pontos_cobertos++;
-                    }
-                }
-            }
-        }
-
-        free(cobertura_temp);
-
-        if (pontos_cobertos == problema->n_pontos)
-        {
-            resultado = 1;
-        }
-        else
-        {
-            resultado = 0;
-        }
-    }
-
-    return resultado;
-}
-
-/**
- * @brief Copia a solução atual para a melhor solução encontrada.
- *
- * Esta função é chamada quando o algoritmo de backtracking
- * encontra uma solução válida melhor do que a melhor solução
- * armazenada até o momento.
- *
- * Ela realiza uma cópia dos intervalos da solução atual
- * (`solucao_atual`) para o vetor `melhor_solucao`, garantindo
- * que a melhor combinação de intervalos seja preservada
- * mesmo após o retorno das chamadas recursivas.
- *
- * A memória para a melhor solução é alocada apenas uma vez,
- * na primeira vez em que uma solução válida é encontrada.
- *
- * @param problema Ponteiro para a estrutura que representa o problema.
- */
-void copiar_solucao(ProblemaBacktracking *problema)
-{
-    if (problema->melhor_solucao == NULL)
-    {
-        problema->melhor_solucao = (Intervalo *)malloc(problema->n_intervalos * sizeof(Intervalo));
-    }
-
-    if (problema->melhor_solucao != NULL)
-    {
-        for (int i = 0; i < problema->n_solucao_atual; i++)
-        {
-            problema->melhor_solucao[i] = problema->solucao_atual[i];
-        }
-        problema->n_melhor_solucao = problema->n_solucao_atual;
-    }
-}
-
-/**
- * @brief Função recursiva principal do algoritmo de backtracking.
- *
- * Esta função explora o espaço de soluções do problema de cobertura
- * de pontos, decidindo recursivamente se cada intervalo será
- * incluído ou não na solução atual.
- *
- * A cada chamada, o algoritmo:
- * - conta um novo nó visitado (métrica de complexidade);
- * - verifica condições de parada;
- * - aplica critérios de poda para reduzir o espaço de busca;
- * - testa se a solução parcial cobre todos os pontos;
- * - atualiza a melhor solução encontrada.
- *
- * @param problema Ponteiro para a estrutura que representa o problema.
- * @param indice_intervalo Índice do intervalo atualmente considerado.
- */
-void backtracking_recursivo(ProblemaBacktracking *problema, int indice_intervalo)
-{   
-    /**
-     * Incrementa o contador de nós visitados.
-     * Essa métrica indica quantos estados da árvore de busca
-     * foram efetivamente explorados pelo algoritmo.
-     */
-    problema->nos_visitados++;
-
-    /**
-     * Condição de parada:
-     * se todos os intervalos já foram considerados,
-     * não há mais decisões a serem tomadas.
-     */
-    if (indice_intervalo >= problema->n_intervalos)
-    {
-        return;
-    }
-
-    /**
-     * Poda baseada na melhor solução encontrada até o momento.
-     * Se a solução atual já é maior ou igual à melhor solução,
-     * não faz sentido continuar explorando esse ramo.
-     */
-    if (problema->n_solucao_atual >= problema->n_melhor_solucao)
-    {
-        return;
-    }
-
-    /**
-     * Verifica se a próxima escolha já torna impossível
-     * melhorar a melhor solução atual.
-     */
-    int pode_podar = 0;
-    if (problema->n_solucao_atual + 1 >= problema->n_melhor_solucao)
-    {
-        pode_podar = 1;
-    }
-
-    /**
-     * Caso não seja possível podar, tenta incluir o intervalo atual
-     * na solução.
-     */
-    if (pode_podar == 0)
-    {   
-        /**
-         * Inclui o intervalo atual na solução parcial.
-         */
-        problema->solucao_atual[problema->n_solucao_atual] = problema->intervalos[indice_intervalo];
-        problema->n_solucao_atual++;
-
-        /**
-         * Verifica se a solução parcial já cobre todos os pontos.
-         */
-        if (verificar_cobertura_parcial(problema))
-        {   
-            /**
-             * Caso a solução seja válida e melhor que a anterior,
-             * ela passa a ser a melhor solução encontrada.
-             */
-            if (problema->n_solucao_atual < problema->n_melhor_solucao)
-            {
-                copiar_solucao(problema);
-            }
-        }
-        else
-        {   
-            /**
-             * Caso ainda não cubra todos os pontos, continua a busca
-             * considerando o próximo intervalo.
-             */
-            backtracking_recursivo(problema, indice_intervalo + 1);
-        }
-
-        /**
-         * Remove o intervalo atual da solução (backtrack),
-         * restaurando o estado anterior antes de testar
-         * a próxima possibilidade.
-         */
-        problema->n_solucao_atual--;
-    }
-
-    /**
-     * Explora o ramo onde o intervalo atual NÃO é incluído
-     * na solução.
-     */
-    backtracking_recursivo(problema, indice_intervalo + 1);
-}
-
-/**
- * @brief Resolve o problema de cobertura de pontos utilizando backtracking.
- *
- * Esta função é responsável por:
- * - inicializar estruturas auxiliares do algoritmo;
- * - executar o algoritmo de backtracking recursivo;
- * - medir tempo de execução e uso de memória;
- * - calcular a qualidade da solução encontrada;
- * - retornar todas essas informações na forma de métricas.
- *
- * Ela funciona como a função principal do algoritmo de backtracking,
- * encapsulando a execução e a avaliação da solução.
- *
- * @param problema Ponteiro para a estrutura que representa o problema.
- * @return Estrutura contendo as métricas de desempenho e qualidade
- *         da solução encontrada.
- */
-MetricasBacktracking resolver_backtracking(ProblemaBacktracking *problema)
-{
-    MetricasBacktracking metricas;
-    struct timespec inicio, fim;
-    struct rusage uso_memoria;
-
-    metricas.tempo = 0.0;
-    metricas.memoria = 0;
-    metricas.qualidade = 0.0;
-    metricas.n_solucao = 0;
-    metricas.nos_visitados = 0;
-
-    clock_gettime(CLOCK_MONOTONIC, &inicio);
-
-    problema->solucao_atual = (Intervalo *)malloc(problema->n_intervalos * sizeof(Intervalo));
-    if (problema->solucao_atual == NULL)
-    {
-        clock_gettime(CLOCK_MONOTONIC, &fim);
-        problema->tempo_execucao = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
-        metricas.tempo = problema->tempo_execucao;
-        getrusage(RUSAGE_SELF, &uso_memoria);
-        problema->memoria_utilizada = uso_memoria.ru_maxrss;
-        metricas.memoria = problema->memoria_utilizada;
-        return metricas;
-    }
-
-    problema->n_solucao_atual = 0;
-    problema->nos_visitados = 0;
-
-    backtracking_recursivo(problema, 0);
-
-    clock_gettime(CLOCK_MONOTONIC, &fim);
-
-    problema->tempo_execucao = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
-    metricas.tempo = problema->tempo_execucao;
-
-    getrusage(RUSAGE_SELF, &uso_memoria);
-    problema->memoria_utilizada = uso_memoria.ru_maxrss;
-    metricas.memoria = problema->memoria_utilizada;
-
-    if (problema->n_intervalos > 0)
-    {
-        problema->qualidade = 1.0 - ((double)problema->n_melhor_solucao / problema->n_intervalos);
-        metricas.qualidade = problema->qualidade;
-    }
-    else
-    {
-        problema->qualidade = 0.0;
-        metricas.qualidade = 0.0;
-    }
-
-    metricas.n_solucao = problema->n_melhor_solucao;
-    metricas.nos_visitados = problema->nos_visitados;
-
-    return metricas;
-}
+#define MAX_PATH 1024
 
 /**
  * @brief Exibe a melhor solução encontrada pelo algoritmo de backtracking.
@@ -765,7 +48,8 @@ void exibir_solucao_backtracking(ProblemaBacktracking *problema)
     {
         for (int i = 0; i < problema->n_melhor_solucao; i++)
         {
-            printf("  Intervalo %d: [%d, %d]\n", i + 1, problema->melhor_solucao[i].inicio, problema->melhor_solucao[i].fim);
+            printf("  Intervalo %d: [%lld, %lld]\n", i + 1, coordenada_original(&problema->coordenadas, problema->melhor_solucao[i].inicio),
+                   coordenada_original(&problema->coordenadas, problema->melhor_solucao[i].fim));
         }
 
         pontos_cobertos = (int *)calloc(problema->n_pontos, sizeof(int));
@@ -777,7 +61,7 @@ void exibir_solucao_backtracking(ProblemaBacktracking *problema)
                 {
                     if (pontos_cobertos[j] == 0)
                     {
-                        if (ponto_coberto_por_intervalo_backtracking(problema->pontos[j], problema->melhor_solucao[i]))
+                        if (ponto_coberto_por_intervalo(problema->pontos[j].posicao, problema->melhor_solucao[i].inicio, problema->melhor_solucao[i].fim))
                         {
                             pontos_cobertos[j] = 1;
                             total_cobertos++;
@@ -791,7 +75,7 @@ void exibir_solucao_backtracking(ProblemaBacktracking *problema)
             {
                 if (pontos_cobertos[i])
                 {
-                    printf("  Ponto %d: %d\n", problema->pontos[i].id, problema->pontos[i].posicao);
+                    printf("  Ponto %d: %lld\n", problema->pontos[i].id, coordenada_original(&problema->coordenadas, problema->pontos[i].posicao));
                 }
             }
 
@@ -822,58 +106,77 @@ void exibir_metricas_backtracking(ProblemaBacktracking *problema)
     printf("\n=== METRICAS DO ALGORITMO BACKTRACKING ===\n");
     printf("Tempo de execucao: %.4f ms\n", problema->tempo_execucao);
     printf("Memoria utilizada: %ld KB\n", problema->memoria_utilizada);
+    printf("Pico de memoria da resolucao: %zu bytes (%" PRId64 " alocacoes)\n", problema->memoria.pico_bytes, problema->memoria.n_alocacoes);
+    printf("Profundidade maxima da busca: %d\n", problema->profundidade_maxima);
     printf("Numero de intervalos na solucao: %d\n", problema->n_melhor_solucao);
     printf("Qualidade (1 - solucao/total): %.4f\n", problema->qualidade);
-    printf("Nos visitados na arvore de busca: %d\n", problema->nos_visitados);
+    printf("Nos visitados na arvore de busca: %" PRId64 "\n", problema->nos_visitados);
+    printf("Representacao da cobertura: %s\n", problema->configuracao.usar_bitset ? "bitset" : "vetor");
+    printf("Motor de busca: %s\n", nome_motor_backtracking(problema->configuracao.motor));
+    if (problema->n_threads_utilizadas > 0)
+    {
+        printf("Busca paralela: %d threads, profundidade de divisao %d\n",
+               problema->n_threads_utilizadas, problema->configuracao.profundidade_divisao);
+        for (int t = 0; t < problema->n_threads_utilizadas; t++)
+        {
+            printf("  Thread %d: %" PRId64 " nos visitados\n", t, problema->nos_por_thread[t]);
+        }
+    }
+    if (problema->configuracao.motor == MOTOR_BACKTRACKING_LIMITADO)
+    {
+        printf("Busca limitada: %s\n", problema->busca_concluida ? "concluida (solucao otima)" : "interrompida pelo orcamento");
+        if (problema->limite_inferior == INT_MAX)
+        {
+            printf("Limitante inferior: instancia sem solucao\n");
+        }
+        else
+        {
+            printf("Limitante inferior: %d intervalos (gap: %.2f%%)\n", problema->limite_inferior, problema->gap * 100.0);
+        }
+    }
+    if (problema->reducao.aplicada)
+    {
+        printf("Reducao: %d pontos duplicados, %d pontos dominados, %d intervalos dominados removidos\n",
+               problema->reducao.pontos_duplicados, problema->reducao.pontos_dominados, problema->reducao.intervalos_dominados);
+    }
     printf("=========================================\n\n");
 }
 
 /**
- * @brief Salva em arquivo CSV as métricas do algoritmo de backtracking.
- *
- * Esta função cria um arquivo CSV contendo as métricas coletadas
- * durante a execução do algoritmo de backtracking para três cenários
- * distintos: pequeno, médio e grande.
+ * @brief Anexa as métricas dos três cenários ao repositório de resultados.
  *
- * O arquivo gerado pode ser utilizado posteriormente para:
- * - análise comparativa de desempenho;
- * - geração de gráficos;
- * - inclusão direta em relatórios acadêmicos.
+ * Cada chamada acrescenta uma linha por cenário ao repositório padrão
+ * do backtracking (`results/backtracking/file/execucoes.csv`, localizado
+ * a partir do executável), sem apagar as execuções anteriores.
  *
- * O formato do arquivo CSV é:
- * cenario, tempo_ms, memoria_kb, qualidade, n_intervalos_solucao, nos_visitados
- *
- * @param metricas_pequeno Ponteiro para as métricas do cenário pequeno.
- * @param metricas_medio   Ponteiro para as métricas do cenário médio.
- * @param metricas_grande  Ponteiro para as métricas do cenário grande.
+ * @param configuracao Opções usadas na resolução dos cenários.
+ * @param metricas Métricas de cada cenário, na ordem de `CENARIO_*`.
  */
-void salvar_csv_backtracking(MetricasBacktracking *metricas_pequeno, MetricasBacktracking *metricas_medio, MetricasBacktracking *metricas_grande)
+void salvar_metricas_backtracking(const ConfiguracaoBacktracking *configuracao, const MetricasBacktracking *metricas)
 {
-    FILE *arquivo = NULL;
-    char caminho[MAX_PATH];
+    RepositorioResultados repositorio;
+    int anexadas = 0;
+
+    if (repositorio_abrir(&repositorio, NULL, FORMATO_REGISTRO_CSV, "backtracking"))
+    {
+        for (int c = 0; c < N_CENARIOS; c++)
+        {
+            const CenarioCobertura *cenario = obter_cenario(c);
+            RegistroExecucao registro;
 
-    snprintf(caminho, MAX_PATH, "../results/backtracking/file/metricas_backtracking.csv");
+            registro_iniciar(&registro, "backtracking", cenario->nome, cenario->n_pontos, cenario->n_intervalos);
+            preencher_registro_backtracking(&registro, configuracao, &metricas[c]);
+            anexadas += repositorio_anexar(&repositorio, &registro);
+        }
+    }
 
-    arquivo = fopen(caminho, "w");
-    if (arquivo == NULL)
+    if (anexadas < N_CENARIOS)
     {
-        printf("Erro ao criar arquivo CSV. Verifique se a pasta ../results/backtracking existe.\n");
+        printf("Erro ao gravar as metricas em %s.\n", repositorio.caminho);
     }
     else
     {
-        fprintf(arquivo, "cenario,tempo_ms,memoria_kb,qualidade,n_intervalos_solucao,nos_visitados\n");
-        fprintf(arquivo, "pequeno,%.4f,%ld,%.4f,%d,%d\n",
-                metricas_pequeno->tempo, metricas_pequeno->memoria, metricas_pequeno->qualidade,
-                metricas_pequeno->n_solucao, metricas_pequeno->nos_visitados);
-        fprintf(arquivo, "medio,%.4f,%ld,%.4f,%d,%d\n",
-                metricas_medio->tempo, metricas_medio->memoria, metricas_medio->qualidade,
-                metricas_medio->n_solucao, metricas_medio->nos_visitados);
-        fprintf(arquivo, "grande,%.4f,%ld,%.4f,%d,%d\n",
-                metricas_grande->tempo, metricas_grande->memoria, metricas_grande->qualidade,
-                metricas_grande->n_solucao, metricas_grande->nos_visitados);
-
-        fclose(arquivo);
-        printf("Metricas salvas em: %s\n", caminho);
+        printf("Metricas anexadas em: %s\n", repositorio.caminho);
     }
 }
 
@@ -919,17 +222,19 @@ void executar_teste_backtracking(ProblemaBacktracking *problema, const char *nom
  * - Configuração específica de cada cenário;
  * - Execução do algoritmo de backtracking para cada cenário;
  * - Exibição das soluções e métricas obtidas;
- * - Salvamento das métricas em arquivo CSV para análise posterior;
+ * - Anexação das métricas ao repositório de resultados, para análise posterior;
  * - Liberação de toda a memória alocada.
  *
  * A função foi projetada com foco didático e experimental, permitindo
  * a comparação do comportamento do algoritmo em diferentes escalas
  * de entrada.
+ *
+ * @param configuracao Opções de execução aplicadas a todos os cenários.
  */
-void executar_todos_testes_backtracking()
+void executar_todos_testes_backtracking(const ConfiguracaoBacktracking *configuracao)
 {
     ProblemaBacktracking problema_pequeno, problema_medio, problema_grande;
-    MetricasBacktracking metricas_pequeno, metricas_medio, metricas_grande;
+    MetricasBacktracking metricas[N_CENARIOS];
 
     printf("=== EXECUTANDO TODOS OS TESTES (BACKTRACKING) ===\n");
 
@@ -937,21 +242,400 @@ void executar_todos_testes_backtracking()
     inicializar_problema_backtracking(&problema_medio);
     inicializar_problema_backtracking(&problema_grande);
 
-    configurar_cenario_pequeno_backtracking(&problema_pequeno);
-    configurar_cenario_medio_backtracking(&problema_medio);
-    configurar_cenario_grande_backtracking(&problema_grande);
+    problema_pequeno.configuracao = *configuracao;
+    problema_medio.configuracao = *configuracao;
+    problema_grande.configuracao = *configuracao;
 
-    executar_teste_backtracking(&problema_pequeno, "PEQUENO", &metricas_pequeno);
-    executar_teste_backtracking(&problema_medio, "MEDIO", &metricas_medio);
-    executar_teste_backtracking(&problema_grande, "GRANDE", &metricas_grande);
+    configurar_cenario_backtracking(&problema_pequeno, CENARIO_PEQUENO);
+    configurar_cenario_backtracking(&problema_medio, CENARIO_MEDIO);
+    configurar_cenario_backtracking(&problema_grande, CENARIO_GRANDE);
 
-    salvar_csv_backtracking(&metricas_pequeno, &metricas_medio, &metricas_grande);
+    executar_teste_backtracking(&problema_pequeno, "PEQUENO", &metricas[CENARIO_PEQUENO]);
+    executar_teste_backtracking(&problema_medio, "MEDIO", &metricas[CENARIO_MEDIO]);
+    executar_teste_backtracking(&problema_grande, "GRANDE", &metricas[CENARIO_GRANDE]);
+
+    salvar_metricas_backtracking(configuracao, metricas);
 
     liberar_problema_backtracking(&problema_pequeno);
     liberar_problema_backtracking(&problema_medio);
     liberar_problema_backtracking(&problema_grande);
 }
 
+/**
+ * @brief Executa o algoritmo de backtracking em todas as instâncias de uma origem.
+ *
+ * Lê as instâncias em sequência com `ler_instancia_backtracking` e, para
+ * cada uma, executa e exibe o teste como nos cenários fixos. A leitura
+ * para na primeira instância inválida.
+ *
+ * @param caminho Caminho do arquivo, ou "-" para a entrada padrão.
+ * @param configuracao Opções de execução aplicadas a todas as instâncias.
+ * @return Quantidade de instâncias executadas, ou -1 se a origem não pôde ser aberta.
+ */
+int executar_instancias_arquivo_backtracking(const char *caminho, const ConfiguracaoBacktracking *configuracao)
+{
+    LeitorInstancia leitor;
+    int n_instancias = 0;
+    int lida = 1;
+
+    if (leitor_abrir(&leitor, caminho) == 0)
+    {
+        printf("Erro ao abrir %s.\n", caminho);
+        return -1;
+    }
+
+    while (lida == 1)
+    {
+        ProblemaBacktracking problema;
+        MetricasBacktracking metricas;
+        char nome[64];
+
+        inicializar_problema_backtracking(&problema);
+        problema.configuracao = *configuracao;
+        lida = ler_instancia_backtracking(&leitor, &problema);
+        if (lida == 1)
+        {
+            n_instancias++;
+            snprintf(nome, sizeof(nome), "ARQUIVO #%d", n_instancias);
+            executar_teste_backtracking(&problema, nome, &metricas);
+        }
+        else if (lida == -1)
+        {
+            printf("Erro: instancia %d invalida em %s.\n", n_instancias + 1, caminho);
+        }
+        liberar_problema_backtracking(&problema);
+    }
+
+    leitor_fechar(&leitor);
+
+    return n_instancias;
+}
+
+/**
+ * @brief Exibe as opções de linha de comando do modo em lote.
+ *
+ * @param programa Nome do executável, usado nos exemplos.
+ */
+void exibir_uso_lote_backtracking(const char *programa)
+{
+    fprintf(stderr, "Uso: %s [opcoes] --entrada <arquivo|-> | --manifesto <arquivo> | --gerar <especificacao> ...\n", programa);
+    fprintf(stderr, "  --entrada <arquivo|->    resolve as instancias do arquivo (ou da entrada padrao)\n");
+    fprintf(stderr, "  --manifesto <arquivo>    resolve as origens listadas no manifesto, uma por linha\n");
+    fprintf(stderr, "  --gerar <d:n:m:semente>  resolve uma instancia gerada com n pontos e m intervalos na distribuicao d\n");
+    fprintf(stderr, "                           (uniforme, agrupada, sobreposta, aninhada ou adversaria)\n");
+    fprintf(stderr, "  --saida <arquivo>        grava os resultados no arquivo (padrao: saida padrao)\n");
+    fprintf(stderr, "  --motor <nome>           classico, poda, paralelo, iterativo, limitado ou dinamica\n");
+    fprintf(stderr, "  --bitset                 representa a cobertura em bitset\n");
+    fprintf(stderr, "  --reducao                aplica a reducao previa da instancia\n");
+    fprintf(stderr, "  --threads <n>            threads do motor paralelo\n");
+    fprintf(stderr, "  --profundidade <n>       profundidade de divisao do motor paralelo (0 a %d)\n", MAX_PROFUNDIDADE_DIVISAO);
+    fprintf(stderr, "  --tempo-ms <ms>          tempo limite do motor limitado (0 desativa)\n");
+    fprintf(stderr, "  --nos <n>                limite de nos do motor limitado (0 desativa)\n");
+    fprintf(stderr, "  --repeticoes <n>         mede n execucoes por instancia e registra as estatisticas dos tempos\n");
+    fprintf(stderr, "  --aquecimento <n>        execucoes descartadas antes das medidas\n");
+    fprintf(stderr, "  --cpu <n>                fixa o processo na CPU n durante as medidas\n");
+    fprintf(stderr, "  --contadores             registra ciclos, instrucoes, falhas de cache e de desvio da busca\n");
+    fprintf(stderr, "  --componentes            resolve em paralelo, com --threads threads, os componentes independentes da reta\n");
+    fprintf(stderr, "  --registro <arquivo>     anexa cada execucao ao repositorio de resultados (padrao: results/backtracking/file)\n");
+    fprintf(stderr, "  --registro-binario       grava o repositorio no formato binario compacto\n");
+    fprintf(stderr, "  --comparar <solucionador> compara guloso ou varredura com o motor exato em cada instancia\n");
+    fprintf(stderr, "  --cache <MB>             reaproveita solucoes de instancias repetidas (a menos de translacao) em um cache de MB megabytes\n");
+    fprintf(stderr, "Modo servidor: %s [opcoes] --servidor <-|socket>\n", programa);
+    fprintf(stderr, "  --servidor <-|socket>    resolve as requisicoes da entrada padrao ou das conexoes ao socket Unix\n");
+    fprintf(stderr, "  --motor-pequenas <nome>  motor dos lotes de instancias pequenas (padrao: dinamica)\n");
+    fprintf(stderr, "  --motor-grandes <nome>   motor das instancias maiores (padrao: dinamica)\n");
+    fprintf(stderr, "                           (outros motores rodam sob o limitado, sequencial)\n");
+    fprintf(stderr, "  --trabalhadores <n>      threads que resolvem os lotes de instancias pequenas (padrao: 1)\n");
+    fprintf(stderr, "  --lote <n>               maximo de instancias pequenas por lote (padrao: %d)\n", TAMANHO_LOTE_SERVIDOR);
+    fprintf(stderr, "  --prazo-ms <ms>          prazo das requisicoes que nao informam um (0: sem prazo)\n");
+    fprintf(stderr, "                           (sem prazo, motores exponenciais usam o limitado com %.0f ms)\n", ORCAMENTO_PADRAO_SERVIDOR_MS);
+    fprintf(stderr, "  --max-elementos <n>      maximo de pontos e de intervalos por requisicao (padrao: %d)\n", MAX_ELEMENTOS_SERVIDOR);
+}
+
+/**
+ * @brief Executa o modo em lote a partir dos argumentos de linha de comando.
+ *
+ * As opções de configuração são aplicadas primeiro, de modo que valem
+ * para todas as origens, independentemente da ordem em que aparecem.
+ * Cada `--entrada`, `--manifesto` e `--gerar` vira uma origem do lote,
+ * na ordem dada, e o lote inteiro é resolvido por `executar_lote`.
+ * Com `--servidor`, em vez das origens, executa o modo servidor
+ * (`executar_servidor_backtracking`) com as mesmas opções.
+ *
+ * @param argc Quantidade de argumentos.
+ * @param argv Argumentos recebidos por `main`.
+ * @param configuracao Configuração padrão, ajustada pelas opções.
+ * @return 0 se todas as origens foram resolvidas, 1 caso contrário.
+ */
+int executar_lote_backtracking(int argc, char **argv, ConfiguracaoBacktracking *configuracao)
+{
+    const char *endereco_servidor = NULL;
+    int motor_pequenas = MOTOR_BACKTRACKING_DINAMICA;
+    int motor_grandes = MOTOR_BACKTRACKING_DINAMICA;
+    int n_trabalhadores = 1;
+    int tamanho_lote = TAMANHO_LOTE_SERVIDOR;
+    double prazo_padrao_ms = 0.0;
+    int max_elementos = MAX_ELEMENTOS_SERVIDOR;
+    OrigemLote *origens = (OrigemLote *)malloc(((size_t)argc / 2 + 1) * sizeof(OrigemLote));
+    ConfiguracaoLote lote;
+    int resultado = -1;
+    int i;
+
+    memset(&lote, 0, sizeof(lote));
+    lote.programa = PROGRAMA_BACKTRACKING;
+    lote.configuracao = configuracao;
+    lote.formato_registro = FORMATO_REGISTRO_CSV;
+    lote.medicao.cpu = -1;
+    lote.medicao.guloso_comparado = -1;
+    lote.origens = origens;
+
+    if (origens == NULL)
+    {
+        fprintf(stderr, "Erro: memoria insuficiente para as origens do lote.\n");
+        resultado = 1;
+    }
+
+    for (i = 1; resultado < 0 && i < argc; i++)
+    {
+        const char *opcao = argv[i];
+        const char *valor = i + 1 < argc ? argv[i + 1] : NULL;
+        char *fim = NULL;
+
+        if (strcmp(opcao, "--bitset") == 0)
+        {
+            configuracao->usar_bitset = 1;
+            continue;
+        }
+        if (strcmp(opcao, "--reducao") == 0)
+        {
+            configuracao->aplicar_reducao = 1;
+            continue;
+        }
+        if (strcmp(opcao, "--contadores") == 0)
+        {
+            configuracao->medir_contadores = 1;
+            continue;
+        }
+        if (strcmp(opcao, "--componentes") == 0)
+        {
+            configuracao->decompor = 1;
+            continue;
+        }
+        if (strcmp(opcao, "--registro-binario") == 0)
+        {
+            lote.formato_registro = FORMATO_REGISTRO_BINARIO;
+            lote.registrar = 1;
+            continue;
+        }
+        if (strcmp(opcao, "--ajuda") == 0)
+        {
+            exibir_uso_lote_backtracking(argv[0]);
+            resultado = 0;
+            continue;
+        }
+        if (valor == NULL)
+        {
+            fprintf(stderr, "Erro: opcao %s desconhecida ou sem valor.\n", opcao);
+            exibir_uso_lote_backtracking(argv[0]);
+            resultado = 1;
+            continue;
+        }
+
+        i++;
+        if (strcmp(opcao, "--entrada") == 0 || strcmp(opcao, "--manifesto") == 0 || strcmp(opcao, "--gerar") == 0)
+        {
+            origens[lote.n_origens].tipo = strcmp(opcao, "--entrada") == 0     ? ORIGEM_LOTE_ENTRADA
+                                           : strcmp(opcao, "--manifesto") == 0 ? ORIGEM_LOTE_MANIFESTO
+                                                                               : ORIGEM_LOTE_GERADA;
+            origens[lote.n_origens].valor = valor;
+            lote.n_origens++;
+        }
+        else if (strcmp(opcao, "--saida") == 0)
+        {
+            lote.caminho_saida = valor;
+        }
+        else if (strcmp(opcao, "--servidor") == 0)
+        {
+            endereco_servidor = valor;
+        }
+        else if (strcmp(opcao, "--motor-pequenas") == 0)
+        {
+            motor_pequenas = motor_por_nome_backtracking(valor);
+            if (motor_pequenas < 0)
+            {
+                fprintf(stderr, "Erro: motor %s desconhecido.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--motor-grandes") == 0)
+        {
+            motor_grandes = motor_por_nome_backtracking(valor);
+            if (motor_grandes < 0)
+            {
+                fprintf(stderr, "Erro: motor %s desconhecido.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--trabalhadores") == 0)
+        {
+            n_trabalhadores = (int)strtol(valor, &fim, 10);
+            if (*fim != '\0' || n_trabalhadores < 1)
+            {
+                fprintf(stderr, "Erro: quantidade de trabalhadores invalida: %s.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--lote") == 0)
+        {
+            tamanho_lote = (int)strtol(valor, &fim, 10);
+            if (*fim != '\0' || tamanho_lote < 1)
+            {
+                fprintf(stderr, "Erro: tamanho de lote invalido: %s.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--prazo-ms") == 0)
+        {
+            prazo_padrao_ms = strtod(valor, &fim);
+            if (*fim != '\0' || prazo_padrao_ms < 0.0)
+            {
+                fprintf(stderr, "Erro: prazo invalido: %s.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--max-elementos") == 0)
+        {
+            max_elementos = (int)strtol(valor, &fim, 10);
+            if (*fim != '\0' || max_elementos < 1 || max_elementos > MAX_ELEMENTOS_INSTANCIA)
+            {
+                fprintf(stderr, "Erro: maximo de elementos invalido: %s.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--comparar") == 0)
+        {
+            lote.medicao.guloso_comparado = solucionador_por_nome(valor);
+            if (lote.medicao.guloso_comparado != SOLUCIONADOR_GULOSO && lote.medicao.guloso_comparado != SOLUCIONADOR_VARREDURA)
+            {
+                fprintf(stderr, "Erro: guloso %s desconhecido.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--registro") == 0)
+        {
+            lote.caminho_registro = strcmp(valor, "padrao") == 0 ? NULL : valor;
+            lote.registrar = 1;
+        }
+        else if (strcmp(opcao, "--motor") == 0)
+        {
+            configuracao->motor = motor_por_nome_backtracking(valor);
+            if (configuracao->motor < 0)
+            {
+                fprintf(stderr, "Erro: motor %s desconhecido.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--threads") == 0)
+        {
+            configuracao->n_threads = (int)strtol(valor, &fim, 10);
+            if (*fim != '\0' || configuracao->n_threads < 1)
+            {
+                fprintf(stderr, "Erro: quantidade de threads invalida: %s.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--profundidade") == 0)
+        {
+            configuracao->profundidade_divisao = (int)strtol(valor, &fim, 10);
+            if (*fim != '\0' || configuracao->profundidade_divisao < 0 || configuracao->profundidade_divisao > MAX_PROFUNDIDADE_DIVISAO)
+            {
+                fprintf(stderr, "Erro: profundidade invalida: %s.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--tempo-ms") == 0)
+        {
+            configuracao->limite_tempo_ms = strtod(valor, &fim);
+            if (*fim != '\0' || configuracao->limite_tempo_ms < 0.0)
+            {
+                fprintf(stderr, "Erro: tempo limite invalido: %s.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--nos") == 0)
+        {
+            configuracao->limite_nos = strtoll(valor, &fim, 10);
+            if (*fim != '\0' || configuracao->limite_nos < 0)
+            {
+                fprintf(stderr, "Erro: limite de nos invalido: %s.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--repeticoes") == 0)
+        {
+            lote.medicao.repeticoes = (int)strtol(valor, &fim, 10);
+            if (*fim != '\0' || lote.medicao.repeticoes < 0)
+            {
+                fprintf(stderr, "Erro: quantidade de repeticoes invalida: %s.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--aquecimento") == 0)
+        {
+            lote.medicao.aquecimento = (int)strtol(valor, &fim, 10);
+            if (*fim != '\0' || lote.medicao.aquecimento < 0)
+            {
+                fprintf(stderr, "Erro: quantidade de execucoes de aquecimento invalida: %s.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--cpu") == 0)
+        {
+            lote.medicao.cpu = (int)strtol(valor, &fim, 10);
+            if (*fim != '\0' || lote.medicao.cpu < 0)
+            {
+                fprintf(stderr, "Erro: CPU invalida: %s.\n", valor);
+                resultado = 1;
+            }
+        }
+        else if (strcmp(opcao, "--cache") == 0)
+        {
+            lote.megabytes_cache = strtol(valor, &fim, 10);
+            if (*fim != '\0' || lote.megabytes_cache < 1 || lote.megabytes_cache > (long)(SIZE_MAX >> 20))
+            {
+                fprintf(stderr, "Erro: tamanho de cache invalido: %s.\n", valor);
+                resultado = 1;
+            }
+        }
+        else
+        {
+            fprintf(stderr, "Erro: opcao %s desconhecida.\n", opcao);
+            exibir_uso_lote_backtracking(argv[0]);
+            resultado = 1;
+        }
+    }
+
+    if (resultado < 0 && endereco_servidor != NULL)
+    {
+        resultado = executar_servidor_backtracking(endereco_servidor, configuracao, motor_pequenas, motor_grandes, n_trabalhadores,
+                                                   tamanho_lote, prazo_padrao_ms, max_elementos);
+    }
+    else if (resultado < 0 && lote.n_origens == 0)
+    {
+        fprintf(stderr, "Erro: informe ao menos uma --entrada, --manifesto ou --gerar.\n");
+        exibir_uso_lote_backtracking(argv[0]);
+        resultado = 1;
+    }
+    else if (resultado < 0)
+    {
+        resultado = executar_lote(&lote);
+    }
+
+    free(origens);
+
+    return resultado;
+}
+
 /**
  * @brief Exibe o menu interativo do algoritmo de backtracking.
  *
@@ -963,13 +647,21 @@ void executar_todos_testes_backtracking()
  * - Execução individual dos cenários pequeno, médio ou grande;
  * - Execução de todos os cenários em sequência, com geração de arquivo CSV
  *   contendo as métricas coletadas;
+ * - Alternância da representação da cobertura (vetor de contadores ou bitset);
+ * - Alternância do motor de busca (clássico, com poda, paralelo, iterativo, limitado ou programação dinâmica);
+ * - Alternância da redução prévia de pontos e intervalos redundantes;
+ * - Configuração das threads e da profundidade de divisão do motor paralelo;
+ * - Configuração dos orçamentos e do progresso do motor limitado;
+ * - Execução das instâncias lidas de um arquivo ou da entrada padrão;
  * - Encerramento do programa.
  *
  * A função não realiza leitura de entrada nem processamento lógico,
  * sendo responsável exclusivamente pela exibição textual do menu.
+ *
+ * @param configuracao Opções de execução atuais, exibidas no menu.
  */
 
-void exibir_menu_backtracking() {
+void exibir_menu_backtracking(const ConfiguracaoBacktracking *configuracao) {
     printf("\n=== PROBLEMA DA COBERTURA DE PONTOS COM INTERVALOS ===\n");
     printf("ALGORITMO: BACKTRACKING\n");
     printf("\nMenu de opcoes:\n");
@@ -977,7 +669,14 @@ void exibir_menu_backtracking() {
     printf("2. Executar cenario MEDIO (10 pontos, 12 intervalos)\n");
     printf("3. Executar cenario GRANDE (12 pontos, 15 intervalos)\n");
     printf("4. Executar TODOS os cenarios e gerar CSV\n");
-    printf("5. Sair\n");
+    printf("5. Alternar representacao da cobertura (atual: %s)\n", configuracao->usar_bitset ? "bitset" : "vetor");
+    printf("6. Alternar motor de busca (atual: %s)\n", nome_motor_backtracking(configuracao->motor));
+    printf("7. Alternar reducao de pontos e intervalos redundantes (atual: %s)\n", configuracao->aplicar_reducao ? "ativa" : "inativa");
+    printf("8. Configurar busca paralela (threads: %d, profundidade: %d)\n", configuracao->n_threads, configuracao->profundidade_divisao);
+    printf("9. Configurar busca limitada (tempo: %.1f ms, nos: %" PRId64 ", progresso: %.1f ms)\n",
+           configuracao->limite_tempo_ms, configuracao->limite_nos, configuracao->intervalo_progresso_ms);
+    printf("10. Executar instancias de um arquivo (texto ou binario; - para a entrada padrao)\n");
+    printf("11. Sair\n");
     printf("\nEscolha uma opcao: ");
 }
 
@@ -990,6 +689,12 @@ void exibir_menu_backtracking() {
  * A função apresenta ao usuário opções para:
  * - Executar individualmente os cenários pequeno, médio ou grande;
  * - Executar todos os cenários em sequência e gerar um arquivo CSV com métricas;
+ * - Alternar a representação da cobertura entre vetor de contadores e bitset;
+ * - Alternar o motor de busca entre o clássico, o com poda, o paralelo, o iterativo, o limitado e o de programação dinâmica;
+ * - Ativar ou desativar a redução prévia da instância;
+ * - Definir as threads e a profundidade de divisão do motor paralelo;
+ * - Definir os orçamentos de tempo e de nós e o intervalo de progresso do motor limitado;
+ * - Executar as instâncias de um arquivo (texto ou binário) ou da entrada padrão;
  * - Encerrar a execução do programa.
  *
  * O fluxo principal consiste em:
@@ -1000,20 +705,56 @@ void exibir_menu_backtracking() {
  *
  * A execução continua em loop até que o usuário escolha a opção de saída.
  *
- * @return Retorna 0 após o encerramento normal do programa.
+ * Quando recebe argumentos de linha de comando, o menu não é exibido:
+ * o programa executa o modo em lote de `executar_lote_backtracking`,
+ * resolvendo todas as origens informadas em um único processo.
+ *
+ * @param argc Quantidade de argumentos de linha de comando.
+ * @param argv Argumentos de linha de comando.
+ * @return Retorna 0 após o encerramento normal do programa, ou 1 se o modo em lote falhou.
  */
-int main()
+int main(int argc, char **argv)
 {
     int opcao = 0;
     int executando = 1;
+    int lidos = 0;
+    int caractere = 0;
+    ConfiguracaoBacktracking configuracao;
+
+    configuracao.usar_bitset = 0;
+    configuracao.motor = MOTOR_BACKTRACKING_CLASSICO;
+    configuracao.aplicar_reducao = 0;
+    configuracao.medir_contadores = 0;
+    configuracao.decompor = 0;
+    configuracao.n_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (configuracao.n_threads < 1)
+    {
+        configuracao.n_threads = 1;
+    }
+    configuracao.profundidade_divisao = PROFUNDIDADE_DIVISAO_PADRAO;
+    configuracao.limite_tempo_ms = 0.0;
+    configuracao.limite_nos = 0;
+    configuracao.intervalo_progresso_ms = 0.0;
+
+    if (argc > 1)
+    {
+        return executar_lote_backtracking(argc, argv, &configuracao);
+    }
 
     while (executando)
     {
-        exibir_menu_backtracking();
+        exibir_menu_backtracking(&configuracao);
+
+        lidos = scanf("%d", &opcao);
+        if (lidos == EOF)
+        {
+            executando = 0;
+            continue;
+        }
 
-        if (scanf("%d", &opcao) != 1)
+        if (lidos != 1)
         {
-            while (getchar() != '\n')
+            while ((caractere = getchar()) != '\n' && caractere != EOF)
             {
                 continue;
             }
@@ -1028,7 +769,8 @@ int main()
             ProblemaBacktracking problema;
             MetricasBacktracking metricas;
             inicializar_problema_backtracking(&problema);
-            configurar_cenario_pequeno_backtracking(&problema);
+            problema.configuracao = configuracao;
+            configurar_cenario_backtracking(&problema, CENARIO_PEQUENO);
             executar_teste_backtracking(&problema, "PEQUENO", &metricas);
             liberar_problema_backtracking(&problema);
             break;
@@ -1038,7 +780,8 @@ int main()
             ProblemaBacktracking problema;
             MetricasBacktracking metricas;
             inicializar_problema_backtracking(&problema);
-            configurar_cenario_medio_backtracking(&problema);
+            problema.configuracao = configuracao;
+            configurar_cenario_backtracking(&problema, CENARIO_MEDIO);
             executar_teste_backtracking(&problema, "MEDIO", &metricas);
             liberar_problema_backtracking(&problema);
             break;
@@ -1048,17 +791,96 @@ int main()
             ProblemaBacktracking problema;
             MetricasBacktracking metricas;
             inicializar_problema_backtracking(&problema);
-            configurar_cenario_grande_backtracking(&problema);
+            problema.configuracao = configuracao;
+            configurar_cenario_backtracking(&problema, CENARIO_GRANDE);
             executar_teste_backtracking(&problema, "GRANDE", &metricas);
             liberar_problema_backtracking(&problema);
             break;
         }
         case 4:
         {
-            executar_todos_testes_backtracking();
+            executar_todos_testes_backtracking(&configuracao);
             break;
         }
         case 5:
+        {
+            configuracao.usar_bitset = !configuracao.usar_bitset;
+            printf("Representacao da cobertura: %s\n", configuracao.usar_bitset ? "bitset" : "vetor");
+            break;
+        }
+        case 6:
+        {
+            configuracao.motor = (configuracao.motor + 1) % N_MOTORES_BACKTRACKING;
+            printf("Motor de busca: %s\n", nome_motor_backtracking(configuracao.motor));
+            break;
+        }
+        case 7:
+        {
+            configuracao.aplicar_reducao = !configuracao.aplicar_reducao;
+            printf("Reducao: %s\n", configuracao.aplicar_reducao ? "ativa" : "inativa");
+            break;
+        }
+        case 8:
+        {
+            int n_threads = 0;
+            int profundidade = 0;
+            printf("Quantidade de threads e profundidade de divisao (0 a %d): ", MAX_PROFUNDIDADE_DIVISAO);
+            if (scanf("%d %d", &n_threads, &profundidade) != 2 || n_threads < 1 || profundidade < 0 || profundidade > MAX_PROFUNDIDADE_DIVISAO)
+            {
+                while ((caractere = getchar()) != '\n' && caractere != EOF)
+                {
+                    continue;
+                }
+                printf("Entrada invalida. Configuracao mantida.\n");
+            }
+            else
+            {
+                configuracao.n_threads = n_threads;
+                configuracao.profundidade_divisao = profundidade;
+                printf("Busca paralela: %d threads, profundidade de divisao %d\n", n_threads, profundidade);
+            }
+            break;
+        }
+        case 9:
+        {
+            double limite_tempo_ms = 0.0;
+            int64_t limite_nos = 0;
+            double intervalo_progresso_ms = 0.0;
+            printf("Tempo limite (ms), limite de nos e intervalo de progresso (ms), 0 para nao limitar: ");
+            if (scanf("%lf %" SCNd64 " %lf", &limite_tempo_ms, &limite_nos, &intervalo_progresso_ms) != 3 ||
+                limite_tempo_ms < 0.0 || limite_nos < 0 || intervalo_progresso_ms < 0.0)
+            {
+                while ((caractere = getchar()) != '\n' && caractere != EOF)
+                {
+                    continue;
+                }
+                printf("Entrada invalida. Configuracao mantida.\n");
+            }
+            else
+            {
+                configuracao.limite_tempo_ms = limite_tempo_ms;
+                configuracao.limite_nos = limite_nos;
+                configuracao.intervalo_progresso_ms = intervalo_progresso_ms;
+                printf("Busca limitada: tempo %.1f ms, %" PRId64 " nos, progresso a cada %.1f ms\n",
+                       limite_tempo_ms, limite_nos, intervalo_progresso_ms);
+            }
+            break;
+        }
+        case 10:
+        {
+            char caminho[MAX_PATH];
+            printf("Caminho do arquivo de instancias: ");
+            if (scanf("%1023s", caminho) == 1)
+            {
+                int n_instancias = executar_instancias_arquivo_backtracking(caminho, &configuracao);
+                if (n_instancias >= 0)
+                {
+                    printf("%d instancia(s) executada(s).\n", n_instancias);
+                }
+            }
+            break;
+        }
+        case 11:
         {
             printf("Encerrando programa...\n");
             executando = 0;
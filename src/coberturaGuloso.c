@@ -1,812 +1,429 @@
+#define _GNU_SOURCE
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
 #include <sys/resource.h>
 #include <math.h>
+#include <limits.h>
+#include <stdint.h>
+#include <sched.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-#define MAX_PONTOS 1000
-#define MAX_INTERVALOS 1000
-#define MAX_PATH 1024
-
-/**
- * @struct Intervalo
- * @brief Representa um intervalo fechado na reta numérica.
- *
- * Esta estrutura é utilizada pelo algoritmo guloso para modelar
- * intervalos que podem cobrir pontos em uma dimensão linear.
- * Um ponto é considerado coberto se sua posição estiver entre
- * o início e o fim do intervalo (inclusive).
- *
- * No problema da cobertura de pontos, o objetivo é selecionar
- * um subconjunto mínimo desses intervalos capaz de cobrir
- * todos os pontos definidos.
- */
-typedef struct
-{
-    int inicio; /**< Limite inicial do intervalo (inclusive). */
-    int fim; /**< Limite final do intervalo (inclusive). */
-} Intervalo;
-
-/**
- * @struct Ponto
- * @brief Representa um ponto na reta numérica a ser coberto por intervalos.
- *
- * Cada ponto possui um identificador único e uma posição inteira
- * na reta numérica. No problema da cobertura de pontos, um ponto
- * é considerado coberto se existir ao menos um intervalo cujo
- * início e fim englobem sua posição.
- *
- * Essa estrutura é utilizada pelo algoritmo guloso para verificar
- * a cobertura dos pontos e auxiliar na escolha dos intervalos
- * mais adequados durante a execução do algoritmo.
- */
-typedef struct
-{
-    int id; /**< Identificador único do ponto. */
-    int posicao; /**< Posição do ponto na reta numérica. */
-} Ponto;
+#include "solucionadorGuloso.h"
 
-/**
- * @struct Problema
- * @brief Estrutura que encapsula todos os dados e métricas do problema
- *        de cobertura de pontos com intervalos utilizando algoritmo guloso.
- *
- * Esta estrutura armazena:
- * - Os pontos que devem ser cobertos;
- * - Os intervalos disponíveis para realizar a cobertura;
- * - O estado atual da cobertura durante a execução do algoritmo guloso;
- * - A solução construída incrementalmente;
- * - As métricas de desempenho obtidas ao final da execução.
- *
- * No algoritmo guloso, os intervalos são selecionados iterativamente
- * com base em um critério de escolha (por exemplo, o intervalo que
- * cobre o maior número de pontos ainda não cobertos), até que todos
- * os pontos estejam cobertos ou não haja mais intervalos viáveis.
- */
-typedef struct
-{
-    Intervalo *intervalos; /**< Vetor de intervalos disponíveis para cobertura. */
-    int n_intervalos; /**< Quantidade total de intervalos disponíveis. */
-    Ponto *pontos; /**< Vetor de pontos que devem ser cobertos. */
-    int n_pontos; /**< Quantidade total de pontos. */
-    int *pontos_cobertos; /**< Vetor auxiliar que indica se cada ponto já foi coberto (0 ou 1). */
-    int n_pontos_cobertos; /**< Número total de pontos já cobertos durante a execução. */
-    Intervalo *solucao; /**< Vetor de intervalos escolhidos pelo algoritmo guloso. */
-    int n_solucao; /**< Quantidade de intervalos presentes na solução gulosa. */
-    double tempo_execucao; /**< Tempo total de execução do algoritmo, em milissegundos. */
-    long memoria_utilizada; /**< Memória utilizada pelo algoritmo, em kilobytes. */
-    double qualidade; /**< Métrica de qualidade da solução obtida pelo algoritmo guloso. */
-} Problema;
+#define MAX_PATH 1024
 
 /**
- * @struct Metricas
- * @brief Estrutura que armazena as métricas de desempenho do algoritmo guloso.
- *
- * Esta estrutura é utilizada para registrar e exportar os resultados
- * obtidos após a execução do algoritmo guloso no problema de cobertura
- * de pontos com intervalos.
+ * @brief Exibe a solução encontrada pelo algoritmo guloso.
  *
- * As métricas permitem avaliar:
- * - O desempenho temporal do algoritmo;
- * - O consumo de memória;
- * - A qualidade da solução encontrada;
- * - O tamanho da solução gerada.
+ * Mostra os intervalos selecionados e os pontos efetivamente cobertos.
  *
- * Esses dados são úteis para análises comparativas com outros algoritmos,
- * como o backtracking.
+ * @param problema Ponteiro para a estrutura do problema
  */
-typedef struct
+void exibir_solucao(Problema *problema)
 {
-    double tempo; /**< Tempo total de execução do algoritmo, em milissegundos. */
-    long memoria; /**< Memória utilizada durante a execução, em kilobytes. */
-    double qualidade; /**< Qualidade da solução gulosa obtida. */
-    int n_solucao; /**< Número de intervalos selecionados na solução final. */
-} Metricas;
+    printf("Solucao encontrada (%d intervalos):\n", problema->n_solucao);
+    for (int i = 0; i < problema->n_solucao; i++)
+    {
+        printf("  Intervalo %d: [%lld, %lld]\n", i + 1, coordenada_original(&problema->coordenadas, problema->solucao[i].inicio),
+               coordenada_original(&problema->coordenadas, problema->solucao[i].fim));
+    }
 
-/**
- * @brief Inicializa a estrutura do problema para o algoritmo guloso.
- *
- * Esta função prepara a estrutura `Problema` para uso, inicializando
- * todos os ponteiros como NULL e zerando os contadores e métricas.
- *
- * Ela deve ser chamada antes de configurar qualquer cenário ou executar
- * o algoritmo guloso, garantindo que o estado inicial do problema seja
- * consistente e evitando acessos indevidos à memória.
- *
- * @param problema Ponteiro para a estrutura `Problema` a ser inicializada.
- */
-void inicializar_problema(Problema *problema)
-{
-    problema->intervalos = NULL;
-    problema->pontos = NULL;
-    problema->pontos_cobertos = NULL;
-    problema->solucao = NULL;
-    problema->n_intervalos = 0;
-    problema->n_pontos = 0;
-    problema->n_pontos_cobertos = 0;
-    problema->n_solucao = 0;
-    problema->tempo_execucao = 0.0;
-    problema->memoria_utilizada = 0;
-    problema->qualidade = 0.0;
+    printf("\nPontos cobertos (%d de %d):\n", problema->n_pontos_cobertos, problema->n_pontos);
+    for (int i = 0; i < problema->n_pontos; i++)
+    {
+        if (ponto_esta_coberto(problema, i))
+        {
+            printf("  Ponto %d: %lld\n", problema->pontos[i].id, coordenada_original(&problema->coordenadas, problema->pontos[i].posicao));
+        }
+    }
 }
 
 /**
- * @brief Libera toda a memória alocada dinamicamente pelo problema guloso.
- *
- * Esta função é responsável por desalocar todos os vetores associados
- * à estrutura `Problema`, incluindo intervalos, pontos, controle de
- * cobertura e solução construída pelo algoritmo guloso.
- *
- * Após a liberação, todos os ponteiros são definidos como NULL para
- * evitar ponteiros pendentes (dangling pointers) e possíveis acessos
- * inválidos à memória.
+ * @brief Exibe as métricas do algoritmo guloso.
  *
- * Essa função deve ser chamada ao final da execução de cada cenário
- * para garantir a correta liberação de recursos.
+ * Mostra tempo de execução, memória utilizada,
+ * tamanho da solução e qualidade obtida.
  *
- * @param problema Ponteiro para a estrutura `Problema` cujos recursos
- *        serão liberados.
+ * @param problema Ponteiro para a estrutura do problema
  */
-void liberar_problema(Problema *problema)
+void exibir_metricas(Problema *problema)
 {
-    if (problema->intervalos != NULL)
-    {
-        free(problema->intervalos);
-        problema->intervalos = NULL;
-    }
-    if (problema->pontos != NULL)
-    {
-        free(problema->pontos);
-        problema->pontos = NULL;
-    }
-    if (problema->pontos_cobertos != NULL)
-    {
-        free(problema->pontos_cobertos);
-        problema->pontos_cobertos = NULL;
-    }
-    if (problema->solucao != NULL)
+    printf("\n=== METRICAS DO ALGORITMO GULOSO ===\n");
+    printf("Tempo de execucao: %.4f ms\n", problema->tempo_execucao);
+    printf("Memoria utilizada: %ld KB\n", problema->memoria_utilizada);
+    printf("Pico de memoria da resolucao: %zu bytes (%" PRId64 " alocacoes)\n", problema->memoria.pico_bytes, problema->memoria.n_alocacoes);
+    printf("Numero de intervalos na solucao: %d\n", problema->n_solucao);
+    printf("Qualidade (1 - solucao/total): %.4f\n", problema->qualidade);
+    printf("Representacao da cobertura: %s\n", problema->configuracao.usar_bitset ? "bitset" : "vetor");
+    printf("Motor guloso: %s\n", nome_motor_guloso(problema->configuracao.motor));
+    if (problema->reducao.aplicada)
     {
-        free(problema->solucao);
-        problema->solucao = NULL;
+        printf("Reducao: %d pontos duplicados, %d pontos dominados, %d intervalos dominados removidos\n",
+               problema->reducao.pontos_duplicados, problema->reducao.pontos_dominados, problema->reducao.intervalos_dominados);
     }
+    printf("====================================\n\n");
 }
 
 /**
- * @brief Função de comparação entre intervalos para ordenação no algoritmo guloso.
+ * @brief Anexa as métricas dos três cenários ao repositório de resultados.
  *
- * Esta função define o critério de ordenação dos intervalos utilizado
- * pelo algoritmo guloso. Os intervalos são ordenados primeiramente
- * pelo valor de término (`fim`) em ordem crescente.
+ * Cada chamada acrescenta uma linha por cenário ao repositório padrão
+ * do guloso (`results/guloso/file/execucoes.csv`, localizado a partir
+ * do executável), sem apagar as execuções anteriores.
  *
- * Em caso de empate no valor de término, o desempate é feito pelo
- * valor de início (`inicio`), também em ordem crescente.
- *
- * Esse critério é fundamental para a estratégia gulosa adotada,
- * pois prioriza intervalos que terminam mais cedo, aumentando a
- * chance de cobrir o maior número de pontos com menos intervalos.
- *
- * A função é projetada para ser utilizada com a função `qsort`.
- *
- * @param a Ponteiro para o primeiro intervalo a ser comparado.
- * @param b Ponteiro para o segundo intervalo a ser comparado.
- *
- * @return Valor negativo se `a` deve vir antes de `b`,
- *         valor positivo se `a` deve vir depois de `b`,
- *         ou zero se ambos forem considerados equivalentes
- *         segundo o critério de ordenação.
+ * @param problemas Problemas resolvidos, na ordem de `CENARIO_*`.
+ * @param metricas Métricas de cada cenário, na mesma ordem.
  */
-int comparar_intervalos(const void *a, const void *b)
+void salvar_metricas(Problema **problemas, const Metricas *metricas)
 {
-    int resultado = 0;
-    Intervalo *intervalo_a = (Intervalo *)a;
-    Intervalo *intervalo_b = (Intervalo *)b;
+    RepositorioResultados repositorio;
+    int anexadas = 0;
 
-    if (intervalo_a->fim < intervalo_b->fim)
+    if (repositorio_abrir(&repositorio, NULL, FORMATO_REGISTRO_CSV, "guloso"))
     {
-        resultado = -1;
+        for (int c = 0; c < N_CENARIOS; c++)
+        {
+            const CenarioCobertura *cenario = obter_cenario(c);
+            RegistroExecucao registro;
+
+            registro_iniciar(&registro, "guloso", cenario->nome, cenario->n_pontos, cenario->n_intervalos);
+            preencher_registro_guloso(&registro, problemas[c], &metricas[c]);
+            anexadas += repositorio_anexar(&repositorio, &registro);
+        }
     }
-    else if (intervalo_a->fim > intervalo_b->fim)
+
+    if (anexadas < N_CENARIOS)
     {
-        resultado = 1;
+        printf("Erro ao gravar as metricas em %s.\n", repositorio.caminho);
     }
     else
     {
-        if (intervalo_a->inicio < intervalo_b->inicio)
-        {
-            resultado = -1;
-        }
-        else if (intervalo_a->inicio > intervalo_b->inicio)
-        {
-            resultado = 1;
-        }
-        else
-        {
-            resultado = 0;
-        }
+        printf("Metricas anexadas em: %s\n", repositorio.caminho);
     }
-
-    return resultado;
 }
 
 /**
- * @brief Compara dois pontos com base na posição no eixo.
- *
- * Ordena os pontos em ordem crescente de posição. Essa ordenação
- * facilita a identificação do próximo ponto ainda não coberto
- * durante a execução do algoritmo guloso.
+ * @brief Executa um teste individual do algoritmo guloso.
  *
- * Função compatível com `qsort`.
+ * Resolve o problema para um cenário específico,
+ * exibindo a solução e suas métricas.
  *
- * @param a Ponteiro para o primeiro ponto.
- * @param b Ponteiro para o segundo ponto.
- * @return Valor negativo, positivo ou zero conforme a ordem relativa.
+ * @param problema Ponteiro para a estrutura do problema
+ * @param nome_cenario Nome identificador do cenário
+ * @param metricas Ponteiro para a estrutura de métricas
  */
-int comparar_pontos(const void *a, const void *b)
+void executar_teste(Problema *problema, const char *nome_cenario, Metricas *metricas)
 {
-    int resultado = 0;
-    Ponto *ponto_a = (Ponto *)a;
-    Ponto *ponto_b = (Ponto *)b;
+    printf("\n=== EXECUTANDO CENARIO %s ===\n", nome_cenario);
+    printf("Pontos: %d, Intervalos: %d\n", problema->n_pontos, problema->n_intervalos);
 
-    if (ponto_a->posicao < ponto_b->posicao)
-    {
-        resultado = -1;
-    }
-    else if (ponto_a->posicao > ponto_b->posicao)
-    {
-        resultado = 1;
-    }
-    else
-    {
-        resultado = 0;
-    }
+    *metricas = resolver_guloso(problema);
 
-    return resultado;
+    exibir_solucao(problema);
+    exibir_metricas(problema);
 }
 
 /**
- * @brief Configura o cenário pequeno do problema de cobertura de pontos.
- *
- * Inicializa um conjunto determinístico de 8 pontos e 10 intervalos,
- * garantindo que todos os pontos possam ser cobertos.
+ * @brief Executa todos os cenários disponíveis.
  *
- * Os intervalos são ordenados conforme o critério guloso antes da
- * execução do algoritmo.
+ * Roda os cenários pequeno, médio e grande, coleta as métricas
+ * e as anexa ao repositório de resultados.
  *
- * @param problema Ponteiro para a estrutura do problema.
+ * @param configuracao Opções de execução aplicadas a todos os cenários
  */
-void configurar_cenario_pequeno(Problema *problema) {
-    // 8 pontos fixos
-    problema->n_pontos = 8;
-    problema->pontos = (Ponto *)malloc(8 * sizeof(Ponto));
-    problema->pontos[0] = (Ponto){1, 5};
-    problema->pontos[1] = (Ponto){2, 10};
-    problema->pontos[2] = (Ponto){3, 15};
-    problema->pontos[3] = (Ponto){4, 20};
-    problema->pontos[4] = (Ponto){5, 25};
-    problema->pontos[5] = (Ponto){6, 30};
-    problema->pontos[6] = (Ponto){7, 35};
-    problema->pontos[7] = (Ponto){8, 40};
-    
-    // 10 intervalos fixos que cobrem todos os pontos
-    problema->n_intervalos = 10;
-    problema->intervalos = (Intervalo *)malloc(10 * sizeof(Intervalo));
-    problema->intervalos[0] = (Intervalo){0, 12};
-    problema->intervalos[1] = (Intervalo){8, 22};
-    problema->intervalos[2] = (Intervalo){15, 28};
-    problema->intervalos[3] = (Intervalo){25, 42};
-    problema->intervalos[4] = (Intervalo){5, 18};
-    problema->intervalos[5] = (Intervalo){18, 32};
-    problema->intervalos[6] = (Intervalo){30, 45};
-    problema->intervalos[7] = (Intervalo){3, 15};
-    problema->intervalos[8] = (Intervalo){20, 35};
-    problema->intervalos[9] = (Intervalo){12, 26};
-    
-    qsort(problema->intervalos, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos);
-}
+void executar_todos_testes(const ConfiguracaoGuloso *configuracao)
+{
+    Problema problema_pequeno, problema_medio, problema_grande;
+    Problema *problemas[N_CENARIOS] = {&problema_pequeno, &problema_medio, &problema_grande};
+    Metricas metricas[N_CENARIOS];
 
-/**
- * @brief Configura o cenário médio do problema de cobertura de pontos.
- *
- * Inicializa um conjunto determinístico de 10 pontos e 12 intervalos,
- * com maior complexidade em relação ao cenário pequeno.
- *
- * Os intervalos são ordenados de acordo com o critério guloso.
- *
- * @param problema Ponteiro para a estrutura do problema.
- */
-void configurar_cenario_medio(Problema *problema) {
-    // 10 pontos fixos
-    problema->n_pontos = 10;
-    problema->pontos = (Ponto *)malloc(10 * sizeof(Ponto));
-    problema->pontos[0] = (Ponto){1, 8};
-    problema->pontos[1] = (Ponto){2, 16};
-    problema->pontos[2] = (Ponto){3, 24};
-    problema->pontos[3] = (Ponto){4, 32};
-    problema->pontos[4] = (Ponto){5, 40};
-    problema->pontos[5] = (Ponto){6, 48};
-    problema->pontos[6] = (Ponto){7, 56};
-    problema->pontos[7] = (Ponto){8, 64};
-    problema->pontos[8] = (Ponto){9, 72};
-    problema->pontos[9] = (Ponto){10, 80};
-    
-    // 12 intervalos fixos que cobrem todos os pontos
-    problema->n_intervalos = 12;
-    problema->intervalos = (Intervalo *)malloc(12 * sizeof(Intervalo));
-    problema->intervalos[0] = (Intervalo){0, 20};
-    problema->intervalos[1] = (Intervalo){12, 35};
-    problema->intervalos[2] = (Intervalo){25, 45};
-    problema->intervalos[3] = (Intervalo){38, 58};
-    problema->intervalos[4] = (Intervalo){50, 75};
-    problema->intervalos[5] = (Intervalo){65, 85};
-    problema->intervalos[6] = (Intervalo){5, 28};
-    problema->intervalos[7] = (Intervalo){20, 42};
-    problema->intervalos[8] = (Intervalo){35, 55};
-    problema->intervalos[9] = (Intervalo){48, 68};
-    problema->intervalos[10] = (Intervalo){60, 82};
-    problema->intervalos[11] = (Intervalo){15, 38};
-    
-    qsort(problema->intervalos, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos);
-}
+    printf("=== EXECUTANDO TODOS OS TESTES (GULOSO) ===\n");
 
-/**
- * @brief Configura o cenário grande do problema de cobertura de pontos.
- *
- * Inicializa um conjunto determinístico de 12 pontos e 15 intervalos,
- * representando o cenário mais complexo avaliado.
- *
- * Os intervalos são ordenados previamente para aplicação do algoritmo
- * guloso.
- *
- * @param problema Ponteiro para a estrutura do problema.
- */
-void configurar_cenario_grande(Problema *problema) {
-    // 12 pontos fixos
-    problema->n_pontos = 12;
-    problema->pontos = (Ponto *)malloc(12 * sizeof(Ponto));
-    problema->pontos[0] = (Ponto){1, 5};
-    problema->pontos[1] = (Ponto){2, 12};
-    problema->pontos[2] = (Ponto){3, 18};
-    problema->pontos[3] = (Ponto){4, 25};
-    problema->pontos[4] = (Ponto){5, 32};
-    problema->pontos[5] = (Ponto){6, 38};
-    problema->pontos[6] = (Ponto){7, 45};
-    problema->pontos[7] = (Ponto){8, 52};
-    problema->pontos[8] = (Ponto){9, 58};
-    problema->pontos[9] = (Ponto){10, 65};
-    problema->pontos[10] = (Ponto){11, 72};
-    problema->pontos[11] = (Ponto){12, 80};
-    
-    // 15 intervalos fixos que cobrem todos os pontos
-    problema->n_intervalos = 15;
-    problema->intervalos = (Intervalo *)malloc(15 * sizeof(Intervalo));
-    problema->intervalos[0] = (Intervalo){0, 15};
-    problema->intervalos[1] = (Intervalo){10, 28};
-    problema->intervalos[2] = (Intervalo){20, 35};
-    problema->intervalos[3] = (Intervalo){30, 48};
-    problema->intervalos[4] = (Intervalo){40, 58};
-    problema->intervalos[5] = (Intervalo){50, 68};
-    problema->intervalos[6] = (Intervalo){60, 85};
-    problema->intervalos[7] = (Intervalo){5, 20};
-    problema->intervalos[8] = (Intervalo){15, 32};
-    problema->intervalos[9] = (Intervalo){25, 42};
-    problema->intervalos[10] = (Intervalo){35, 52};
-    problema->intervalos[11] = (Intervalo){45, 62};
-    problema->intervalos[12] = (Intervalo){55, 75};
-    problema->intervalos[13] = (Intervalo){70, 85};
-    problema->intervalos[14] = (Intervalo){8, 26};
-    
-    qsort(problema->intervalos, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos);
+    inicializar_problema(&problema_pequeno);
+    inicializar_problema(&problema_medio);
+    inicializar_problema(&problema_grande);
+
+    problema_pequeno.configuracao = *configuracao;
+    problema_medio.configuracao = *configuracao;
+    problema_grande.configuracao = *configuracao;
+
+    configurar_cenario(&problema_pequeno, CENARIO_PEQUENO);
+    configurar_cenario(&problema_medio, CENARIO_MEDIO);
+    configurar_cenario(&problema_grande, CENARIO_GRANDE);
+
+    executar_teste(&problema_pequeno, "PEQUENO", &metricas[CENARIO_PEQUENO]);
+    executar_teste(&problema_medio, "MEDIO", &metricas[CENARIO_MEDIO]);
+    executar_teste(&problema_grande, "GRANDE", &metricas[CENARIO_GRANDE]);
+
+    salvar_metricas(problemas, metricas);
+
+    liberar_problema(&problema_pequeno);
+    liberar_problema(&problema_medio);
+    liberar_problema(&problema_grande);
 }
 
 /**
- * @brief Verifica se um ponto está coberto por um intervalo.
+ * @brief Executa o algoritmo guloso em todas as instâncias de uma origem.
  *
- * Determina se a posição do ponto está dentro dos limites do intervalo,
- * incluindo as extremidades.
+ * Lê as instâncias em sequência com `ler_instancia` e, para
+ * cada uma, executa e exibe o teste como nos cenários fixos. A leitura
+ * para na primeira instância inválida.
  *
- * @param ponto Estrutura representando o ponto.
- * @param intervalo Estrutura representando o intervalo.
- * @return 1 se o ponto estiver coberto, 0 caso contrário.
+ * @param caminho Caminho do arquivo, ou "-" para a entrada padrão.
+ * @param configuracao Opções de execução aplicadas a todas as instâncias.
+ * @return Quantidade de instâncias executadas, ou -1 se a origem não pôde ser aberta.
  */
-int ponto_coberto_por_intervalo(Ponto ponto, Intervalo intervalo)
+int executar_instancias_arquivo(const char *caminho, const ConfiguracaoGuloso *configuracao)
 {
-    int resultado = 0;
-    if (ponto.posicao >= intervalo.inicio && ponto.posicao <= intervalo.fim)
-    {
-        resultado = 1;
-    }
-    else
+    LeitorInstancia leitor;
+    int n_instancias = 0;
+    int lida = 1;
+
+    if (leitor_abrir(&leitor, caminho) == 0)
     {
-        resultado = 0;
+        printf("Erro ao abrir %s.\n", caminho);
+        return -1;
     }
-    return resultado;
-}
 
-/**
- * @brief Marca os pontos cobertos por um determinado intervalo.
- *
- * Atualiza o vetor de controle de cobertura, marcando como cobertos
- * todos os pontos ainda não cobertos que pertencem ao intervalo
- * selecionado.
- *
- * Também atualiza o contador total de pontos cobertos.
- *
- * @param problema Ponteiro para a estrutura do problema.
- * @param intervalo Intervalo selecionado pelo algoritmo guloso.
- */
-void marcar_pontos_cobertos(Problema *problema, Intervalo intervalo)
-{
-    for (int i = 0; i < problema->n_pontos; i++)
+    while (lida == 1)
     {
-        if (problema->pontos_cobertos[i] == 0)
+        Problema problema;
+        Metricas metricas;
+        char nome[64];
+
+        inicializar_problema(&problema);
+        problema.configuracao = *configuracao;
+        lida = ler_instancia(&leitor, &problema);
+        if (lida == 1)
         {
-            if (ponto_coberto_por_intervalo(problema->pontos[i], intervalo))
-            {
-                problema->pontos_cobertos[i] = 1;
-                problema->n_pontos_cobertos++;
-            }
+            n_instancias++;
+            snprintf(nome, sizeof(nome), "ARQUIVO #%d", n_instancias);
+            executar_teste(&problema, nome, &metricas);
         }
+        else if (lida == -1)
+        {
+            printf("Erro: instancia %d invalida em %s.\n", n_instancias + 1, caminho);
+        }
+        liberar_problema(&problema);
     }
+
+    leitor_fechar(&leitor);
+
+    return n_instancias;
 }
 
 /**
- * @brief Verifica se todos os pontos do problema já foram cobertos.
- *
- * Compara o número de pontos cobertos com o total de pontos existentes.
+ * @brief Exibe as opções de linha de comando do modo em lote.
  *
- * @param problema Ponteiro para a estrutura do problema.
- * @return 1 se todos os pontos estiverem cobertos, 0 caso contrário.
+ * @param programa Nome do executável, usado nos exemplos.
  */
-int todos_pontos_cobertos(Problema *problema)
+void exibir_uso_lote(const char *programa)
 {
-    int resultado = 0;
-    if (problema->n_pontos_cobertos == problema->n_pontos)
-    {
-        resultado = 1;
-    }
-    else
-    {
-        resultado = 0;
-    }
-    return resultado;
+    fprintf(stderr, "Uso: %s [opcoes] --entrada <arquivo|-> | --manifesto <arquivo> | --gerar <especificacao> ...\n", programa);
+    fprintf(stderr, "  --entrada <arquivo|->    resolve as instancias do arquivo (ou da entrada padrao)\n");
+    fprintf(stderr, "  --manifesto <arquivo>    resolve as origens listadas no manifesto, uma por linha\n");
+    fprintf(stderr, "  --gerar <d:n:m:semente>  resolve uma instancia gerada com n pontos e m intervalos na distribuicao d\n");
+    fprintf(stderr, "                           (uniforme, agrupada, sobreposta, aninhada ou adversaria)\n");
+    fprintf(stderr, "  --saida <arquivo>        grava os resultados no arquivo (padrao: saida padrao)\n");
+    fprintf(stderr, "  --motor <nome>           classico ou varredura\n");
+    fprintf(stderr, "  --bitset                 representa a cobertura em bitset\n");
+    fprintf(stderr, "  --reducao                aplica a reducao previa da instancia\n");
+    fprintf(stderr, "  --repeticoes <n>         mede n execucoes por instancia e registra as estatisticas dos tempos\n");
+    fprintf(stderr, "  --aquecimento <n>        execucoes descartadas antes das medidas\n");
+    fprintf(stderr, "  --cpu <n>                fixa o processo na CPU n durante as medidas\n");
+    fprintf(stderr, "  --contadores             registra ciclos, instrucoes, falhas de cache e de desvio da busca\n");
+    fprintf(stderr, "  --registro <arquivo>     anexa cada execucao ao repositorio de resultados (padrao: results/guloso/file)\n");
+    fprintf(stderr, "  --registro-binario       grava o repositorio no formato binario compacto\n");
+    fprintf(stderr, "  --edicoes <arquivo>      aplica a cada instancia as edicoes do roteiro (+p x, -p x, +i a b, -i a b) pela cobertura incremental\n");
+    fprintf(stderr, "Modo fluxo: %s [--saida <arquivo>] --fluxo <arquivo|->\n", programa);
+    fprintf(stderr, "  --fluxo <arquivo|->      resolve pela varredura os eventos ordenados (i a b, p x) a medida que sao lidos\n");
 }
 
 /**
- * @brief Obtém o índice do próximo ponto ainda não coberto.
- *
- * Percorre o vetor de pontos cobertos e retorna o índice do primeiro
- * ponto que ainda não foi coberto por nenhum intervalo selecionado.
- *
- * @param problema Ponteiro para a estrutura do problema.
- * @return Índice do ponto não coberto ou -1 se todos estiverem cobertos.
+ * @brief Executa o modo em lote a partir dos argumentos de linha de comando.
+ *
+ * As opções de configuração são aplicadas primeiro, de modo que valem
+ * para todas as origens, independentemente da ordem em que aparecem.
+ * Cada `--entrada`, `--manifesto` e `--gerar` vira uma origem do lote,
+ * na ordem dada, e o lote inteiro é resolvido por `executar_lote`.
+ * Com `--fluxo`, em vez das origens, executa `executar_fluxo`.
+ *
+ * @param argc Quantidade de argumentos.
+ * @param argv Argumentos recebidos por `main`.
+ * @param configuracao Configuração padrão, ajustada pelas opções.
+ * @return 0 se todas as origens foram resolvidas, 1 caso contrário.
  */
-int obter_proximo_ponto_nao_coberto(Problema *problema)
+int executar_lote_guloso(int argc, char **argv, ConfiguracaoGuloso *configuracao)
 {
+    const char *caminho_fluxo = NULL;
+    OrigemLote *origens = (OrigemLote *)malloc(((size_t)argc / 2 + 1) * sizeof(OrigemLote));
+    ConfiguracaoLote lote;
     int resultado = -1;
-    for (int i = 0; i < problema->n_pontos; i++)
+    int i;
+
+    memset(&lote, 0, sizeof(lote));
+    lote.programa = PROGRAMA_GULOSO;
+    lote.configuracao = configuracao;
+    lote.formato_registro = FORMATO_REGISTRO_CSV;
+    lote.medicao.cpu = -1;
+    lote.medicao.guloso_comparado = -1;
+    lote.origens = origens;
+
+    if (origens == NULL)
     {
-        if (problema->pontos_cobertos[i] == 0)
-        {
-            resultado = i;
-            break;
-        }
+        fprintf(stderr, "Erro: memoria insuficiente para as origens do lote.\n");
+        resultado = 1;
     }
-    return resultado;
-}
-
-/**
- * @brief Seleciona o melhor intervalo segundo a estratégia gulosa.
- *
- * A função avalia todos os intervalos que cobrem o ponto atualmente
- * não coberto e seleciona aquele que cobre o maior número de pontos
- * ainda descobertos.
- *
- * Em caso de empate, o intervalo de menor tamanho é escolhido como
- * critério de desempate.
- *
- * Essa estratégia busca maximizar o ganho local a cada escolha,
- * característica fundamental do algoritmo guloso.
- *
- * @param problema Ponteiro para a estrutura do problema.
- * @param indice_ponto Índice do ponto atualmente não coberto.
- * @return Índice do melhor intervalo ou -1 se nenhum for adequado.
- */
-int encontrar_melhor_intervalo(Problema *problema, int indice_ponto)
-{
-    int melhor_intervalo = -1;
-    int max_pontos_cobertos = 0;
-    Ponto ponto_atual = problema->pontos[indice_ponto];
 
-    for (int i = 0; i < problema->n_intervalos; i++)
+    for (i = 1; resultado < 0 && i < argc; i++)
     {
-        if (ponto_coberto_por_intervalo(ponto_atual, problema->intervalos[i]))
+        const char *opcao = argv[i];
+        const char *valor = i + 1 < argc ? argv[i + 1] : NULL;
+        char *fim = NULL;
+
+        if (strcmp(opcao, "--bitset") == 0)
+        {
+            configuracao->usar_bitset = 1;
+            continue;
+        }
+        if (strcmp(opcao, "--reducao") == 0)
+        {
+            configuracao->aplicar_reducao = 1;
+            continue;
+        }
+        if (strcmp(opcao, "--contadores") == 0)
+        {
+            configuracao->medir_contadores = 1;
+            continue;
+        }
+        if (strcmp(opcao, "--registro-binario") == 0)
+        {
+            lote.formato_registro = FORMATO_REGISTRO_BINARIO;
+            lote.registrar = 1;
+            continue;
+        }
+        if (strcmp(opcao, "--ajuda") == 0)
         {
-            int pontos_cobertos_potencial = 0;
+            exibir_uso_lote(argv[0]);
+            resultado = 0;
+            continue;
+        }
+        if (valor == NULL)
+        {
+            fprintf(stderr, "Erro: opcao %s desconhecida ou sem valor.\n", opcao);
+            exibir_uso_lote(argv[0]);
+            resultado = 1;
+            continue;
+        }
 
-            for (int j = 0; j < problema->n_pontos; j++)
+        i++;
+        if (strcmp(opcao, "--entrada") == 0 || strcmp(opcao, "--manifesto") == 0 || strcmp(opcao, "--gerar") == 0)
+        {
+            origens[lote.n_origens].tipo = strcmp(opcao, "--entrada") == 0     ? ORIGEM_LOTE_ENTRADA
+                                           : strcmp(opcao, "--manifesto") == 0 ? ORIGEM_LOTE_MANIFESTO
+                                                                               : ORIGEM_LOTE_GERADA;
+            origens[lote.n_origens].valor = valor;
+            lote.n_origens++;
+        }
+        else if (strcmp(opcao, "--saida") == 0)
+        {
+            lote.caminho_saida = valor;
+        }
+        else if (strcmp(opcao, "--registro") == 0)
+        {
+            lote.caminho_registro = strcmp(valor, "padrao") == 0 ? NULL : valor;
+            lote.registrar = 1;
+        }
+        else if (strcmp(opcao, "--motor") == 0)
+        {
+            configuracao->motor = motor_por_nome_guloso(valor);
+            if (configuracao->motor < 0)
             {
-                if (problema->pontos_cobertos[j] == 0)
-                {
-                    if (ponto_coberto_por_intervalo(problema->pontos[j], problema->intervalos[i]))
-                    {
-                        pontos_cobertos_potencial++;
-                    }
-                }
+                fprintf(stderr, "Erro: motor %s desconhecido.\n", valor);
+                resultado = 1;
             }
-
-            if (pontos_cobertos_potencial > max_pontos_cobertos)
+        }
+        else if (strcmp(opcao, "--repeticoes") == 0)
+        {
+            lote.medicao.repeticoes = (int)strtol(valor, &fim, 10);
+            if (*fim != '\0' || lote.medicao.repeticoes < 0)
             {
-                max_pontos_cobertos = pontos_cobertos_potencial;
-                melhor_intervalo = i;
+                fprintf(stderr, "Erro: quantidade de repeticoes invalida: %s.\n", valor);
+                resultado = 1;
             }
-            else if (pontos_cobertos_potencial == max_pontos_cobertos && pontos_cobertos_potencial > 0)
+        }
+        else if (strcmp(opcao, "--aquecimento") == 0)
+        {
+            lote.medicao.aquecimento = (int)strtol(valor, &fim, 10);
+            if (*fim != '\0' || lote.medicao.aquecimento < 0)
             {
-                if (melhor_intervalo == -1)
-                {
-                    melhor_intervalo = i;
-                }
-                else
-                {
-                    int tamanho_melhor = problema->intervalos[melhor_intervalo].fim - problema->intervalos[melhor_intervalo].inicio;
-                    int tamanho_atual = problema->intervalos[i].fim - problema->intervalos[i].inicio;
-
-                    if (tamanho_atual < tamanho_melhor)
-                    {
-                        melhor_intervalo = i;
-                    }
-                }
+                fprintf(stderr, "Erro: quantidade de execucoes de aquecimento invalida: %s.\n", valor);
+                resultado = 1;
             }
         }
-    }
-
-    return melhor_intervalo;
-}
-
-/**
- * @brief Resolve o problema da cobertura de pontos usando um algoritmo guloso.
- *
- * A estratégia gulosa consiste em:
- * - Selecionar o próximo ponto ainda não coberto
- * - Escolher o intervalo que cobre esse ponto e se estende o mais longe possível
- * - Marcar todos os pontos cobertos por esse intervalo
- *
- * O processo se repete até que todos os pontos estejam cobertos ou
- * não seja possível avançar.
- *
- * @param problema Ponteiro para a estrutura do problema
- * @return Estrutura contendo as métricas da execução
- */
-Metricas resolver_guloso(Problema *problema)
-{
-    Metricas metricas;
-    struct timespec inicio, fim;
-    struct rusage uso_memoria;
-    int indice_ponto;
-    int indice_intervalo;
-
-    metricas.tempo = 0.0;
-    metricas.memoria = 0;
-    metricas.qualidade = 0.0;
-    metricas.n_solucao = 0;
-
-    clock_gettime(CLOCK_MONOTONIC, &inicio);
-
-    problema->pontos_cobertos = (int *)calloc(problema->n_pontos, sizeof(int));
-    if (problema->pontos_cobertos == NULL)
-    {
-        clock_gettime(CLOCK_MONOTONIC, &fim);
-        problema->tempo_execucao = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
-        metricas.tempo = problema->tempo_execucao;
-        getrusage(RUSAGE_SELF, &uso_memoria);
-        problema->memoria_utilizada = uso_memoria.ru_maxrss;
-        metricas.memoria = problema->memoria_utilizada;
-        return metricas;
-    }
-
-    problema->n_pontos_cobertos = 0;
-
-    problema->solucao = (Intervalo *)malloc(problema->n_intervalos * sizeof(Intervalo));
-    if (problema->solucao == NULL)
-    {
-        free(problema->pontos_cobertos);
-        clock_gettime(CLOCK_MONOTONIC, &fim);
-        problema->tempo_execucao = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
-        metricas.tempo = problema->tempo_execucao;
-        getrusage(RUSAGE_SELF, &uso_memoria);
-        problema->memoria_utilizada = uso_memoria.ru_maxrss;
-        metricas.memoria = problema->memoria_utilizada;
-        return metricas;
-    }
-
-    problema->n_solucao = 0;
-
-    while (todos_pontos_cobertos(problema) == 0)
-    {
-        indice_ponto = obter_proximo_ponto_nao_coberto(problema);
-
-        if (indice_ponto == -1)
+        else if (strcmp(opcao, "--cpu") == 0)
         {
-            break;
+            lote.medicao.cpu = (int)strtol(valor, &fim, 10);
+            if (*fim != '\0' || lote.medicao.cpu < 0)
+            {
+                fprintf(stderr, "Erro: CPU invalida: %s.\n", valor);
+                resultado = 1;
+            }
         }
-
-        indice_intervalo = encontrar_melhor_intervalo(problema, indice_ponto);
-
-        if (indice_intervalo == -1)
+        else if (strcmp(opcao, "--edicoes") == 0)
         {
-            break;
+            lote.medicao.edicoes = valor;
+        }
+        else if (strcmp(opcao, "--fluxo") == 0)
+        {
+            caminho_fluxo = valor;
+        }
+        else
+        {
+            fprintf(stderr, "Erro: opcao %s desconhecida.\n", opcao);
+            exibir_uso_lote(argv[0]);
+            resultado = 1;
         }
-
-        problema->solucao[problema->n_solucao] = problema->intervalos[indice_intervalo];
-        problema->n_solucao++;
-
-        marcar_pontos_cobertos(problema, problema->intervalos[indice_intervalo]);
     }
 
-    clock_gettime(CLOCK_MONOTONIC, &fim);
-
-    problema->tempo_execucao = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
-    metricas.tempo = problema->tempo_execucao;
-
-    getrusage(RUSAGE_SELF, &uso_memoria);
-    problema->memoria_utilizada = uso_memoria.ru_maxrss;
-    metricas.memoria = problema->memoria_utilizada;
-
-    if (problema->n_intervalos > 0)
+    if (resultado < 0 && caminho_fluxo != NULL)
     {
-        problema->qualidade = 1.0 - ((double)problema->n_solucao / problema->n_intervalos);
-        metricas.qualidade = problema->qualidade;
+        resultado = executar_fluxo(caminho_fluxo, lote.caminho_saida);
     }
-    else
+    else if (resultado < 0 && lote.n_origens == 0)
     {
-        problema->qualidade = 0.0;
-        metricas.qualidade = 0.0;
+        fprintf(stderr, "Erro: informe ao menos uma --entrada, --manifesto ou --gerar.\n");
+        exibir_uso_lote(argv[0]);
+        resultado = 1;
     }
-
-    metricas.n_solucao = problema->n_solucao;
-
-    return metricas;
-}
-
-/**
- * @brief Exibe a solução encontrada pelo algoritmo guloso.
- *
- * Mostra os intervalos selecionados e os pontos efetivamente cobertos.
- *
- * @param problema Ponteiro para a estrutura do problema
- */
-void exibir_solucao(Problema *problema)
-{
-    printf("Solucao encontrada (%d intervalos):\n", problema->n_solucao);
-    for (int i = 0; i < problema->n_solucao; i++)
+    else if (resultado < 0)
     {
-        printf("  Intervalo %d: [%d, %d]\n", i + 1, problema->solucao[i].inicio, problema->solucao[i].fim);
+        resultado = executar_lote(&lote);
     }
 
-    printf("\nPontos cobertos (%d de %d):\n", problema->n_pontos_cobertos, problema->n_pontos);
-    for (int i = 0; i < problema->n_pontos; i++)
-    {
-        if (problema->pontos_cobertos[i])
-        {
-            printf("  Ponto %d: %d\n", problema->pontos[i].id, problema->pontos[i].posicao);
-        }
-    }
-}
+    free(origens);
 
-/**
- * @brief Exibe as métricas do algoritmo guloso.
- *
- * Mostra tempo de execução, memória utilizada,
- * tamanho da solução e qualidade obtida.
- *
- * @param problema Ponteiro para a estrutura do problema
- */
-void exibir_metricas(Problema *problema)
-{
-    printf("\n=== METRICAS DO ALGORITMO GULOSO ===\n");
-    printf("Tempo de execucao: %.4f ms\n", problema->tempo_execucao);
-    printf("Memoria utilizada: %ld KB\n", problema->memoria_utilizada);
-    printf("Numero de intervalos na solucao: %d\n", problema->n_solucao);
-    printf("Qualidade (1 - solucao/total): %.4f\n", problema->qualidade);
-    printf("====================================\n\n");
-}
-
-/**
- * @brief Salva as métricas dos cenários em um arquivo CSV.
- *
- * O arquivo gerado permite a análise comparativa dos cenários
- * pequeno, médio e grande.
- *
- * @param metricas_pequeno Métricas do cenário pequeno
- * @param metricas_medio   Métricas do cenário médio
- * @param metricas_grande  Métricas do cenário grande
- */
-void salvar_csv(Metricas *metricas_pequeno, Metricas *metricas_medio, Metricas *metricas_grande)
-{
-    FILE *arquivo = NULL;
-    char caminho[MAX_PATH];
-
-    snprintf(caminho, MAX_PATH, "../results/guloso/file/metricas_guloso.csv");
-
-    arquivo = fopen(caminho, "w");
-    if (arquivo == NULL)
-    {
-        printf("Erro ao criar arquivo CSV. Verifique se a pasta ../results/guloso existe.\n");
-        return;
-    }
-
-    fprintf(arquivo, "cenario,tempo_ms,memoria_kb,qualidade,n_intervalos_solucao\n");
-    fprintf(arquivo, "pequeno,%.4f,%ld,%.4f,%d\n",
-            metricas_pequeno->tempo, metricas_pequeno->memoria, metricas_pequeno->qualidade, metricas_pequeno->n_solucao);
-    fprintf(arquivo, "medio,%.4f,%ld,%.4f,%d\n",
-            metricas_medio->tempo, metricas_medio->memoria, metricas_medio->qualidade, metricas_medio->n_solucao);
-    fprintf(arquivo, "grande,%.4f,%ld,%.4f,%d\n",
-            metricas_grande->tempo, metricas_grande->memoria, metricas_grande->qualidade, metricas_grande->n_solucao);
-
-    fclose(arquivo);
-    printf("Metricas salvas em: %s\n", caminho);
-}
-
-/**
- * @brief Executa um teste individual do algoritmo guloso.
- *
- * Resolve o problema para um cenário específico,
- * exibindo a solução e suas métricas.
- *
- * @param problema Ponteiro para a estrutura do problema
- * @param nome_cenario Nome identificador do cenário
- * @param metricas Ponteiro para a estrutura de métricas
- */
-void executar_teste(Problema *problema, const char *nome_cenario, Metricas *metricas)
-{
-    printf("\n=== EXECUTANDO CENARIO %s ===\n", nome_cenario);
-    printf("Pontos: %d, Intervalos: %d\n", problema->n_pontos, problema->n_intervalos);
-
-    *metricas = resolver_guloso(problema);
-
-    exibir_solucao(problema);
-    exibir_metricas(problema);
-}
-
-/**
- * @brief Executa todos os cenários disponíveis.
- *
- * Roda os cenários pequeno, médio e grande,
- * coleta as métricas e gera o arquivo CSV.
- */
-void executar_todos_testes()
-{
-    Problema problema_pequeno, problema_medio, problema_grande;
-    Metricas metricas_pequeno, metricas_medio, metricas_grande;
-
-    printf("=== EXECUTANDO TODOS OS TESTES (GULOSO) ===\n");
-
-    inicializar_problema(&problema_pequeno);
-    inicializar_problema(&problema_medio);
-    inicializar_problema(&problema_grande);
-
-    configurar_cenario_pequeno(&problema_pequeno);
-    configurar_cenario_medio(&problema_medio);
-    configurar_cenario_grande(&problema_grande);
-
-    executar_teste(&problema_pequeno, "PEQUENO", &metricas_pequeno);
-    executar_teste(&problema_medio, "MEDIO", &metricas_medio);
-    executar_teste(&problema_grande, "GRANDE", &metricas_grande);
-
-    salvar_csv(&metricas_pequeno, &metricas_medio, &metricas_grande);
-
-    liberar_problema(&problema_pequeno);
-    liberar_problema(&problema_medio);
-    liberar_problema(&problema_grande);
+    return resultado;
 }
 
 /**
  * @brief Exibe o menu do algoritmo guloso.
  *
- * Permite ao usuário selecionar cenários,
- * executar todos os testes ou encerrar o programa.
+ * Permite ao usuário selecionar cenários, executar todos os testes,
+ * alternar a representação da cobertura, o motor guloso e a redução
+ * prévia da instância, executar as instâncias de um arquivo ou
+ * encerrar o programa.
+ *
+ * @param configuracao Opções de execução atuais, exibidas no menu
  */
-void exibir_menu() {
+void exibir_menu(const ConfiguracaoGuloso *configuracao) {
     printf("\n=== PROBLEMA DA COBERTURA DE PONTOS COM INTERVALOS ===\n");
     printf("ALGORITMO: GULOSO\n");
     printf("\nMenu de opcoes:\n");
@@ -814,7 +431,11 @@ void exibir_menu() {
     printf("2. Executar cenario MEDIO (10 pontos, 12 intervalos)\n");
     printf("3. Executar cenario GRANDE (12 pontos, 15 intervalos)\n");
     printf("4. Executar TODOS os cenarios e gerar CSV\n");
-    printf("5. Sair\n");
+    printf("5. Alternar representacao da cobertura (atual: %s)\n", configuracao->usar_bitset ? "bitset" : "vetor");
+    printf("6. Alternar motor guloso (atual: %s)\n", nome_motor_guloso(configuracao->motor));
+    printf("7. Alternar reducao de pontos e intervalos redundantes (atual: %s)\n", configuracao->aplicar_reducao ? "ativa" : "inativa");
+    printf("8. Executar instancias de um arquivo (texto ou binario; - para a entrada padrao)\n");
+    printf("9. Sair\n");
     printf("\nEscolha uma opcao: ");
 }
 
@@ -823,21 +444,45 @@ void exibir_menu() {
  *
  * Controla o fluxo de execução do sistema,
  * exibindo o menu e processando as escolhas do usuário.
+ * Com argumentos de linha de comando, executa o modo em lote de
+ * `executar_lote_guloso` no lugar do menu.
  *
+ * @param argc Quantidade de argumentos de linha de comando
+ * @param argv Argumentos de linha de comando
  * @return Código de encerramento do programa
  */
-int main()
+int main(int argc, char **argv)
 {
     int opcao = 0;
     int executando = 1;
+    int lidos = 0;
+    int caractere = 0;
+    ConfiguracaoGuloso configuracao;
+
+    configuracao.usar_bitset = 0;
+    configuracao.motor = MOTOR_GULOSO_CLASSICO;
+    configuracao.aplicar_reducao = 0;
+    configuracao.medir_contadores = 0;
+
+    if (argc > 1)
+    {
+        return executar_lote_guloso(argc, argv, &configuracao);
+    }
 
     while (executando)
     {
-        exibir_menu();
+        exibir_menu(&configuracao);
+
+        lidos = scanf("%d", &opcao);
+        if (lidos == EOF)
+        {
+            executando = 0;
+            continue;
+        }
 
-        if (scanf("%d", &opcao) != 1)
+        if (lidos != 1)
         {
-            while (getchar() != '\n')
+            while ((caractere = getchar()) != '\n' && caractere != EOF)
             {
                 continue;
             }
@@ -852,7 +497,8 @@ int main()
             Problema problema;
             Metricas metricas;
             inicializar_problema(&problema);
-            configurar_cenario_pequeno(&problema);
+            problema.configuracao = configuracao;
+            configurar_cenario(&problema, CENARIO_PEQUENO);
             executar_teste(&problema, "PEQUENO", &metricas);
             liberar_problema(&problema);
             break;
@@ -862,7 +508,8 @@ int main()
             Problema problema;
             Metricas metricas;
             inicializar_problema(&problema);
-            configurar_cenario_medio(&problema);
+            problema.configuracao = configuracao;
+            configurar_cenario(&problema, CENARIO_MEDIO);
             executar_teste(&problema, "MEDIO", &metricas);
             liberar_problema(&problema);
             break;
@@ -872,17 +519,50 @@ int main()
             Problema problema;
             Metricas metricas;
             inicializar_problema(&problema);
-            configurar_cenario_grande(&problema);
+            problema.configuracao = configuracao;
+            configurar_cenario(&problema, CENARIO_GRANDE);
             executar_teste(&problema, "GRANDE", &metricas);
             liberar_problema(&problema);
             break;
         }
         case 4:
         {
-            executar_todos_testes();
+            executar_todos_testes(&configuracao);
             break;
         }
         case 5:
+        {
+            configuracao.usar_bitset = !configuracao.usar_bitset;
+            printf("Representacao da cobertura: %s\n", configuracao.usar_bitset ? "bitset" : "vetor");
+            break;
+        }
+        case 6:
+        {
+            configuracao.motor = (configuracao.motor + 1) % N_MOTORES_GULOSO;
+            printf("Motor guloso: %s\n", nome_motor_guloso(configuracao.motor));
+            break;
+        }
+        case 7:
+        {
+            configuracao.aplicar_reducao = !configuracao.aplicar_reducao;
+            printf("Reducao: %s\n", configuracao.aplicar_reducao ? "ativa" : "inativa");
+            break;
+        }
+        case 8:
+        {
+            char caminho[MAX_PATH];
+            printf("Caminho do arquivo de instancias: ");
+            if (scanf("%1023s", caminho) == 1)
+            {
+                int n_instancias = executar_instancias_arquivo(caminho, &configuracao);
+                if (n_instancias >= 0)
+                {
+                    printf("%d instancia(s) executada(s).\n", n_instancias);
+                }
+            }
+            break;
+        }
+        case 9:
         {
             printf("Encerrando programa...\n");
             executando = 0;
@@ -1,76 +1,121 @@
-import pandas as pd
-import matplotlib.pyplot as plt
+import argparse
 from pathlib import Path
 
+import matplotlib.pyplot as plt
+import numpy as np
+import pandas as pd
 
-def carregar_dados(caminho_csv: Path) -> pd.DataFrame:
-    if not caminho_csv.exists():
-        raise FileNotFoundError(f"Arquivo não encontrado: {caminho_csv}")
-    return pd.read_csv(caminho_csv)
 
+ASSINATURA_BINARIA = b"CPR1"
+
+# Registro binário de `repositorio_anexar` (cobertura.c), sem preenchimento.
+TIPO_REGISTRO_BINARIO = np.dtype([
+    ("horario", "<i8"),
+    ("revisao", "S16"),
+    ("programa", "S16"),
+    ("instancia", "S64"),
+    ("motor", "S16"),
+    ("n_pontos", "<i4"),
+    ("n_intervalos", "<i4"),
+    ("threads", "<i4"),
+    ("n_intervalos_solucao", "<i4"),
+    ("amostras", "<i4"),
+    ("tempo_ms", "<f8"),
+    ("busca_min_ms", "<f8"),
+    ("busca_mediana_ms", "<f8"),
+    ("busca_p95_ms", "<f8"),
+    ("busca_p99_ms", "<f8"),
+    ("busca_media_ms", "<f8"),
+    ("busca_desvio_ms", "<f8"),
+    ("pico_memoria_bytes", "<i8"),
+    ("n_alocacoes", "<i8"),
+    ("memoria_kb", "<i8"),
+    ("nos_visitados", "<i8"),
+])
+
+METRICAS = {
+    "busca_mediana_ms": "Tempo de busca (ms, mediana)",
+    "tempo_ms": "Tempo total (ms)",
+    "pico_memoria_bytes": "Pico de memória (bytes)",
+    "nos_visitados": "Nós visitados",
+}
+
+
+def carregar_binario(caminho: Path) -> pd.DataFrame:
+    with caminho.open("rb") as arquivo:
+        cabecalho = arquivo.read(8)
+        if len(cabecalho) < 8 or cabecalho[:4] != ASSINATURA_BINARIA:
+            raise ValueError(f"Repositório binário inválido: {caminho}")
+        tamanho = int.from_bytes(cabecalho[4:], "little")
+        if tamanho != TIPO_REGISTRO_BINARIO.itemsize:
+            raise ValueError(f"Registro de {tamanho} bytes não suportado: {caminho}")
+        registros = np.fromfile(arquivo, dtype=TIPO_REGISTRO_BINARIO)
+
+    df = pd.DataFrame(registros)
+    for coluna in ("revisao", "programa", "instancia", "motor"):
+        df[coluna] = df[coluna].str.decode("utf-8")
+    return df
+
+
+def carregar_execucoes(pasta_results: Path) -> pd.DataFrame:
+    partes = []
+    for caminho in sorted(pasta_results.glob("*/file/execucoes.csv")):
+        partes.append(pd.read_csv(caminho))
+    for caminho in sorted(pasta_results.glob("*/file/execucoes.bin")):
+        partes.append(carregar_binario(caminho))
+
+    if not partes:
+        raise FileNotFoundError(f"Nenhum repositório de execuções em: {pasta_results}")
+    return pd.concat(partes, ignore_index=True)
+
+
+def gerar_curvas_escala(df: pd.DataFrame, metrica: str, rotulo: str, pasta_saida: Path):
+    """Uma curva por programa e motor: mediana por tamanho, com a faixa entre os percentis 10 e 90."""
+    df = df[df[metrica] > 0]
+    if df.empty:
+        return
+
+    plt.figure()
+    for (programa, motor, threads), grupo in df.groupby(["programa", "motor", "threads"]):
+        resumo = grupo.groupby("tamanho")[metrica].quantile([0.1, 0.5, 0.9]).unstack()
+        nome = f"{programa}/{motor}" + (f" ({threads} threads)" if threads > 1 else "")
+        plt.plot(resumo.index, resumo[0.5], marker="o", markersize=3, label=nome)
+        plt.fill_between(resumo.index, resumo[0.1], resumo[0.9], alpha=0.2)
+
+    plt.xscale("log")
+    plt.yscale("log")
+    plt.xlabel("Tamanho da instância (pontos + intervalos)")
+    plt.ylabel(rotulo)
+    plt.title(f"{rotulo} por tamanho")
+    plt.grid(True, which="both", alpha=0.3)
+    plt.legend(fontsize="small")
+
+    plt.savefig(pasta_saida / f"escala_{metrica}.png", bbox_inches="tight")
+    plt.close()
 
-def gerar_graficos_implantacao(
-    df: pd.DataFrame,
-    metricas: list[str],
-    nome_implantacao: str,
-    pasta_saida: Path
-):
-    pasta_saida.mkdir(parents=True, exist_ok=True)
 
-    for metrica in metricas:
-        if metrica not in df.columns:
-            continue
+def main():
+    raiz_projeto = Path(__file__).resolve().parent.parent
 
-        plt.figure()
-        plt.plot(df["cenario"], df[metrica], marker="o")
+    parser = argparse.ArgumentParser(description="Gera curvas de escala a partir dos repositórios de execuções.")
+    parser.add_argument("--resultados", type=Path, default=raiz_projeto / "results",
+                        help="pasta com <programa>/file/execucoes.csv|bin")
+    parser.add_argument("--revisao", help="considera apenas as execuções desta revisão")
+    parser.add_argument("--saida", type=Path, help="pasta dos gráficos (padrão: <resultados>/graphics)")
+    argumentos = parser.parse_args()
 
-        plt.xlabel("Cenário")
-        plt.ylabel(metrica)
-        plt.title(f"{metrica} - {nome_implantacao.capitalize()}")
-        plt.grid(True)
+    df = carregar_execucoes(argumentos.resultados)
+    if argumentos.revisao:
+        df = df[df["revisao"] == argumentos.revisao]
+    df = df.assign(tamanho=df["n_pontos"] + df["n_intervalos"])
 
-        plt.savefig(pasta_saida / f"{metrica}.png", bbox_inches="tight")
-        plt.close()
+    pasta_graficos = argumentos.saida or argumentos.resultados / "graphics"
+    pasta_graficos.mkdir(parents=True, exist_ok=True)
 
+    for metrica, rotulo in METRICAS.items():
+        gerar_curvas_escala(df, metrica, rotulo, pasta_graficos)
 
-def main():
-    raiz_projeto = Path(__file__).resolve().parent.parent
-    pasta_results = raiz_projeto / "results"
-
-    implementacoes = {
-        "guloso": {
-            "csv": pasta_results / "guloso/file" / "metricas_guloso.csv",
-            "metricas": [
-                "tempo_ms",
-                "memoria_kb",
-                "qualidade",
-                "n_intervalos_solucao",
-            ],
-        },
-        "backtracking": {
-            "csv": pasta_results / "backtracking/file" / "metricas_backtracking.csv",
-            "metricas": [
-                "tempo_ms",
-                "memoria_kb",
-                "qualidade",
-                "n_intervalos_solucao",
-                "nos_visitados",
-            ],
-        },
-    }
-
-    for nome, info in implementacoes.items():
-        df = carregar_dados(info["csv"])
-        pasta_graficos = pasta_results / nome / "graphics"
-
-        gerar_graficos_implantacao(
-            df,
-            info["metricas"],
-            nome,
-            pasta_graficos
-        )
-
-    print("Gráficos gerados com sucesso.")
+    print(f"Gráficos de {len(df)} execuções gerados em {pasta_graficos}.")
 
 
 if __name__ == "__main__":
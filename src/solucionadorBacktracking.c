@@ -0,0 +1,3614 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <math.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <signal.h>
+#include <stdarg.h>
+
+#include "solucionadorBacktracking.h"
+
+/**
+ * @brief Aloca um bloco do heap e o registra na contabilidade.
+ *
+ * O tamanho do bloco é guardado em um cabeçalho de
+ * `CABECALHO_MEMORIA` bytes antes do ponteiro devolvido, para que
+ * `memoria_realocar` e `memoria_liberar` saibam quanto descontar. Os
+ * blocos só podem ser devolvidos por essas duas funções. A contagem
+ * não é protegida contra acesso concorrente.
+ *
+ * @param contabilidade Contabilidade a atualizar.
+ * @param tamanho Quantidade de bytes do bloco.
+ * @param zerar 1 para inicializar o bloco com zeros.
+ * @return Ponteiro para o bloco, ou NULL em caso de falha de alocação.
+ */
+void *memoria_alocar(ContabilidadeMemoria *contabilidade, size_t tamanho, int zerar)
+{
+    unsigned char *base = (unsigned char *)(zerar ? calloc(1, CABECALHO_MEMORIA + tamanho) : malloc(CABECALHO_MEMORIA + tamanho));
+
+    if (base == NULL)
+    {
+        return NULL;
+    }
+
+    *(size_t *)base = tamanho;
+    contabilizar_memoria(contabilidade, 0, tamanho);
+
+    return base + CABECALHO_MEMORIA;
+}
+
+/**
+ * @brief Redimensiona um bloco obtido com `memoria_alocar`.
+ *
+ * @param contabilidade Contabilidade a atualizar.
+ * @param bloco Bloco a redimensionar, ou NULL para alocar um novo.
+ * @param tamanho Novo tamanho do bloco, em bytes.
+ * @return Ponteiro para o bloco redimensionado, ou NULL em caso de falha (o bloco original é mantido).
+ */
+void *memoria_realocar(ContabilidadeMemoria *contabilidade, void *bloco, size_t tamanho)
+{
+    unsigned char *base = bloco != NULL ? (unsigned char *)bloco - CABECALHO_MEMORIA : NULL;
+    size_t anterior = base != NULL ? *(size_t *)base : 0;
+    unsigned char *nova = (unsigned char *)realloc(base, CABECALHO_MEMORIA + tamanho);
+
+    if (nova == NULL)
+    {
+        return NULL;
+    }
+
+    *(size_t *)nova = tamanho;
+    contabilizar_memoria(contabilidade, anterior, tamanho);
+
+    return nova + CABECALHO_MEMORIA;
+}
+
+/**
+ * @brief Libera um bloco obtido com `memoria_alocar` ou `memoria_realocar`.
+ *
+ * @param contabilidade Contabilidade a atualizar.
+ * @param bloco Bloco a liberar (pode ser NULL).
+ */
+void memoria_liberar(ContabilidadeMemoria *contabilidade, void *bloco)
+{
+    if (bloco != NULL)
+    {
+        unsigned char *base = (unsigned char *)bloco - CABECALHO_MEMORIA;
+        contabilizar_memoria(contabilidade, *(size_t *)base, 0);
+        free(base);
+    }
+}
+
+/**
+ * @brief Inicializa a estrutura do problema de backtracking.
+ *
+ * Esta função prepara a estrutura `ProblemaBacktracking` para uso,
+ * garantindo que todos os ponteiros estejam nulos e que os contadores
+ * e métricas iniciem com valores seguros.
+ *
+ * Em especial, o campo `n_melhor_solucao` é inicializado com `INT_MAX`
+ * para permitir que qualquer solução válida encontrada seja considerada
+ * melhor na primeira comparação.
+ *
+ * Essa inicialização é essencial antes de configurar cenários ou
+ * executar o algoritmo de backtracking, evitando erros de memória
+ * e comportamentos indefinidos.
+ *
+ * @param problema Ponteiro para a estrutura do problema a ser inicializada.
+ */
+void inicializar_problema_backtracking(ProblemaBacktracking *problema)
+{
+    problema->intervalos = NULL;
+    problema->pontos = NULL;
+    problema->pontos_cobertos = NULL;
+    problema->solucao_atual = NULL;
+    problema->indices_solucao_atual = NULL;
+    problema->melhor_solucao = NULL;
+    problema->n_intervalos = 0;
+    problema->n_pontos = 0;
+    problema->n_pontos_cobertos = 0;
+    problema->n_solucao_atual = 0;
+    problema->n_melhor_solucao = INT_MAX;
+    problema->tempo_execucao = 0.0;
+    problema->memoria_utilizada = 0;
+    problema->qualidade = 0.0;
+    problema->nos_visitados = 0;
+    problema->configuracao.usar_bitset = 0;
+    problema->configuracao.motor = MOTOR_BACKTRACKING_CLASSICO;
+    problema->configuracao.aplicar_reducao = 0;
+    problema->configuracao.n_threads = 1;
+    problema->configuracao.profundidade_divisao = PROFUNDIDADE_DIVISAO_PADRAO;
+    problema->configuracao.limite_tempo_ms = 0.0;
+    problema->configuracao.limite_nos = 0;
+    problema->configuracao.intervalo_progresso_ms = 0.0;
+    problema->configuracao.medir_contadores = 0;
+    problema->configuracao.decompor = 0;
+    problema->n_palavras = 0;
+    problema->mascaras = NULL;
+    problema->cobertura_bits = NULL;
+    problema->intervalos_por_inicio = NULL;
+    problema->alcance_ponto = NULL;
+    problema->posicoes = NULL;
+    problema->inicios = NULL;
+    problema->fins = NULL;
+    problema->faixa_inicio = NULL;
+    problema->faixa_fim = NULL;
+    problema->reducao.aplicada = 0;
+    problema->reducao.pontos_duplicados = 0;
+    problema->reducao.pontos_dominados = 0;
+    problema->reducao.intervalos_dominados = 0;
+    problema->nos_por_thread = NULL;
+    problema->n_threads_utilizadas = 0;
+    problema->pilha_busca = NULL;
+    problema->n_pilha_busca = 0;
+    problema->limite_inferior = 0;
+    problema->gap = 0.0;
+    problema->busca_concluida = 0;
+    problema->coordenadas.valores = NULL;
+    problema->coordenadas.n_valores = 0;
+    problema->arena.base = NULL;
+    problema->arena.capacidade = 0;
+    problema->arena.usado = 0;
+    problema->arena.contabilidade = NULL;
+    problema->marcador_instancia = 0;
+    problema->memoria.bytes_em_uso = 0;
+    problema->memoria.pico_bytes = 0;
+    problema->memoria.n_alocacoes = 0;
+    problema->profundidade_maxima = 0;
+}
+
+/**
+ * @brief Libera toda a memória alocada dinamicamente no problema de backtracking.
+ *
+ * Esta função é responsável por desalocar corretamente todos os vetores
+ * alocados dinamicamente dentro da estrutura `ProblemaBacktracking`.
+ * Os vetores da instância e da resolução vivem na arena do problema,
+ * liberada em uma única chamada. Após a liberação, os ponteiros são
+ * ajustados para `NULL`, evitando acessos inválidos e possíveis erros
+ * de dupla liberação.
+ *
+ * Essa função deve ser chamada ao final da execução de cada cenário
+ * ou quando o problema não for mais utilizado, garantindo boas
+ * práticas de gerenciamento de memória em C.
+ *
+ * @param problema Ponteiro para a estrutura do problema cujos recursos
+ *                 alocados devem ser liberados.
+ */
+void liberar_problema_backtracking(ProblemaBacktracking *problema)
+{
+    /**
+     * Vetores da instância e das estruturas de busca pertencem à arena
+     * e são devolvidos juntos por `arena_liberar`.
+     */
+    problema->intervalos = NULL;
+    problema->pontos = NULL;
+    problema->pontos_cobertos = NULL;
+    problema->solucao_atual = NULL;
+    problema->indices_solucao_atual = NULL;
+    problema->melhor_solucao = NULL;
+    problema->mascaras = NULL;
+    problema->cobertura_bits = NULL;
+    problema->intervalos_por_inicio = NULL;
+    problema->alcance_ponto = NULL;
+    problema->posicoes = NULL;
+    problema->inicios = NULL;
+    problema->fins = NULL;
+    problema->faixa_inicio = NULL;
+    problema->faixa_fim = NULL;
+    problema->pilha_busca = NULL;
+    problema->n_pilha_busca = 0;
+    problema->nos_por_thread = NULL;
+    liberar_compressao(&problema->coordenadas);
+    arena_liberar(&problema->arena);
+    problema->n_threads_utilizadas = 0;
+}
+
+/**
+ * @brief Função de comparação de intervalos para ordenação.
+ *
+ * Esta função é utilizada pelo `qsort` para ordenar os intervalos
+ * antes da execução do algoritmo de backtracking.
+ *
+ * O critério de ordenação é:
+ * 1. Intervalos maiores vêm primeiro (ordem decrescente de tamanho);
+ * 2. Em caso de empate, o intervalo com menor valor de início vem primeiro.
+ *
+ * A ordenação por tamanho é uma heurística importante, pois intervalos
+ * maiores tendem a cobrir mais pontos, o que pode reduzir a profundidade
+ * da árvore de busca e melhorar a eficiência das podas no backtracking.
+ *
+ * @param a Ponteiro genérico para o primeiro intervalo.
+ * @param b Ponteiro genérico para o segundo intervalo.
+ * @return Valor negativo se `a` deve vir antes de `b`,
+ *         valor positivo se `a` deve vir depois de `b`,
+ *         ou zero se ambos forem considerados equivalentes.
+ */
+int comparar_intervalos_backtracking(const void *a, const void *b)
+{
+    int resultado = 0;
+    Intervalo *intervalo_a = (Intervalo *)a;
+    Intervalo *intervalo_b = (Intervalo *)b;
+
+    int tamanho_a = intervalo_a->fim - intervalo_a->inicio;
+    int tamanho_b = intervalo_b->fim - intervalo_b->inicio;
+
+    if (tamanho_a > tamanho_b)
+    {
+        resultado = -1;
+    }
+    else if (tamanho_a < tamanho_b)
+    {
+        resultado = 1;
+    }
+    else
+    {
+        if (intervalo_a->inicio < intervalo_b->inicio)
+        {
+            resultado = -1;
+        }
+        else if (intervalo_a->inicio > intervalo_b->inicio)
+        {
+            resultado = 1;
+        }
+        else
+        {
+            resultado = 0;
+        }
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Retorna o nome de um motor de busca, para exibição e registro.
+ *
+ * @param motor Identificador do motor (MOTOR_BACKTRACKING_*).
+ * @return Nome curto do motor.
+ */
+const char *nome_motor_backtracking(int motor)
+{
+    const char *nome = "desconhecido";
+    if (motor == MOTOR_BACKTRACKING_CLASSICO)
+    {
+        nome = "classico";
+    }
+    else if (motor == MOTOR_BACKTRACKING_PODA)
+    {
+        nome = "poda";
+    }
+    else if (motor == MOTOR_BACKTRACKING_PARALELO)
+    {
+        nome = "paralelo";
+    }
+    else if (motor == MOTOR_BACKTRACKING_ITERATIVO)
+    {
+        nome = "iterativo";
+    }
+    else if (motor == MOTOR_BACKTRACKING_LIMITADO)
+    {
+        nome = "limitado";
+    }
+    else if (motor == MOTOR_BACKTRACKING_DINAMICA)
+    {
+        nome = "dinamica";
+    }
+    return nome;
+}
+
+/**
+ * @brief Aplica a redução de pontos e intervalos redundantes ao problema.
+ *
+ * Compacta no lugar os vetores `pontos` e `intervalos` do problema com
+ * `reduzir_instancia`, atualiza `n_pontos` e `n_intervalos` e guarda
+ * o resumo da redução em `problema->reducao`. Deve ser chamada antes da
+ * alocação das estruturas auxiliares da resolução.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @return Resumo da redução aplicada.
+ */
+Reducao reduzir_problema_backtracking(ProblemaBacktracking *problema)
+{
+    problema->reducao = reduzir_instancia(&problema->arena, problema->pontos, &problema->n_pontos, problema->intervalos, &problema->n_intervalos);
+    return problema->reducao;
+}
+
+/**
+ * @brief Calcula o tamanho da arena de uma instância do backtracking.
+ *
+ * Soma, com a folga de alinhamento de cada bloco, a instância (pontos
+ * e intervalos), a memória temporária da redução e as estruturas de
+ * busca do motor e da representação escolhidos em `configuracao`. No
+ * motor paralelo, entram também as filas e o estado privado de cada
+ * trabalhador; só a lista de tarefas fica fora, porque seu tamanho
+ * depende de onde a divisão da árvore termina.
+ *
+ * @param n_pontos Quantidade de pontos da instância.
+ * @param n_intervalos Quantidade de intervalos da instância.
+ * @param configuracao Opções de execução que serão usadas na resolução.
+ * @return Quantidade de bytes necessária.
+ */
+size_t calcular_tamanho_arena_backtracking(int n_pontos, int n_intervalos, const ConfiguracaoBacktracking *configuracao)
+{
+    size_t pontos = (size_t)n_pontos;
+    size_t intervalos = (size_t)n_intervalos;
+    size_t palavras = (pontos + 63) / 64; /* o mesmo que calcular_palavras_bitset */
+    size_t tamanho = 0;
+
+    tamanho += ALINHAR_ARENA(pontos * sizeof(Ponto));
+    tamanho += ALINHAR_ARENA(intervalos * sizeof(Intervalo));
+
+    if (configuracao->aplicar_reducao)
+    {
+        tamanho += ALINHAR_ARENA((intervalos + 1) * sizeof(FaixaReducao));
+        tamanho += ALINHAR_ARENA((intervalos + pontos + 1) * sizeof(int));
+        tamanho += 2 * ALINHAR_ARENA((pontos + 1) * sizeof(int));
+    }
+
+    tamanho += 2 * ALINHAR_ARENA(intervalos * sizeof(Intervalo));
+    tamanho += ALINHAR_ARENA(pontos * sizeof(int)) + 2 * ALINHAR_ARENA(intervalos * sizeof(int));
+    tamanho += 3 * ALINHAR_ARENA(intervalos * sizeof(int));
+    tamanho += ALINHAR_ARENA((intervalos + 1) * sizeof(QuadroBusca));
+    if (configuracao->usar_bitset)
+    {
+        tamanho += ALINHAR_ARENA(intervalos * palavras * sizeof(uint64_t));
+        tamanho += ALINHAR_ARENA((intervalos + 1) * palavras * sizeof(uint64_t));
+    }
+    else
+    {
+        tamanho += ALINHAR_ARENA(pontos * sizeof(int));
+    }
+    tamanho += ALINHAR_ARENA(intervalos * sizeof(Intervalo));
+    tamanho += ALINHAR_ARENA(pontos * sizeof(Intervalo));
+    if (configuracao->motor == MOTOR_BACKTRACKING_PARALELO)
+    {
+        size_t threads = (size_t)(configuracao->n_threads > 0 ? configuracao->n_threads : 1);
+        size_t cobertura = configuracao->usar_bitset ? ALINHAR_ARENA((intervalos + 1) * palavras * sizeof(uint64_t))
+                                                     : ALINHAR_ARENA(pontos * sizeof(int));
+
+        tamanho += ALINHAR_ARENA(threads * sizeof(int64_t));
+        tamanho += ALINHAR_ARENA((intervalos + 1) * sizeof(int));
+        tamanho += ALINHAR_ARENA(threads * sizeof(FilaTarefas)) + ALINHAR_ARENA(threads * sizeof(TrabalhadorBusca));
+        tamanho += threads * (ALINHAR_ARENA(intervalos * sizeof(Intervalo)) + ALINHAR_ARENA(intervalos * sizeof(int)) + cobertura);
+    }
+    if (configuracao->motor == MOTOR_BACKTRACKING_DINAMICA)
+    {
+        tamanho += ALINHAR_ARENA((pontos + 1) * sizeof(int)) + ALINHAR_ARENA(pontos * sizeof(int));
+        tamanho += ALINHAR_ARENA((pontos + 2) * sizeof(int)) + ALINHAR_ARENA(intervalos * sizeof(int));
+        tamanho += ALINHAR_ARENA(intervalos * sizeof(EntradaDinamica));
+    }
+
+    return tamanho;
+}
+
+/**
+ * @brief Cria a arena de uma instância e reserva nela os pontos e intervalos.
+ *
+ * A arena é dimensionada uma única vez por
+ * `calcular_tamanho_arena_backtracking`, a partir do tamanho da
+ * instância e de `problema->configuracao`, que por isso deve estar
+ * definida antes. Toda a memória da resolução sai dela e é devolvida
+ * de uma vez por `liberar_problema_backtracking`.
+ *
+ * Os vetores `pontos` e `intervalos` ficam alocados mas não
+ * preenchidos; a posição da arena logo após eles é guardada em
+ * `marcador_instancia`, para onde cada resolução retorna antes de
+ * alocar suas estruturas.
+ *
+ * @param problema Ponteiro para a estrutura do problema, inicializada.
+ * @param n_pontos Quantidade de pontos da instância.
+ * @param n_intervalos Quantidade de intervalos da instância.
+ * @return 1 se a instância foi alocada, ou 0 em caso de falha de alocação.
+ */
+int alocar_instancia_backtracking(ProblemaBacktracking *problema, int n_pontos, int n_intervalos)
+{
+    int resultado = 0;
+
+    if (arena_criar(&problema->arena, calcular_tamanho_arena_backtracking(n_pontos, n_intervalos, &problema->configuracao), &problema->memoria))
+    {
+        problema->pontos = (Ponto *)arena_alocar(&problema->arena, (size_t)n_pontos * sizeof(Ponto));
+        problema->intervalos = (Intervalo *)arena_alocar(&problema->arena, (size_t)n_intervalos * sizeof(Intervalo));
+        problema->n_pontos = n_pontos;
+        problema->n_intervalos = n_intervalos;
+        problema->marcador_instancia = arena_marcador(&problema->arena);
+        resultado = 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Garante que a arena comporte a resolução com a configuração atual.
+ *
+ * A arena é dimensionada pela configuração vigente em
+ * `alocar_instancia_backtracking`. Se as opções mudarem depois (por
+ * exemplo, passando a usar bitsets), uma arena maior é criada, os pontos
+ * e intervalos são copiados para ela e a antiga é liberada.
+ *
+ * @param problema Ponteiro para a estrutura do problema, com a instância
+ *        alocada por `alocar_instancia_backtracking`.
+ * @return 1 se a arena comporta a resolução, ou 0 em caso de falha de alocação.
+ */
+int garantir_arena_backtracking(ProblemaBacktracking *problema)
+{
+    size_t necessario = calcular_tamanho_arena_backtracking(problema->n_pontos, problema->n_intervalos, &problema->configuracao);
+    int resultado = 1;
+
+    if (necessario > problema->arena.capacidade)
+    {
+        Arena nova;
+
+        resultado = 0;
+        if (arena_criar(&nova, necessario, &problema->memoria))
+        {
+            Ponto *pontos = (Ponto *)arena_alocar(&nova, (size_t)problema->n_pontos * sizeof(Ponto));
+            Intervalo *intervalos = (Intervalo *)arena_alocar(&nova, (size_t)problema->n_intervalos * sizeof(Intervalo));
+
+            memcpy(pontos, problema->pontos, (size_t)problema->n_pontos * sizeof(Ponto));
+            memcpy(intervalos, problema->intervalos, (size_t)problema->n_intervalos * sizeof(Intervalo));
+            arena_liberar(&problema->arena);
+
+            problema->arena = nova;
+            problema->pontos = pontos;
+            problema->intervalos = intervalos;
+            problema->marcador_instancia = arena_marcador(&problema->arena);
+            resultado = 1;
+        }
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Configura um dos cenários fixos para o algoritmo de backtracking.
+ *
+ * Os cenários são determinísticos e crescem em complexidade: o pequeno
+ * (8 pontos e 10 intervalos) serve aos testes iniciais e à validação,
+ * e o médio (10 e 12) e o grande (12 e 15) permitem avaliar o impacto
+ * do aumento do espaço de busca no número de nós visitados e no tempo
+ * de execução. Os dados vêm de `obter_cenario`.
+ *
+ * Ao final da configuração, os intervalos são ordenados por tamanho
+ * (do maior para o menor), utilizando uma heurística que tende a
+ * melhorar a eficiência das podas no backtracking.
+ *
+ * @param problema Ponteiro para a estrutura do problema a ser configurada.
+ * @param cenario Cenário (CENARIO_PEQUENO, CENARIO_MEDIO ou CENARIO_GRANDE).
+ * @return 1 se o cenário foi configurado, ou 0 em caso de falha.
+ */
+int configurar_cenario_backtracking(ProblemaBacktracking *problema, int cenario)
+{
+    const CenarioCobertura *dados = obter_cenario(cenario);
+    int resultado = 0;
+
+    if (dados != NULL && alocar_instancia_backtracking(problema, dados->n_pontos, dados->n_intervalos))
+    {
+        memcpy(problema->pontos, dados->pontos, (size_t)dados->n_pontos * sizeof(Ponto));
+        memcpy(problema->intervalos, dados->intervalos, (size_t)dados->n_intervalos * sizeof(Intervalo));
+        qsort(problema->intervalos, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos_backtracking);
+        resultado = 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Gera uma instância sintética reprodutível a partir de uma semente.
+ *
+ * Complementa os cenários fixos `configurar_cenario_*` com instâncias de
+ * qualquer tamanho. O domínio cresce com a instância (dez posições por
+ * elemento), e as distribuições são:
+ * - uniforme: inícios uniformes e comprimentos que dão, em média, dois
+ *   intervalos por posição;
+ * - agrupada: intervalos curtos concentrados em torno de √n centros;
+ * - sobreposta: intervalos longos, com cerca de 32 intervalos por posição;
+ * - aninhada: cadeias de 16 intervalos encaixados uns nos outros;
+ * - adversaria: blocos em que o guloso clássico usa 3 intervalos e o
+ *   ótimo usa 2 (veja `gerar_blocos_adversarios`); abaixo de 4 pontos
+ *   ou 3 intervalos, recai na uniforme.
+ *
+ * Exceto na adversária, cada ponto é sorteado dentro de um intervalo
+ * sorteado, o que garante que toda instância gerada tenha cobertura.
+ * O problema deve estar inicializado e com a configuração definida.
+ *
+ * @param problema Problema que recebe a instância.
+ * @param n_pontos Quantidade de pontos.
+ * @param n_intervalos Quantidade de intervalos (ao menos 1 se houver pontos).
+ * @param distribuicao Constante DISTRIBUICAO_*.
+ * @param semente Semente do gerador.
+ * @return 1 se a instância foi gerada, ou 0 se os parâmetros forem inválidos ou faltar memória.
+ */
+int gerar_instancia_backtracking(ProblemaBacktracking *problema, int n_pontos, int n_intervalos, int distribuicao, uint64_t semente)
+{
+    GeradorAleatorio gerador;
+    int maior = n_pontos > n_intervalos ? n_pontos : n_intervalos;
+    int dominio, comprimento_medio;
+    int n_centros = 1, espalhamento = 1;
+    int centro = 0, raio = 0;
+
+    if (n_pontos < 0 || n_intervalos < 0 || (n_pontos > 0 && n_intervalos == 0) ||
+        maior > (INT_MAX / 4 - 100) / 10 || distribuicao < 0 || distribuicao >= N_DISTRIBUICOES)
+    {
+        return 0;
+    }
+
+    if (alocar_instancia_backtracking(problema, n_pontos, n_intervalos) == 0)
+    {
+        return 0;
+    }
+
+    gerador.estado = semente;
+    dominio = 10 * maior + 100;
+    comprimento_medio = n_intervalos > 0 ? (int)((2LL * dominio) / n_intervalos) : 1;
+    if (distribuicao == DISTRIBUICAO_SOBREPOSTA)
+    {
+        comprimento_medio *= 16;
+    }
+    if (comprimento_medio < 1)
+    {
+        comprimento_medio = 1;
+    }
+    else if (comprimento_medio > dominio)
+    {
+        comprimento_medio = dominio;
+    }
+
+    if (distribuicao == DISTRIBUICAO_ADVERSARIA && n_pontos >= 4 && n_intervalos >= 3)
+    {
+        gerar_blocos_adversarios(&gerador, problema->pontos, n_pontos, problema->intervalos, n_intervalos);
+    }
+    else
+    {
+        if (distribuicao == DISTRIBUICAO_AGRUPADA)
+        {
+            n_centros = (int)sqrt((double)n_pontos) + 1;
+            espalhamento = dominio / (4 * n_centros) + 1;
+        }
+
+        for (int i = 0; i < n_intervalos; i++)
+        {
+            int comprimento = 1 + gerador_uniforme(&gerador, 2 * comprimento_medio);
+            int inicio;
+
+            if (distribuicao == DISTRIBUICAO_AGRUPADA)
+            {
+                /* Centros reproduzidos a partir da semente, sem guardar um vetor. */
+                GeradorAleatorio centros = {semente ^ (uint64_t)gerador_uniforme(&gerador, n_centros)};
+                int deslocamento = gerador_uniforme(&gerador, 2 * espalhamento) - espalhamento;
+                deslocamento = (deslocamento + gerador_uniforme(&gerador, 2 * espalhamento) - espalhamento) / 2;
+                comprimento = 1 + gerador_uniforme(&gerador, espalhamento);
+                inicio = gerador_uniforme(&centros, dominio) + deslocamento - comprimento / 2;
+            }
+            else if (distribuicao == DISTRIBUICAO_ANINHADA)
+            {
+                if (i % 16 == 0)
+                {
+                    centro = gerador_uniforme(&gerador, dominio);
+                    raio = 0;
+                }
+                raio += 1 + gerador_uniforme(&gerador, comprimento_medio / 16 + 1);
+                comprimento = 2 * raio;
+                inicio = centro - raio;
+            }
+            else
+            {
+                inicio = gerador_uniforme(&gerador, dominio) - comprimento / 2;
+            }
+
+            problema->intervalos[i] = (Intervalo){inicio, inicio + comprimento};
+        }
+
+        for (int j = 0; j < n_pontos; j++)
+        {
+            Intervalo intervalo = problema->intervalos[gerador_uniforme(&gerador, n_intervalos)];
+            problema->pontos[j].posicao = intervalo.inicio + gerador_uniforme(&gerador, intervalo.fim - intervalo.inicio + 1);
+        }
+    }
+
+    for (int j = 0; j < n_pontos; j++)
+    {
+        problema->pontos[j].id = j + 1;
+    }
+
+    qsort(problema->intervalos, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos_backtracking);
+
+    return 1;
+}
+
+/**
+ * @brief Lê os valores de uma instância cujo cabeçalho já foi lido.
+ *
+ * Separada de `ler_instancia_backtracking` para que o modo servidor
+ * confira o tamanho anunciado no cabeçalho antes de alocar e ler a
+ * instância.
+ *
+ * @param leitor Leitor posicionado logo após o cabeçalho.
+ * @param problema Ponteiro para a estrutura do problema, inicializada.
+ * @param formato Formato devolvido por `ler_cabecalho_instancia`.
+ * @param n_pontos Quantidade de pontos do cabeçalho.
+ * @param n_intervalos Quantidade de intervalos do cabeçalho.
+ * @return 1 se a instância foi lida, ou 0 se é inválida ou não pôde
+ *         ser alocada.
+ */
+int ler_corpo_instancia_backtracking(LeitorInstancia *leitor, ProblemaBacktracking *problema, int formato, int n_pontos, int n_intervalos)
+{
+    int resultado = 0;
+
+    if (alocar_instancia_backtracking(problema, n_pontos, n_intervalos) &&
+        ler_valores_instancia(leitor, formato, problema->pontos, n_pontos, problema->intervalos, n_intervalos, &problema->coordenadas))
+    {
+        qsort(problema->intervalos, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos_backtracking);
+        resultado = 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Lê a próxima instância de uma origem para o problema.
+ *
+ * Uma origem pode conter várias instâncias em sequência, cada uma em
+ * um dos formatos reconhecidos por `ler_cabecalho_instancia` (texto,
+ * "CPI1" com valores de 32 bits ou "CPI2" com valores de 64 bits).
+ * Instâncias com coordenadas fora do intervalo de `int` são
+ * comprimidas para postos densos por `ler_valores_instancia`, e a
+ * tabela das coordenadas originais fica em `problema->coordenadas`.
+ *
+ * Os pontos recebem identificadores de 1 a `n_pontos`, na ordem lida.
+ * Os vetores são alocados na arena do problema por
+ * `alocar_instancia_backtracking`, de modo que `problema->configuracao`
+ * deve estar definida antes, e os intervalos são ordenados como nos
+ * cenários fixos.
+ *
+ * @param leitor Leitor aberto por `leitor_abrir`.
+ * @param problema Ponteiro para a estrutura do problema, inicializada.
+ * @return 1 se uma instância foi lida, 0 se a origem terminou antes
+ *         de uma nova instância, ou -1 se a instância é inválida ou
+ *         não pôde ser alocada.
+ */
+int ler_instancia_backtracking(LeitorInstancia *leitor, ProblemaBacktracking *problema)
+{
+    int n_pontos = 0;
+    int n_intervalos = 0;
+    int formato = FORMATO_INSTANCIA_TEXTO;
+    int resultado = ler_cabecalho_instancia(leitor, &formato, &n_pontos, &n_intervalos);
+
+    if (resultado == 1 && ler_corpo_instancia_backtracking(leitor, problema, formato, n_pontos, n_intervalos) == 0)
+    {
+        resultado = -1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Copia as coordenadas da instância para vetores contíguos.
+ *
+ * Os laços de cobertura só leem a posição de cada ponto e os extremos
+ * de cada intervalo. Separados em `posicoes`, `inicios` e `fins`
+ * (estrutura de vetores), alinhados pela arena, esses laços percorrem
+ * metade dos bytes dos vetores de `Ponto` e podem ser vetorizados; o
+ * `id` dos pontos permanece apenas em `pontos`, consultado na exibição.
+ *
+ * Deve ser chamada depois da redução e da ordenação dos pontos, que
+ * alteram `pontos` e `intervalos`.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ * @return 1 se os vetores foram criados, ou 0 em caso de falha de alocação.
+ */
+int separar_coordenadas_backtracking(ProblemaBacktracking *problema)
+{
+    int resultado = 0;
+
+    problema->posicoes = (int *)arena_alocar(&problema->arena, problema->n_pontos * sizeof(int));
+    problema->inicios = (int *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(int));
+    problema->fins = (int *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(int));
+    if (problema->posicoes != NULL && problema->inicios != NULL && problema->fins != NULL)
+    {
+        for (int j = 0; j < problema->n_pontos; j++)
+        {
+            problema->posicoes[j] = problema->pontos[j].posicao;
+        }
+        for (int i = 0; i < problema->n_intervalos; i++)
+        {
+            problema->inicios[i] = problema->intervalos[i].inicio;
+            problema->fins[i] = problema->intervalos[i].fim;
+        }
+        resultado = 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Calcula a faixa de pontos coberta por cada intervalo.
+ *
+ * Com os pontos ordenados por posição, os pontos cobertos por um
+ * intervalo formam a faixa contígua de índices
+ * `[faixa_inicio[i], faixa_fim[i])`, obtida por duas buscas binárias.
+ * Calculadas uma única vez por resolução, as faixas substituem o teste
+ * de cada ponto contra o intervalo: incluir e remover um intervalo
+ * tocam apenas os pontos que ele cobre.
+ *
+ * As buscas percorrem os vetores contíguos `posicoes`, `inicios` e
+ * `fins`, e por isso a função deve ser chamada depois de
+ * `separar_coordenadas_backtracking`.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema,
+ *        com os pontos ordenados por posição.
+ * @return 1 se as faixas foram calculadas, ou 0 em caso de falha de alocação.
+ */
+int calcular_faixas_backtracking(ProblemaBacktracking *problema)
+{
+    int resultado = 0;
+
+    problema->faixa_inicio = (int *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(int));
+    problema->faixa_fim = (int *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(int));
+    if (problema->faixa_inicio != NULL && problema->faixa_fim != NULL)
+    {
+        for (int i = 0; i < problema->n_intervalos; i++)
+        {
+            int fim = problema->fins[i];
+
+            problema->faixa_inicio[i] = primeira_posicao_a_partir(problema->posicoes, problema->n_pontos, problema->inicios[i]);
+            problema->faixa_fim[i] = fim == INT_MAX ? problema->n_pontos : primeira_posicao_a_partir(problema->posicoes, problema->n_pontos, fim + 1);
+            if (problema->faixa_fim[i] < problema->faixa_inicio[i])
+            {
+                problema->faixa_fim[i] = problema->faixa_inicio[i];
+            }
+        }
+        resultado = 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Pré-calcula o bitset de pontos cobertos por cada intervalo.
+ *
+ * Para cada intervalo `i`, o bit `j` da máscara `mascaras[i]` é ligado
+ * quando o ponto `j` pertence ao intervalo. Com isso, durante a busca,
+ * incluir um intervalo na solução passa a ser uma união de bitsets
+ * palavra a palavra, sem testar ponto por ponto.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ * @return 1 se as máscaras foram construídas, ou 0 em caso de falha de alocação.
+ */
+int construir_mascaras_backtracking(ProblemaBacktracking *problema)
+{
+    int resultado = 0;
+
+    problema->n_palavras = calcular_palavras_bitset(problema->n_pontos);
+    problema->mascaras = (uint64_t *)arena_alocar(&problema->arena, (size_t)problema->n_intervalos * problema->n_palavras * sizeof(uint64_t));
+    if (problema->mascaras != NULL)
+    {
+        memset(problema->mascaras, 0, (size_t)problema->n_intervalos * problema->n_palavras * sizeof(uint64_t));
+        for (int i = 0; i < problema->n_intervalos; i++)
+        {
+            uint64_t *mascara = problema->mascaras + (size_t)i * problema->n_palavras;
+            for (int j = problema->faixa_inicio[i]; j < problema->faixa_fim[i]; j++)
+            {
+                mascara[j / 64] |= UINT64_C(1) << (j % 64);
+            }
+        }
+        resultado = 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Inclui um intervalo na solução parcial, atualizando a cobertura.
+ *
+ * O intervalo é empilhado em `solucao_atual` (e seu índice em
+ * `indices_solucao_atual`) e a cobertura dos pontos é atualizada de
+ * forma incremental, sem alocações e sem recontar os intervalos já
+ * escolhidos:
+ * - no vetor de contadores, o contador de cada ponto da faixa do
+ *   intervalo é incrementado, e os pontos que passam de zero para um
+ *   intervalo incrementam `n_pontos_cobertos`;
+ * - no bitset, o nível seguinte da pilha recebe a união do nível atual
+ *   com a máscara do intervalo, e `n_pontos_cobertos` recebe o popcount
+ *   do resultado.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ * @param indice_intervalo Índice, em `intervalos`, do intervalo incluído.
+ */
+void incluir_intervalo_solucao(ProblemaBacktracking *problema, int indice_intervalo)
+{
+    Intervalo intervalo = problema->intervalos[indice_intervalo];
+
+    if (problema->configuracao.usar_bitset)
+    {
+        uint64_t *nivel = problema->cobertura_bits + (size_t)problema->n_solucao_atual * problema->n_palavras;
+        problema->n_pontos_cobertos = bitset_uniao_contar(nivel + problema->n_palavras, nivel,
+                                                          problema->mascaras + (size_t)indice_intervalo * problema->n_palavras,
+                                                          problema->n_palavras);
+    }
+    else
+    {
+        int *pontos_cobertos = problema->pontos_cobertos;
+        int fim = problema->faixa_fim[indice_intervalo];
+        int novos = 0;
+
+        for (int j = problema->faixa_inicio[indice_intervalo]; j < fim; j++)
+        {
+            novos += pontos_cobertos[j] == 0;
+            pontos_cobertos[j]++;
+        }
+        problema->n_pontos_cobertos += novos;
+    }
+
+    problema->solucao_atual[problema->n_solucao_atual] = intervalo;
+    problema->indices_solucao_atual[problema->n_solucao_atual] = indice_intervalo;
+    problema->n_solucao_atual++;
+}
+
+/**
+ * @brief Remove o último intervalo incluído na solução parcial (backtrack).
+ *
+ * Desfaz exatamente as alterações de `incluir_intervalo_solucao`:
+ * o intervalo do topo de `solucao_atual` é desempilhado e
+ * - no vetor de contadores, o contador de cada ponto da sua faixa é
+ *   decrementado, e pontos cujo contador volta a zero deixam de estar
+ *   cobertos;
+ * - no bitset, basta voltar ao nível anterior da pilha, recontando
+ *   seus bits.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ */
+void remover_intervalo_solucao(ProblemaBacktracking *problema)
+{
+    problema->n_solucao_atual--;
+    int indice_intervalo = problema->indices_solucao_atual[problema->n_solucao_atual];
+
+    if (problema->configuracao.usar_bitset)
+    {
+        problema->n_pontos_cobertos = bitset_contar(problema->cobertura_bits + (size_t)problema->n_solucao_atual * problema->n_palavras,
+                                                    problema->n_palavras);
+    }
+    else
+    {
+        int *pontos_cobertos = problema->pontos_cobertos;
+        int fim = problema->faixa_fim[indice_intervalo];
+        int descobertos = 0;
+
+        for (int j = problema->faixa_inicio[indice_intervalo]; j < fim; j++)
+        {
+            pontos_cobertos[j]--;
+            descobertos += pontos_cobertos[j] == 0;
+        }
+        problema->n_pontos_cobertos -= descobertos;
+    }
+}
+
+/**
+ * @brief Verifica se a solução parcial atual cobre todos os pontos do problema.
+ *
+ * A cobertura da solução parcial é mantida incrementalmente por
+ * `incluir_intervalo_solucao` e `remover_intervalo_solucao`, de modo
+ * que a verificação se resume a comparar a quantidade de pontos
+ * cobertos com o total de pontos, em tempo constante.
+ *
+ * A função é usada pelo algoritmo de backtracking para decidir
+ * se uma solução parcial já é válida (cobre todos os pontos)
+ * ou se ainda é necessário adicionar mais intervalos.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ * @return 1 se todos os pontos estiverem cobertos pela solução atual,
+ *         ou 0 caso contrário.
+ */
+int verificar_cobertura_parcial(ProblemaBacktracking *problema)
+{
+    int resultado = 0;
+    if (problema->n_pontos_cobertos == problema->n_pontos)
+    {
+        resultado = 1;
+    }
+    else
+    {
+        resultado = 0;
+    }
+    return resultado;
+}
+
+/**
+ * @brief Copia a solução atual para a melhor solução encontrada.
+ *
+ * Esta função é chamada quando o algoritmo de backtracking
+ * encontra uma solução válida melhor do que a melhor solução
+ * armazenada até o momento.
+ *
+ * Ela realiza uma cópia dos intervalos da solução atual
+ * (`solucao_atual`) para o vetor `melhor_solucao`, garantindo
+ * que a melhor combinação de intervalos seja preservada
+ * mesmo após o retorno das chamadas recursivas.
+ *
+ * A memória para a melhor solução é reservada na arena por
+ * `alocar_estruturas_busca`, antes do início da busca.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ */
+void copiar_solucao(ProblemaBacktracking *problema)
+{
+    if (problema->melhor_solucao != NULL)
+    {
+        for (int i = 0; i < problema->n_solucao_atual; i++)
+        {
+            problema->melhor_solucao[i] = problema->solucao_atual[i];
+        }
+        problema->n_melhor_solucao = problema->n_solucao_atual;
+    }
+}
+
+/**
+ * @brief Função recursiva principal do algoritmo de backtracking.
+ *
+ * Esta função explora o espaço de soluções do problema de cobertura
+ * de pontos, decidindo recursivamente se cada intervalo será
+ * incluído ou não na solução atual.
+ *
+ * A cada chamada, o algoritmo:
+ * - conta um novo nó visitado (métrica de complexidade);
+ * - verifica condições de parada;
+ * - aplica critérios de poda para reduzir o espaço de busca;
+ * - testa se a solução parcial cobre todos os pontos;
+ * - atualiza a melhor solução encontrada.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ * @param indice_intervalo Índice do intervalo atualmente considerado.
+ */
+void backtracking_recursivo(ProblemaBacktracking *problema, int indice_intervalo)
+{   
+    /**
+     * Incrementa o contador de nós visitados.
+     * Essa métrica indica quantos estados da árvore de busca
+     * foram efetivamente explorados pelo algoritmo.
+     */
+    problema->nos_visitados++;
+    if (indice_intervalo > problema->profundidade_maxima)
+    {
+        problema->profundidade_maxima = indice_intervalo;
+    }
+
+    /**
+     * Condição de parada:
+     * se todos os intervalos já foram considerados,
+     * não há mais decisões a serem tomadas.
+     */
+    if (indice_intervalo >= problema->n_intervalos)
+    {
+        return;
+    }
+
+    /**
+     * Poda baseada na melhor solução encontrada até o momento.
+     * Se a solução atual já é maior ou igual à melhor solução,
+     * não faz sentido continuar explorando esse ramo.
+     */
+    if (problema->n_solucao_atual >= problema->n_melhor_solucao)
+    {
+        return;
+    }
+
+    /**
+     * Verifica se a próxima escolha já torna impossível
+     * melhorar a melhor solução atual.
+     */
+    int pode_podar = 0;
+    if (problema->n_solucao_atual + 1 >= problema->n_melhor_solucao)
+    {
+        pode_podar = 1;
+    }
+
+    /**
+     * Caso não seja possível podar, tenta incluir o intervalo atual
+     * na solução.
+     */
+    if (pode_podar == 0)
+    {   
+        /**
+         * Inclui o intervalo atual na solução parcial, atualizando
+         * a cobertura dos pontos de forma incremental.
+         */
+        incluir_intervalo_solucao(problema, indice_intervalo);
+
+        /**
+         * Verifica se a solução parcial já cobre todos os pontos.
+         */
+        if (verificar_cobertura_parcial(problema))
+        {   
+            /**
+             * Caso a solução seja válida e melhor que a anterior,
+             * ela passa a ser a melhor solução encontrada.
+             */
+            if (problema->n_solucao_atual < problema->n_melhor_solucao)
+            {
+                copiar_solucao(problema);
+            }
+        }
+        else
+        {   
+            /**
+             * Caso ainda não cubra todos os pontos, continua a busca
+             * considerando o próximo intervalo.
+             */
+            backtracking_recursivo(problema, indice_intervalo + 1);
+        }
+
+        /**
+         * Remove o intervalo atual da solução (backtrack),
+         * restaurando o estado anterior antes de testar
+         * a próxima possibilidade.
+         */
+        remover_intervalo_solucao(problema);
+    }
+
+    /**
+     * Explora o ramo onde o intervalo atual NÃO é incluído
+     * na solução.
+     */
+    backtracking_recursivo(problema, indice_intervalo + 1);
+}
+
+/**
+ * @brief Define a busca clássica especializada para máscaras de tamanho fixo.
+ *
+ * Cada instanciação gera o tipo `BuscaPequena<bits>` e a função
+ * `busca_pequena_<bits>`, em que a cobertura de cada intervalo e a da
+ * solução parcial são um único valor de `TIPO` (uma palavra de 64 bits,
+ * ou duas em `unsigned __int128`). A cobertura desce pela recursão como
+ * argumento, em registradores, e todo o estado fica na pilha: não há
+ * contadores por ponto para atualizar nem para desfazer.
+ *
+ * A árvore percorrida é a mesma de `backtracking_recursivo`, nó a nó,
+ * de modo que a solução, os nós visitados e a profundidade máxima são
+ * idênticos aos da busca genérica. O ramo de exclusão, chamada final da
+ * recursão genérica, vira a próxima volta do laço.
+ */
+#define DEFINIR_BUSCA_PEQUENA(BITS, TIPO)                                                   \
+    typedef struct                                                                          \
+    {                                                                                       \
+        TIPO mascaras[MAX_INTERVALOS_PEQUENA]; /**< Pontos cobertos por cada intervalo */   \
+        TIPO completa; /**< Máscara com todos os pontos */                                  \
+        int n_intervalos; /**< Quantidade de intervalos */                                  \
+        int escolhas[MAX_INTERVALOS_PEQUENA]; /**< Índices da solução parcial */            \
+        int melhor[MAX_INTERVALOS_PEQUENA]; /**< Índices da melhor solução */               \
+        int n_melhor; /**< Tamanho da melhor solução, ou INT_MAX */                         \
+        int profundidade_maxima; /**< Maior índice de intervalo alcançado */                \
+    } BuscaPequena##BITS;                                                                   \
+                                                                                            \
+    int64_t busca_pequena_##BITS(BuscaPequena##BITS *busca, int indice_intervalo, int n_escolhas, TIPO cobertura) \
+    {                                                                                       \
+        int64_t nos_visitados = 1;                                                          \
+                                                                                            \
+        while (indice_intervalo < busca->n_intervalos && n_escolhas < busca->n_melhor)       \
+        {                                                                                   \
+            if (n_escolhas + 1 < busca->n_melhor)                                           \
+            {                                                                               \
+                TIPO nova = cobertura | busca->mascaras[indice_intervalo];                  \
+                busca->escolhas[n_escolhas] = indice_intervalo;                             \
+                if (nova == busca->completa)                                                \
+                {                                                                           \
+                    memcpy(busca->melhor, busca->escolhas, (n_escolhas + 1) * sizeof(int)); \
+                    busca->n_melhor = n_escolhas + 1;                                       \
+                }                                                                           \
+                else                                                                        \
+                {                                                                           \
+                    nos_visitados += busca_pequena_##BITS(busca, indice_intervalo + 1, n_escolhas + 1, nova); \
+                }                                                                           \
+            }                                                                               \
+            indice_intervalo++;                                                             \
+            nos_visitados++;                                                                \
+        }                                                                                   \
+        if (indice_intervalo > busca->profundidade_maxima)                                  \
+        {                                                                                   \
+            busca->profundidade_maxima = indice_intervalo;                                  \
+        }                                                                                   \
+                                                                                            \
+        return nos_visitados;                                                               \
+    }                                                                                       \
+                                                                                            \
+    void executar_busca_pequena_##BITS(ProblemaBacktracking *problema)                      \
+    {                                                                                       \
+        BuscaPequena##BITS busca;                                                           \
+                                                                                            \
+        busca.completa = 0;                                                                 \
+        for (int j = 0; j < problema->n_pontos; j++)                                        \
+        {                                                                                   \
+            busca.completa |= (TIPO)1 << j;                                                 \
+        }                                                                                   \
+        for (int i = 0; i < problema->n_intervalos; i++)                                    \
+        {                                                                                   \
+            busca.mascaras[i] = 0;                                                          \
+            for (int j = problema->faixa_inicio[i]; j < problema->faixa_fim[i]; j++)        \
+            {                                                                               \
+                busca.mascaras[i] |= (TIPO)1 << j;                                          \
+            }                                                                               \
+        }                                                                                   \
+        busca.n_intervalos = problema->n_intervalos;                                        \
+        busca.n_melhor = INT_MAX;                                                           \
+        busca.profundidade_maxima = 0;                                                      \
+                                                                                            \
+        problema->nos_visitados = busca_pequena_##BITS(&busca, 0, 0, 0);                    \
+                                                                                            \
+        if (busca.n_melhor != INT_MAX)                                                      \
+        {                                                                                   \
+            for (int i = 0; i < busca.n_melhor; i++)                                        \
+            {                                                                               \
+                problema->melhor_solucao[i] = problema->intervalos[busca.melhor[i]];        \
+            }                                                                               \
+            problema->n_melhor_solucao = busca.n_melhor;                                    \
+        }                                                                                   \
+        problema->profundidade_maxima = busca.profundidade_maxima;                          \
+    }
+
+DEFINIR_BUSCA_PEQUENA(64, uint64_t)
+#ifdef __SIZEOF_INT128__
+DEFINIR_BUSCA_PEQUENA(128, unsigned __int128)
+#endif
+
+/**
+ * @brief Executa a busca clássica com o núcleo especializado, se a instância couber nele.
+ *
+ * Instâncias com até 64 pontos usam `busca_pequena_64`, em que a
+ * cobertura é uma palavra de 64 bits; com até `MAX_PONTOS_PEQUENA`
+ * pontos, `busca_pequena_128`. Em ambos os casos há no máximo
+ * `MAX_INTERVALOS_PEQUENA` intervalos. Nas instâncias maiores nada é
+ * feito, e a busca genérica (`backtracking_recursivo`) deve ser usada.
+ *
+ * Só o motor clássico passa por aqui. O núcleo percorre a árvore
+ * exaustiva de incluir/excluir cada intervalo: o motor com poda
+ * ramifica só no ponto descoberto mais à esquerda e resolve em poucos
+ * nós instâncias que custam centenas de milhões de nós ao núcleo; o
+ * iterativo existe para percorrer a mesma árvore com pilha explícita;
+ * o limitado precisa verificar o orçamento durante a busca, e o
+ * paralelo divide a árvore em tarefas entre threads.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema,
+ *        com as faixas dos intervalos já calculadas.
+ * @return 1 se a busca foi executada, ou 0 se a instância não cabe no núcleo.
+ */
+int busca_pequena_backtracking(ProblemaBacktracking *problema)
+{
+    int resultado = 0;
+
+    if (problema->n_intervalos <= MAX_INTERVALOS_PEQUENA)
+    {
+        if (problema->n_pontos <= 64)
+        {
+            executar_busca_pequena_64(problema);
+            resultado = 1;
+        }
+#ifdef __SIZEOF_INT128__
+        else if (problema->n_pontos <= MAX_PONTOS_PEQUENA)
+        {
+            executar_busca_pequena_128(problema);
+            resultado = 1;
+        }
+#endif
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Prepara a pilha de quadros para uma nova busca iterativa.
+ *
+ * Empilha o quadro inicial, equivalente à chamada
+ * `backtracking_recursivo(problema, 0)`. A solução parcial e a
+ * cobertura devem estar vazias.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema,
+ *        com a pilha de quadros já alocada.
+ */
+void iniciar_backtracking_iterativo(ProblemaBacktracking *problema)
+{
+    problema->pilha_busca[0].indice_intervalo = 0;
+    problema->pilha_busca[0].fase = FASE_QUADRO_ENTRADA;
+    problema->n_pilha_busca = 1;
+}
+
+/**
+ * @brief Versão iterativa de `backtracking_recursivo`, com pilha explícita.
+ *
+ * Cada quadro de `pilha_busca` corresponde a uma chamada recursiva
+ * pendente. A exclusão do intervalo é a última ação da chamada
+ * recursiva, por isso é feita reaproveitando o próprio quadro; só a
+ * inclusão empilha um quadro novo, e a pilha nunca passa de
+ * `n_intervalos + 1` quadros.
+ *
+ * Os nós são visitados na mesma ordem e com as mesmas podas da versão
+ * recursiva, de modo que a solução e `nos_visitados` são idênticos.
+ *
+ * A busca pode ser interrompida após `limite_nos` nós e retomada mais
+ * tarde, chamando a função novamente: todo o estado fica em
+ * `pilha_busca`, `solucao_atual` e na cobertura do problema.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema,
+ *        preparado por `iniciar_backtracking_iterativo`.
+ * @param limite_nos Quantidade máxima de nós visitados nesta chamada,
+ *        ou um valor menor ou igual a zero para não limitar.
+ * @return 1 se a busca terminou, ou 0 se foi interrompida pelo limite.
+ */
+int backtracking_iterativo(ProblemaBacktracking *problema, int64_t limite_nos)
+{
+    int64_t nos_nesta_chamada = 0;
+
+    while (problema->n_pilha_busca > 0)
+    {
+        QuadroBusca *quadro = &problema->pilha_busca[problema->n_pilha_busca - 1];
+
+        if (quadro->fase == FASE_QUADRO_APOS_INCLUSAO)
+        {
+            /**
+             * Retorno do ramo de inclusão: desfaz a inclusão e segue
+             * para o ramo de exclusão no mesmo quadro.
+             */
+            remover_intervalo_solucao(problema);
+            quadro->indice_intervalo++;
+            quadro->fase = FASE_QUADRO_ENTRADA;
+            continue;
+        }
+
+        if (limite_nos > 0 && nos_nesta_chamada >= limite_nos)
+        {
+            return 0;
+        }
+        nos_nesta_chamada++;
+        problema->nos_visitados++;
+
+        int indice_intervalo = quadro->indice_intervalo;
+
+        if (indice_intervalo >= problema->n_intervalos || problema->n_solucao_atual >= problema->n_melhor_solucao)
+        {
+            problema->n_pilha_busca--;
+            continue;
+        }
+
+        if (problema->n_solucao_atual + 1 < problema->n_melhor_solucao)
+        {
+            incluir_intervalo_solucao(problema, indice_intervalo);
+            if (verificar_cobertura_parcial(problema))
+            {
+                if (problema->n_solucao_atual < problema->n_melhor_solucao)
+                {
+                    copiar_solucao(problema);
+                }
+                remover_intervalo_solucao(problema);
+            }
+            else
+            {
+                quadro->fase = FASE_QUADRO_APOS_INCLUSAO;
+                QuadroBusca *filho = &problema->pilha_busca[problema->n_pilha_busca];
+                filho->indice_intervalo = indice_intervalo + 1;
+                filho->fase = FASE_QUADRO_ENTRADA;
+                problema->n_pilha_busca++;
+                if (problema->n_pilha_busca - 1 > problema->profundidade_maxima)
+                {
+                    problema->profundidade_maxima = problema->n_pilha_busca - 1;
+                }
+                continue;
+            }
+        }
+
+        quadro->indice_intervalo = indice_intervalo + 1;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Indica se um ponto está coberto pela solução parcial atual.
+ *
+ * Consulta o contador do ponto ou, na representação em bitset, o bit
+ * do ponto no nível corrente da pilha de cobertura.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ * @param indice_ponto Índice do ponto consultado.
+ * @return 1 se o ponto estiver coberto, ou 0 caso contrário.
+ */
+int ponto_coberto_solucao(ProblemaBacktracking *problema, int indice_ponto)
+{
+    int resultado = 0;
+    if (problema->configuracao.usar_bitset)
+    {
+        const uint64_t *nivel = problema->cobertura_bits + (size_t)problema->n_solucao_atual * problema->n_palavras;
+        resultado = (int)((nivel[indice_ponto / 64] >> (indice_ponto % 64)) & 1);
+    }
+    else
+    {
+        resultado = problema->pontos_cobertos[indice_ponto] > 0;
+    }
+    return resultado;
+}
+
+/**
+ * @brief Prepara os dados auxiliares do motor de backtracking com poda.
+ *
+ * Com os pontos já ordenados por posição (ver `resolver_backtracking`)
+ * e uma cópia dos intervalos ordenada por início, calcula em uma única
+ * varredura o intervalo que cobre cada
+ * ponto e alcança mais à direita (`alcance_ponto`). Se nenhum intervalo
+ * cobre o ponto, o alcance registrado termina antes dele.
+ *
+ * Em seguida, semeia a melhor solução com a solução gulosa obtida a
+ * partir desses alcances: partindo do ponto mais à esquerda, escolhe o
+ * intervalo de maior alcance e salta para o primeiro ponto além dele.
+ * Essa é a mesma estratégia do motor de varredura do algoritmo guloso,
+ * e fornece à busca um limitante superior inicial.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ * @return 1 se a preparação foi concluída, ou 0 em caso de falha de alocação.
+ */
+int preparar_busca_com_poda(ProblemaBacktracking *problema)
+{
+    int resultado = 0;
+
+    problema->intervalos_por_inicio = (Intervalo *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(Intervalo));
+    problema->alcance_ponto = (Intervalo *)arena_alocar(&problema->arena, problema->n_pontos * sizeof(Intervalo));
+
+    if (problema->intervalos_por_inicio != NULL && problema->alcance_ponto != NULL && problema->melhor_solucao != NULL)
+    {
+        int proximo_intervalo = 0;
+        Intervalo melhor = {INT_MIN, INT_MIN};
+
+        memcpy(problema->intervalos_por_inicio, problema->intervalos, problema->n_intervalos * sizeof(Intervalo));
+        qsort(problema->intervalos_por_inicio, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos_por_inicio);
+
+        for (int j = 0; j < problema->n_pontos; j++)
+        {
+            while (proximo_intervalo < problema->n_intervalos &&
+                   problema->intervalos_por_inicio[proximo_intervalo].inicio <= problema->posicoes[j])
+            {
+                if (problema->intervalos_por_inicio[proximo_intervalo].fim > melhor.fim)
+                {
+                    melhor = problema->intervalos_por_inicio[proximo_intervalo];
+                }
+                proximo_intervalo++;
+            }
+            problema->alcance_ponto[j] = melhor;
+        }
+
+        int n_gulosa = 0;
+        int j = 0;
+        while (j < problema->n_pontos && problema->alcance_ponto[j].fim >= problema->posicoes[j])
+        {
+            Intervalo escolhido = problema->alcance_ponto[j];
+            problema->melhor_solucao[n_gulosa] = escolhido;
+            n_gulosa++;
+            while (j < problema->n_pontos && problema->posicoes[j] <= escolhido.fim)
+            {
+                j++;
+            }
+        }
+        if (j == problema->n_pontos)
+        {
+            problema->n_melhor_solucao = n_gulosa;
+        }
+
+        resultado = 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Calcula um limitante inferior para completar a cobertura.
+ *
+ * Percorre os pontos descobertos a partir de `indice_ponto` e seleciona,
+ * da esquerda para a direita, pontos que nenhum intervalo consegue
+ * cobrir em conjunto: após escolher um ponto, todos os pontos até o
+ * alcance máximo dos intervalos que o cobrem são ignorados. Cada ponto
+ * escolhido exige um intervalo distinto, então a quantidade de pontos
+ * escolhidos nunca supera o número de intervalos que ainda faltam
+ * (limitante admissível).
+ *
+ * Se algum ponto descoberto não é coberto por nenhum intervalo, não há
+ * como completar a solução e o limitante retornado é `INT_MAX`.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ * @param indice_ponto Índice do ponto descoberto mais à esquerda.
+ * @return Quantidade mínima de intervalos ainda necessários.
+ */
+int limite_inferior_poda(ProblemaBacktracking *problema, int indice_ponto)
+{
+    int limite = 0;
+    int j = indice_ponto;
+
+    while (j < problema->n_pontos && limite != INT_MAX)
+    {
+        if (ponto_coberto_solucao(problema, j))
+        {
+            j++;
+        }
+        else if (problema->alcance_ponto[j].fim < problema->posicoes[j])
+        {
+            limite = INT_MAX;
+        }
+        else
+        {
+            int alcance = problema->alcance_ponto[j].fim;
+            limite++;
+            while (j < problema->n_pontos && problema->posicoes[j] <= alcance)
+            {
+                j++;
+            }
+        }
+    }
+
+    return limite;
+}
+
+/**
+ * @brief Busca com poda (branch-and-bound) guiada pelo ponto descoberto mais à esquerda.
+ *
+ * Em vez de decidir incluir ou excluir cada um dos intervalos, a busca
+ * ramifica apenas sobre os intervalos que cobrem o ponto descoberto mais
+ * à esquerda, já que toda solução precisa conter um deles. Com os pontos
+ * ordenados, esse ponto nunca retrocede ao descer na árvore, e a procura
+ * continua a partir de `indice_ponto`.
+ *
+ * Antes de ramificar, o ramo é podado quando a solução parcial somada ao
+ * limitante inferior de `limite_inferior_poda` não pode melhorar a
+ * melhor solução, que começa semeada pela solução gulosa.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ * @param indice_ponto Índice a partir do qual procurar o próximo ponto descoberto.
+ */
+void backtracking_com_poda(ProblemaBacktracking *problema, int indice_ponto)
+{
+    problema->nos_visitados++;
+    if (problema->n_solucao_atual > problema->profundidade_maxima)
+    {
+        problema->profundidade_maxima = problema->n_solucao_atual;
+    }
+
+    while (indice_ponto < problema->n_pontos && ponto_coberto_solucao(problema, indice_ponto))
+    {
+        indice_ponto++;
+    }
+
+    /**
+     * Todos os pontos cobertos: a solução parcial é completa.
+     */
+    if (indice_ponto >= problema->n_pontos)
+    {
+        if (problema->n_solucao_atual < problema->n_melhor_solucao)
+        {
+            copiar_solucao(problema);
+        }
+        return;
+    }
+
+    /**
+     * Poda pelo limitante inferior: mesmo no melhor caso, completar
+     * a cobertura não produziria uma solução melhor que a atual.
+     */
+    int limite = limite_inferior_poda(problema, indice_ponto);
+    if (limite == INT_MAX || problema->n_solucao_atual + limite >= problema->n_melhor_solucao)
+    {
+        return;
+    }
+
+    for (int i = 0; i < problema->n_intervalos; i++)
+    {
+        if (problema->faixa_inicio[i] <= indice_ponto && indice_ponto < problema->faixa_fim[i])
+        {
+            incluir_intervalo_solucao(problema, i);
+            backtracking_com_poda(problema, indice_ponto + 1);
+            remover_intervalo_solucao(problema);
+
+            if (problema->n_solucao_atual + limite >= problema->n_melhor_solucao)
+            {
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Monta a chave de comparação de uma solução da busca paralela.
+ *
+ * @param tamanho Quantidade de intervalos da solução.
+ * @param tarefa Índice da tarefa em que a solução foi encontrada.
+ * @return Chave em que valores menores representam soluções melhores.
+ */
+uint64_t chave_solucao_paralela(int tamanho, uint64_t tarefa)
+{
+    return ((uint64_t)(uint32_t)tamanho << 32) | tarefa;
+}
+
+/**
+ * @brief Registra uma nova tarefa da busca paralela.
+ *
+ * @param contexto Contexto da busca paralela.
+ * @param n_prefixo Quantidade de intervalos incluídos no prefixo corrente.
+ * @param indice_intervalo Próximo intervalo a decidir.
+ * @param completa 1 se o prefixo já cobre todos os pontos.
+ * @return 1 se a tarefa foi registrada, ou 0 em caso de falha de alocação.
+ */
+int adicionar_tarefa_paralela(ContextoParalelo *contexto, int n_prefixo, int indice_intervalo, int completa)
+{
+    int resultado = 1;
+
+    if (contexto->n_tarefas == contexto->capacidade_tarefas)
+    {
+        int capacidade = contexto->capacidade_tarefas == 0 ? 64 : contexto->capacidade_tarefas * 2;
+        TarefaBusca *tarefas = (TarefaBusca *)memoria_realocar(&contexto->problema->memoria, contexto->tarefas, capacidade * sizeof(TarefaBusca));
+        if (tarefas == NULL)
+        {
+            resultado = 0;
+        }
+        else
+        {
+            contexto->tarefas = tarefas;
+            contexto->capacidade_tarefas = capacidade;
+        }
+    }
+    if (resultado == 1 && contexto->n_escolhas + n_prefixo > contexto->capacidade_escolhas)
+    {
+        int capacidade = contexto->capacidade_escolhas == 0 ? 256 : contexto->capacidade_escolhas * 2;
+        while (capacidade < contexto->n_escolhas + n_prefixo)
+        {
+            capacidade *= 2;
+        }
+        int *escolhas = (int *)memoria_realocar(&contexto->problema->memoria, contexto->escolhas, capacidade * sizeof(int));
+        if (escolhas == NULL)
+        {
+            resultado = 0;
+        }
+        else
+        {
+            contexto->escolhas = escolhas;
+            contexto->capacidade_escolhas = capacidade;
+        }
+    }
+
+    if (resultado == 1)
+    {
+        TarefaBusca *tarefa = &contexto->tarefas[contexto->n_tarefas];
+        tarefa->inicio_escolhas = contexto->n_escolhas;
+        tarefa->n_escolhas = n_prefixo;
+        tarefa->indice_intervalo = indice_intervalo;
+        tarefa->completa = completa;
+        if (n_prefixo > 0)
+        {
+            memcpy(contexto->escolhas + contexto->n_escolhas, contexto->prefixo, n_prefixo * sizeof(int));
+        }
+        contexto->n_escolhas += n_prefixo;
+        contexto->n_tarefas++;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Divide a árvore de busca clássica em tarefas até a profundidade de divisão.
+ *
+ * Percorre a árvore de incluir/excluir na mesma ordem de
+ * `backtracking_recursivo`, sem podar (ainda não há solução conhecida).
+ * Ao atingir a profundidade de divisão, ou quando a inclusão de um
+ * intervalo já cobre todos os pontos, o prefixo corrente vira uma tarefa.
+ * Os nós em que a árvore é cortada são contados pelo trabalhador que
+ * executar a tarefa correspondente.
+ *
+ * @param contexto Contexto da busca paralela.
+ * @param indice_intervalo Intervalo atualmente considerado.
+ * @param profundidade Profundidade atual na árvore de busca.
+ * @return 1 se a divisão foi concluída, ou 0 em caso de falha de alocação.
+ */
+int gerar_tarefas_paralelas(ContextoParalelo *contexto, int indice_intervalo, int profundidade)
+{
+    ProblemaBacktracking *problema = contexto->problema;
+    int resultado = 1;
+
+    if (indice_intervalo >= problema->n_intervalos || profundidade >= problema->configuracao.profundidade_divisao)
+    {
+        resultado = adicionar_tarefa_paralela(contexto, problema->n_solucao_atual, indice_intervalo, 0);
+    }
+    else
+    {
+        problema->nos_visitados++;
+        contexto->prefixo[problema->n_solucao_atual] = indice_intervalo;
+        incluir_intervalo_solucao(problema, indice_intervalo);
+        if (verificar_cobertura_parcial(problema))
+        {
+            resultado = adicionar_tarefa_paralela(contexto, problema->n_solucao_atual, indice_intervalo + 1, 1);
+        }
+        else
+        {
+            resultado = gerar_tarefas_paralelas(contexto, indice_intervalo + 1, profundidade + 1);
+        }
+        remover_intervalo_solucao(problema);
+
+        if (resultado == 1)
+        {
+            resultado = gerar_tarefas_paralelas(contexto, indice_intervalo + 1, profundidade + 1);
+        }
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Tenta registrar a solução parcial de um trabalhador como a melhor.
+ *
+ * A solução só é aceita se sua chave for menor que a do incumbente,
+ * verificação refeita sob a trava para que a chave e os intervalos
+ * copiados para `melhor_solucao` permaneçam consistentes.
+ *
+ * @param trabalhador Trabalhador que encontrou a solução.
+ */
+void registrar_solucao_paralela(TrabalhadorBusca *trabalhador)
+{
+    ContextoParalelo *contexto = trabalhador->contexto;
+    ProblemaBacktracking *local = &trabalhador->local;
+    uint64_t chave = chave_solucao_paralela(local->n_solucao_atual, trabalhador->tarefa_atual);
+
+    pthread_mutex_lock(&contexto->trava_incumbente);
+    if (chave < atomic_load(&contexto->incumbente))
+    {
+        memcpy(contexto->problema->melhor_solucao, local->solucao_atual, local->n_solucao_atual * sizeof(Intervalo));
+        atomic_store(&contexto->incumbente, chave);
+    }
+    pthread_mutex_unlock(&contexto->trava_incumbente);
+}
+
+/**
+ * @brief Busca de incluir/excluir executada por um trabalhador em uma subárvore.
+ *
+ * Segue a mesma ordem de `backtracking_recursivo`, mas poda contra o
+ * incumbente global: um intervalo só é incluído se a solução resultante
+ * ainda puder vencer a melhor solução conhecida por todos os trabalhadores.
+ *
+ * @param trabalhador Trabalhador que executa a busca.
+ * @param indice_intervalo Índice do intervalo atualmente considerado.
+ */
+void backtracking_recursivo_paralelo(TrabalhadorBusca *trabalhador, int indice_intervalo)
+{
+    ProblemaBacktracking *local = &trabalhador->local;
+
+    local->nos_visitados++;
+    if (indice_intervalo > local->profundidade_maxima)
+    {
+        local->profundidade_maxima = indice_intervalo;
+    }
+
+    if (indice_intervalo >= local->n_intervalos)
+    {
+        return;
+    }
+
+    /**
+     * Qualquer solução desta subárvore terá ao menos mais um intervalo;
+     * se nem assim vence o incumbente, nenhum dos dois ramos precisa ser explorado.
+     */
+    if (chave_solucao_paralela(local->n_solucao_atual + 1, trabalhador->tarefa_atual) >= atomic_load(&trabalhador->contexto->incumbente))
+    {
+        return;
+    }
+
+    incluir_intervalo_solucao(local, indice_intervalo);
+    if (verificar_cobertura_parcial(local))
+    {
+        registrar_solucao_paralela(trabalhador);
+    }
+    else
+    {
+        backtracking_recursivo_paralelo(trabalhador, indice_intervalo + 1);
+    }
+    remover_intervalo_solucao(local);
+
+    backtracking_recursivo_paralelo(trabalhador, indice_intervalo + 1);
+}
+
+/**
+ * @brief Executa uma tarefa da busca paralela.
+ *
+ * Reconstrói a cobertura do prefixo da tarefa no estado do trabalhador
+ * e, conforme o caso, registra o prefixo como solução ou continua a
+ * busca na subárvore a partir do próximo intervalo.
+ *
+ * @param trabalhador Trabalhador que executa a tarefa.
+ * @param indice_tarefa Índice da tarefa.
+ */
+void executar_tarefa_paralela(TrabalhadorBusca *trabalhador, int indice_tarefa)
+{
+    ContextoParalelo *contexto = trabalhador->contexto;
+    ProblemaBacktracking *local = &trabalhador->local;
+    TarefaBusca tarefa = contexto->tarefas[indice_tarefa];
+
+    trabalhador->tarefa_atual = (uint64_t)indice_tarefa;
+
+    if (chave_solucao_paralela(tarefa.n_escolhas + (tarefa.completa ? 0 : 1), trabalhador->tarefa_atual) < atomic_load(&contexto->incumbente))
+    {
+        local->n_solucao_atual = 0;
+        local->n_pontos_cobertos = 0;
+        if (local->configuracao.usar_bitset == 0)
+        {
+            memset(local->pontos_cobertos, 0, local->n_pontos * sizeof(int));
+        }
+        for (int k = 0; k < tarefa.n_escolhas; k++)
+        {
+            incluir_intervalo_solucao(local, contexto->escolhas[tarefa.inicio_escolhas + k]);
+        }
+
+        if (tarefa.completa)
+        {
+            registrar_solucao_paralela(trabalhador);
+        }
+        else
+        {
+            backtracking_recursivo_paralelo(trabalhador, tarefa.indice_intervalo);
+        }
+    }
+}
+
+/**
+ * @brief Obtém a próxima tarefa de um trabalhador, roubando de outros se necessário.
+ *
+ * O trabalhador consome primeiro sua própria fila, pelo início. Quando
+ * ela esvazia, percorre as filas dos demais e rouba a última tarefa da
+ * primeira fila não vazia. Como nenhuma tarefa nova é criada durante a
+ * busca, filas todas vazias significam que o trabalho terminou.
+ *
+ * @param trabalhador Trabalhador que procura trabalho.
+ * @return Índice da tarefa obtida, ou -1 se não houver mais tarefas.
+ */
+int obter_tarefa_paralela(TrabalhadorBusca *trabalhador)
+{
+    ContextoParalelo *contexto = trabalhador->contexto;
+    int tarefa = -1;
+
+    for (int k = 0; k < contexto->n_threads && tarefa == -1; k++)
+    {
+        FilaTarefas *fila = &contexto->filas[(trabalhador->indice + k) % contexto->n_threads];
+
+        pthread_mutex_lock(&fila->trava);
+        if (fila->inicio < fila->fim)
+        {
+            if (k == 0)
+            {
+                tarefa = fila->inicio;
+                fila->inicio++;
+            }
+            else
+            {
+                fila->fim--;
+                tarefa = fila->fim;
+            }
+        }
+        pthread_mutex_unlock(&fila->trava);
+    }
+
+    return tarefa;
+}
+
+/**
+ * @brief Laço principal de um trabalhador da busca paralela.
+ *
+ * @param argumento Ponteiro para o `TrabalhadorBusca`.
+ * @return Sempre NULL.
+ */
+void *executar_trabalhador_paralelo(void *argumento)
+{
+    TrabalhadorBusca *trabalhador = (TrabalhadorBusca *)argumento;
+    int tarefa = obter_tarefa_paralela(trabalhador);
+
+    while (tarefa != -1)
+    {
+        executar_tarefa_paralela(trabalhador, tarefa);
+        tarefa = obter_tarefa_paralela(trabalhador);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Libera os recursos da busca paralela.
+ *
+ * Só as tarefas e os prefixos, que crescem durante a divisão da
+ * árvore, vêm do heap; o restante está na arena e volta com ela.
+ *
+ * @param contexto Contexto da busca paralela.
+ */
+void liberar_contexto_paralelo(ContextoParalelo *contexto)
+{
+    ContabilidadeMemoria *memoria = &contexto->problema->memoria;
+
+    if (contexto->filas != NULL)
+    {
+        for (int t = 0; t < contexto->n_threads; t++)
+        {
+            pthread_mutex_destroy(&contexto->filas[t].trava);
+        }
+    }
+    memoria_liberar(memoria, contexto->tarefas);
+    memoria_liberar(memoria, contexto->escolhas);
+    pthread_mutex_destroy(&contexto->trava_incumbente);
+}
+
+/**
+ * @brief Resolve o problema com a busca clássica distribuída entre threads.
+ *
+ * A árvore de busca é dividida em tarefas na profundidade
+ * `configuracao.profundidade_divisao` e as tarefas são distribuídas em
+ * blocos contíguos entre `configuracao.n_threads` trabalhadores, que
+ * roubam tarefas uns dos outros quando ficam sem trabalho. Todos podam
+ * contra o mesmo incumbente atômico.
+ *
+ * O número de nós visitados por cada trabalhador é guardado em
+ * `nos_por_thread`; `nos_visitados` recebe a soma deles com os nós
+ * percorridos na divisão da árvore.
+ *
+ * Com uma única thread não há com quem dividir as tarefas, e a busca
+ * por tarefas, que atualiza a cobertura em memória e não usa o núcleo
+ * de instâncias pequenas, chega a ser duas vezes mais lenta que a
+ * clássica: nesse caso a busca clássica serial é executada no lugar,
+ * com a mesma solução.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema,
+ *        com as estruturas de busca já alocadas.
+ * @return 1 se a busca foi concluída, ou 0 em caso de falha de alocação.
+ */
+int backtracking_paralelo(ProblemaBacktracking *problema)
+{
+    ContextoParalelo contexto;
+    int n_threads = problema->configuracao.n_threads > 0 ? problema->configuracao.n_threads : 1;
+    int resultado = 0;
+
+    if (n_threads == 1)
+    {
+        problema->nos_por_thread = (int64_t *)arena_alocar(&problema->arena, sizeof(int64_t));
+        if (problema->nos_por_thread != NULL)
+        {
+            if (busca_pequena_backtracking(problema) == 0)
+            {
+                backtracking_recursivo(problema, 0);
+            }
+            problema->nos_por_thread[0] = problema->nos_visitados;
+            problema->n_threads_utilizadas = 1;
+            resultado = 1;
+        }
+        return resultado;
+    }
+
+    memset(&contexto, 0, sizeof(ContextoParalelo));
+    contexto.problema = problema;
+    contexto.n_threads = n_threads;
+    atomic_init(&contexto.incumbente, chave_solucao_paralela(INT_MAX, UINT32_MAX));
+    pthread_mutex_init(&contexto.trava_incumbente, NULL);
+
+    problema->nos_por_thread = (int64_t *)arena_alocar(&problema->arena, (size_t)n_threads * sizeof(int64_t));
+    problema->n_threads_utilizadas = 0;
+    contexto.prefixo = (int *)arena_alocar(&problema->arena, (size_t)(problema->n_intervalos + 1) * sizeof(int));
+    contexto.filas = (FilaTarefas *)arena_alocar(&problema->arena, (size_t)n_threads * sizeof(FilaTarefas));
+    contexto.trabalhadores = (TrabalhadorBusca *)arena_alocar(&problema->arena, (size_t)n_threads * sizeof(TrabalhadorBusca));
+    if (contexto.filas != NULL)
+    {
+        memset(contexto.filas, 0, (size_t)n_threads * sizeof(FilaTarefas));
+        for (int t = 0; t < n_threads; t++)
+        {
+            pthread_mutex_init(&contexto.filas[t].trava, NULL);
+        }
+    }
+
+    if (problema->melhor_solucao != NULL && problema->nos_por_thread != NULL && contexto.prefixo != NULL &&
+        contexto.filas != NULL && contexto.trabalhadores != NULL)
+    {
+        resultado = 1;
+        memset(contexto.trabalhadores, 0, (size_t)n_threads * sizeof(TrabalhadorBusca));
+        if (gerar_tarefas_paralelas(&contexto, 0, 0) == 0)
+        {
+            resultado = 0;
+        }
+    }
+
+    for (int t = 0; t < n_threads && resultado == 1; t++)
+    {
+        TrabalhadorBusca *trabalhador = &contexto.trabalhadores[t];
+
+        contexto.filas[t].inicio = (int)((int64_t)contexto.n_tarefas * t / n_threads);
+        contexto.filas[t].fim = (int)((int64_t)contexto.n_tarefas * (t + 1) / n_threads);
+        trabalhador->contexto = &contexto;
+        trabalhador->indice = t;
+        trabalhador->local = *problema;
+        trabalhador->local.melhor_solucao = NULL;
+        trabalhador->local.nos_visitados = 0;
+        trabalhador->local.profundidade_maxima = 0;
+        trabalhador->local.solucao_atual = (Intervalo *)arena_alocar(&problema->arena, (size_t)problema->n_intervalos * sizeof(Intervalo));
+        trabalhador->local.indices_solucao_atual = (int *)arena_alocar(&problema->arena, (size_t)problema->n_intervalos * sizeof(int));
+        trabalhador->local.pontos_cobertos = NULL;
+        trabalhador->local.cobertura_bits = NULL;
+        if (problema->configuracao.usar_bitset)
+        {
+            trabalhador->local.cobertura_bits = (uint64_t *)arena_alocar(&problema->arena, (size_t)(problema->n_intervalos + 1) * problema->n_palavras * sizeof(uint64_t));
+            if (trabalhador->local.cobertura_bits != NULL)
+            {
+                memset(trabalhador->local.cobertura_bits, 0, problema->n_palavras * sizeof(uint64_t));
+            }
+        }
+        else
+        {
+            trabalhador->local.pontos_cobertos = (int *)arena_alocar(&problema->arena, (size_t)problema->n_pontos * sizeof(int));
+        }
+
+        if (trabalhador->local.solucao_atual == NULL || trabalhador->local.indices_solucao_atual == NULL ||
+            (trabalhador->local.cobertura_bits == NULL && trabalhador->local.pontos_cobertos == NULL))
+        {
+            resultado = 0;
+        }
+    }
+
+    if (resultado == 1)
+    {
+        for (int t = 1; t < n_threads; t++)
+        {
+            contexto.trabalhadores[t].iniciada =
+                pthread_create(&contexto.trabalhadores[t].thread, NULL, executar_trabalhador_paralelo, &contexto.trabalhadores[t]) == 0;
+        }
+
+        /**
+         * A thread chamadora atua como o trabalhador 0. Trabalhadores cuja
+         * thread não pôde ser criada não perdem tarefas: suas filas são
+         * esvaziadas por roubo.
+         */
+        executar_trabalhador_paralelo(&contexto.trabalhadores[0]);
+
+        for (int t = 1; t < n_threads; t++)
+        {
+            if (contexto.trabalhadores[t].iniciada)
+            {
+                pthread_join(contexto.trabalhadores[t].thread, NULL);
+            }
+        }
+
+        for (int t = 0; t < n_threads; t++)
+        {
+            problema->nos_por_thread[t] = contexto.trabalhadores[t].local.nos_visitados;
+            problema->nos_visitados += contexto.trabalhadores[t].local.nos_visitados;
+            if (contexto.trabalhadores[t].local.profundidade_maxima > problema->profundidade_maxima)
+            {
+                problema->profundidade_maxima = contexto.trabalhadores[t].local.profundidade_maxima;
+            }
+        }
+        problema->n_threads_utilizadas = n_threads;
+
+        uint64_t incumbente = atomic_load(&contexto.incumbente);
+        if ((int)(incumbente >> 32) != INT_MAX)
+        {
+            problema->n_melhor_solucao = (int)(incumbente >> 32);
+        }
+    }
+
+    liberar_contexto_paralelo(&contexto);
+
+    return resultado;
+}
+
+/**
+ * @brief Calcula o tempo decorrido desde um instante, em milissegundos.
+ *
+ * @param inicio Instante de referência, obtido com `CLOCK_MONOTONIC`.
+ * @return Tempo decorrido em milissegundos.
+ */
+double milissegundos_desde(const struct timespec *inicio)
+{
+    struct timespec agora;
+    clock_gettime(CLOCK_MONOTONIC, &agora);
+    return (agora.tv_sec - inicio->tv_sec) * 1000.0 + (agora.tv_nsec - inicio->tv_nsec) / 1000000.0;
+}
+
+/**
+ * @brief Busca com orçamento de tempo e/ou de nós, que devolve a melhor solução até o limite.
+ *
+ * A melhor solução começa semeada pela solução gulosa e o limitante
+ * inferior global é calculado por `limite_inferior_poda` com a cobertura
+ * vazia. Em seguida, a busca clássica iterativa é executada em fatias de
+ * no máximo `FATIA_NOS_LIMITADA` nós, verificando os orçamentos de
+ * `configuracao.limite_tempo_ms` e `configuracao.limite_nos` entre as
+ * fatias (valores menores ou iguais a zero não limitam).
+ *
+ * Se `configuracao.intervalo_progresso_ms` for positivo, um registro de
+ * progresso (tempo, nós visitados e tamanho da melhor solução) é
+ * impresso sempre que esse intervalo se esgota.
+ *
+ * Ao final, `limite_inferior` e `gap` descrevem a distância máxima entre
+ * a solução devolvida e a ótima: se a busca terminar, a solução é ótima
+ * e o gap é zero.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema,
+ *        com os pontos ordenados e as estruturas de busca já alocadas.
+ * @param inicio Instante em que a resolução começou, base do orçamento de tempo.
+ * @return 1 se a preparação foi concluída, ou 0 em caso de falha de alocação.
+ */
+int backtracking_limitado(ProblemaBacktracking *problema, const struct timespec *inicio)
+{
+    const ConfiguracaoBacktracking *configuracao = &problema->configuracao;
+    double proximo_progresso = configuracao->intervalo_progresso_ms;
+    int concluida = 0;
+
+    if (preparar_busca_com_poda(problema) == 0)
+    {
+        return 0;
+    }
+
+    problema->limite_inferior = limite_inferior_poda(problema, 0);
+
+    /**
+     * Sem nenhum intervalo para algum ponto, não há solução; se a gulosa
+     * já atinge o limitante inferior, ela é ótima. Nos dois casos não há
+     * o que buscar.
+     */
+    if (problema->limite_inferior == INT_MAX || problema->n_melhor_solucao <= problema->limite_inferior)
+    {
+        concluida = 1;
+    }
+    else
+    {
+        iniciar_backtracking_iterativo(problema);
+    }
+
+    while (concluida == 0)
+    {
+        int64_t fatia = FATIA_NOS_LIMITADA;
+        if (configuracao->limite_nos > 0 && configuracao->limite_nos - problema->nos_visitados < fatia)
+        {
+            fatia = configuracao->limite_nos - problema->nos_visitados;
+        }
+        if (fatia <= 0)
+        {
+            break;
+        }
+
+        concluida = backtracking_iterativo(problema, fatia);
+
+        double decorrido = milissegundos_desde(inicio);
+        if (configuracao->intervalo_progresso_ms > 0.0 && decorrido >= proximo_progresso)
+        {
+            printf("Progresso: %.3f ms, %" PRId64 " nos visitados, melhor solucao com %d intervalos\n",
+                   decorrido, problema->nos_visitados, problema->n_melhor_solucao);
+            while (proximo_progresso <= decorrido)
+            {
+                proximo_progresso += configuracao->intervalo_progresso_ms;
+            }
+        }
+        if (configuracao->limite_tempo_ms > 0.0 && decorrido >= configuracao->limite_tempo_ms)
+        {
+            break;
+        }
+    }
+
+    problema->busca_concluida = concluida;
+    if (concluida && problema->limite_inferior != INT_MAX)
+    {
+        problema->limite_inferior = problema->n_melhor_solucao;
+    }
+    if (problema->n_melhor_solucao != INT_MAX && problema->n_melhor_solucao > 0)
+    {
+        problema->gap = (double)(problema->n_melhor_solucao - problema->limite_inferior) / problema->n_melhor_solucao;
+    }
+    else
+    {
+        problema->gap = 0.0;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Indica se uma entrada do heap da programação dinâmica precede outra.
+ *
+ * A ordem é por menor custo e, no empate, por menor índice de
+ * intervalo, para que a solução não dependa da ordem do heap.
+ *
+ * @param a Primeira entrada.
+ * @param b Segunda entrada.
+ * @return 1 se `a` precede `b`, 0 caso contrário.
+ */
+int entrada_dinamica_precede(const EntradaDinamica *a, const EntradaDinamica *b)
+{
+    return a->valor < b->valor || (a->valor == b->valor && a->intervalo < b->intervalo);
+}
+
+/**
+ * @brief Insere uma entrada no heap de mínimo da programação dinâmica.
+ *
+ * @param heap Vetor do heap, com espaço para mais uma entrada.
+ * @param n_entradas Quantidade de entradas no heap, atualizada.
+ * @param entrada Entrada inserida.
+ */
+void inserir_entrada_dinamica(EntradaDinamica *heap, int *n_entradas, EntradaDinamica entrada)
+{
+    int indice = (*n_entradas)++;
+
+    while (indice > 0 && entrada_dinamica_precede(&entrada, &heap[(indice - 1) / 2]))
+    {
+        heap[indice] = heap[(indice - 1) / 2];
+        indice = (indice - 1) / 2;
+    }
+    heap[indice] = entrada;
+}
+
+/**
+ * @brief Remove a entrada do topo do heap de mínimo da programação dinâmica.
+ *
+ * @param heap Vetor do heap, não vazio.
+ * @param n_entradas Quantidade de entradas no heap, atualizada.
+ */
+void remover_topo_dinamica(EntradaDinamica *heap, int *n_entradas)
+{
+    EntradaDinamica ultima = heap[--(*n_entradas)];
+    int indice = 0;
+    int filho = 1;
+
+    while (filho < *n_entradas)
+    {
+        if (filho + 1 < *n_entradas && entrada_dinamica_precede(&heap[filho + 1], &heap[filho]))
+        {
+            filho++;
+        }
+        if (entrada_dinamica_precede(&ultima, &heap[filho]) == 0)
+        {
+            heap[indice] = heap[filho];
+            indice = filho;
+            filho = 2 * indice + 1;
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (*n_entradas > 0)
+    {
+        heap[indice] = ultima;
+    }
+}
+
+/**
+ * @brief Resolve o problema de forma exata por programação dinâmica.
+ *
+ * Com os pontos ordenados por posição, o problema tem subestrutura
+ * ótima: o estado é o ponto descoberto mais à esquerda `j`, e o custo
+ * ótimo de cobrir os pontos `j, ..., n - 1` é
+ *
+ *     custo[j] = 1 + min { custo[faixa_fim[i]] : faixa_inicio[i] <= j < faixa_fim[i] }
+ *
+ * com `custo[n] = 0`. Os estados são calculados da direita para a
+ * esquerda: um intervalo entra em um heap de mínimo por
+ * `custo[faixa_fim[i]]` quando `j` chega ao último ponto da sua faixa e
+ * é descartado, ao chegar ao topo, quando `j` passa do primeiro. Cada
+ * intervalo entra e sai do heap uma vez, e o custo total é
+ * O((n + m) log m), sem relação com o tamanho da árvore de busca.
+ *
+ * A solução é reconstruída seguindo, a partir do ponto 0, o intervalo
+ * escolhido em cada estado. Se algum ponto não é coberto por nenhum
+ * intervalo, `n_melhor_solucao` permanece `INT_MAX`. `nos_visitados`
+ * conta os estados calculados.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema,
+ *        com os pontos ordenados e as faixas dos intervalos já calculadas.
+ * @return 1 se a resolução foi concluída, ou 0 em caso de falha de alocação.
+ */
+int programacao_dinamica_backtracking(ProblemaBacktracking *problema)
+{
+    int resultado = 0;
+    int n_pontos = problema->n_pontos;
+    int n_intervalos = problema->n_intervalos;
+    int *custo = (int *)arena_alocar(&problema->arena, ((size_t)n_pontos + 1) * sizeof(int));
+    int *escolha = (int *)arena_alocar(&problema->arena, n_pontos * sizeof(int));
+    int *inicio_grupo = (int *)arena_alocar(&problema->arena, ((size_t)n_pontos + 2) * sizeof(int));
+    int *por_fim = (int *)arena_alocar(&problema->arena, n_intervalos * sizeof(int));
+    EntradaDinamica *heap = (EntradaDinamica *)arena_alocar(&problema->arena, n_intervalos * sizeof(EntradaDinamica));
+
+    if (custo != NULL && escolha != NULL && inicio_grupo != NULL && por_fim != NULL && heap != NULL)
+    {
+        int n_entradas = 0;
+
+        /* Agrupa os intervalos por `faixa_fim`, por contagem (valores em [0, n_pontos]). */
+        memset(inicio_grupo, 0, ((size_t)n_pontos + 2) * sizeof(int));
+        for (int i = 0; i < n_intervalos; i++)
+        {
+            inicio_grupo[problema->faixa_fim[i] + 1]++;
+        }
+        for (int k = 1; k <= n_pontos + 1; k++)
+        {
+            inicio_grupo[k] += inicio_grupo[k - 1];
+        }
+        for (int i = 0; i < n_intervalos; i++)
+        {
+            por_fim[inicio_grupo[problema->faixa_fim[i]]++] = i;
+        }
+        /* Após a distribuição, o grupo de `faixa_fim == k` ocupa [inicio_grupo[k - 1], inicio_grupo[k]). */
+
+        custo[n_pontos] = 0;
+        for (int j = n_pontos - 1; j >= 0; j--)
+        {
+            for (int k = inicio_grupo[j]; k < inicio_grupo[j + 1]; k++)
+            {
+                int intervalo = por_fim[k];
+
+                if (problema->faixa_inicio[intervalo] <= j)
+                {
+                    EntradaDinamica entrada = {custo[j + 1], intervalo};
+                    inserir_entrada_dinamica(heap, &n_entradas, entrada);
+                }
+            }
+            while (n_entradas > 0 && problema->faixa_inicio[heap[0].intervalo] > j)
+            {
+                remover_topo_dinamica(heap, &n_entradas);
+            }
+
+            if (n_entradas > 0 && heap[0].valor != INT_MAX)
+            {
+                custo[j] = heap[0].valor + 1;
+                escolha[j] = heap[0].intervalo;
+            }
+            else
+            {
+                custo[j] = INT_MAX;
+                escolha[j] = -1;
+            }
+            problema->nos_visitados++;
+        }
+
+        if (custo[0] != INT_MAX)
+        {
+            int n_solucao = 0;
+
+            for (int j = 0; j < n_pontos; j = problema->faixa_fim[escolha[j]])
+            {
+                problema->melhor_solucao[n_solucao++] = problema->intervalos[escolha[j]];
+            }
+            problema->n_melhor_solucao = n_solucao;
+        }
+        resultado = 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Aloca as estruturas auxiliares usadas durante a busca.
+ *
+ * Tudo é alocado na arena do problema, a partir de `marcador_instancia`,
+ * de modo que resolver a mesma instância outra vez reaproveita a memória.
+ * Além dos vetores da solução parcial e da melhor solução, dos vetores
+ * contíguos de coordenadas (`separar_coordenadas_backtracking`) e das
+ * faixas dos intervalos, a cobertura é alocada conforme a representação escolhida em `configuracao.usar_bitset`:
+ * - vetor de contadores: um `int` por ponto em `pontos_cobertos`;
+ * - bitset: as máscaras pré-calculadas de cada intervalo e uma pilha
+ *   com um bitset de cobertura por nível da solução parcial.
+ *
+ * Os motores iterativo e limitado recebem ainda a pilha de quadros
+ * `pilha_busca`.
+ *
+ * Em caso de falha (arena sem espaço), os vetores já alocados
+ * permanecem na arena e são liberados por `liberar_problema_backtracking`.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ * @return 1 se todas as estruturas foram alocadas, ou 0 caso contrário.
+ */
+int alocar_estruturas_busca(ProblemaBacktracking *problema)
+{
+    int resultado = 0;
+    int usa_pilha = problema->configuracao.motor == MOTOR_BACKTRACKING_ITERATIVO ||
+                    problema->configuracao.motor == MOTOR_BACKTRACKING_LIMITADO;
+
+    /**
+     * Devolve à arena as estruturas de uma resolução anterior, mantendo
+     * apenas os pontos e intervalos da instância.
+     */
+    arena_restaurar(&problema->arena, problema->marcador_instancia);
+    problema->pontos_cobertos = NULL;
+    problema->mascaras = NULL;
+    problema->cobertura_bits = NULL;
+    problema->intervalos_por_inicio = NULL;
+    problema->alcance_ponto = NULL;
+    problema->posicoes = NULL;
+    problema->inicios = NULL;
+    problema->fins = NULL;
+    problema->faixa_inicio = NULL;
+    problema->faixa_fim = NULL;
+    problema->pilha_busca = NULL;
+
+    problema->solucao_atual = (Intervalo *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(Intervalo));
+    problema->indices_solucao_atual = (int *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(int));
+    problema->melhor_solucao = (Intervalo *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(Intervalo));
+    if (usa_pilha)
+    {
+        problema->pilha_busca = (QuadroBusca *)arena_alocar(&problema->arena, (problema->n_intervalos + 1) * sizeof(QuadroBusca));
+    }
+    if (problema->solucao_atual != NULL && problema->indices_solucao_atual != NULL && problema->melhor_solucao != NULL &&
+        (usa_pilha == 0 || problema->pilha_busca != NULL) && separar_coordenadas_backtracking(problema) &&
+        calcular_faixas_backtracking(problema))
+    {
+        if (problema->configuracao.usar_bitset)
+        {
+            if (construir_mascaras_backtracking(problema))
+            {
+                problema->cobertura_bits = (uint64_t *)arena_alocar(&problema->arena, (size_t)(problema->n_intervalos + 1) * problema->n_palavras * sizeof(uint64_t));
+                if (problema->cobertura_bits != NULL)
+                {
+                    /**
+                     * Só o nível da solução vazia precisa começar zerado:
+                     * os demais são sempre escritos antes de serem lidos.
+                     */
+                    memset(problema->cobertura_bits, 0, problema->n_palavras * sizeof(uint64_t));
+                    resultado = 1;
+                }
+            }
+        }
+        else
+        {
+            problema->pontos_cobertos = (int *)arena_alocar(&problema->arena, problema->n_pontos * sizeof(int));
+            if (problema->pontos_cobertos != NULL)
+            {
+                memset(problema->pontos_cobertos, 0, problema->n_pontos * sizeof(int));
+                resultado = 1;
+            }
+        }
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Resolve o problema de cobertura de pontos utilizando backtracking.
+ *
+ * Esta função é responsável por:
+ * - inicializar estruturas auxiliares do algoritmo;
+ * - executar o algoritmo de backtracking recursivo;
+ * - medir tempo de execução e uso de memória;
+ * - calcular a qualidade da solução encontrada;
+ * - retornar todas essas informações na forma de métricas.
+ *
+ * Ela funciona como a função principal do algoritmo de backtracking,
+ * encapsulando a execução e a avaliação da solução.
+ *
+ * A memória da resolução sai da arena do problema, ajustada antes por
+ * `garantir_arena_backtracking` caso a configuração tenha mudado desde
+ * a alocação da instância; nenhuma alocação é feita durante a busca.
+ *
+ * Se `configuracao.aplicar_reducao` estiver ativo, pontos e intervalos
+ * redundantes são removidos por `reduzir_problema_backtracking` antes
+ * da busca, reduzindo o espaço de soluções explorado.
+ *
+ * O motor definido em `configuracao.motor` seleciona a busca: a
+ * enumeração clássica de incluir/excluir cada intervalo
+ * (`backtracking_recursivo`, ou `busca_pequena_backtracking` nas
+ * instâncias que cabem em uma máscara de até `MAX_PONTOS_PEQUENA` bits)
+ * ou a busca com poda por limitante
+ * inferior, semeada pela solução gulosa (`backtracking_com_poda`),
+ * a enumeração clássica distribuída entre threads
+ * (`backtracking_paralelo`) ou a enumeração clássica com pilha explícita
+ * (`backtracking_iterativo`), as duas últimas com a mesma solução da
+ * clássica. O motor limitado (`backtracking_limitado`) executa a busca
+ * iterativa dentro de um orçamento de tempo e/ou de nós e devolve a
+ * melhor solução encontrada, com limitante inferior e gap. O motor de
+ * programação dinâmica (`programacao_dinamica_backtracking`) também é
+ * exato, mas em O((n + m) log m), e serve às instâncias grandes demais
+ * para a busca exaustiva.
+ *
+ * Os motores com poda e limitado usam os pontos ordenados por posição;
+ * a ordenação é feita antes da alocação, para que as máscaras da
+ * representação em bitset sigam a mesma ordem.
+ *
+ * O tempo total é dividido entre o preparo (redução, ordenação e
+ * alocação) e a busca propriamente dita. O estado da busca é
+ * reiniciado a cada chamada, de modo que a mesma instância, restaurada,
+ * pode ser resolvida de novo por `medir_lote`.
+ *
+ * @param problema Ponteiro para a estrutura que representa o problema.
+ * @return Estrutura contendo as métricas de desempenho e qualidade
+ *         da solução encontrada.
+ */
+MetricasBacktracking resolver_backtracking(ProblemaBacktracking *problema)
+{
+    MetricasBacktracking metricas;
+    struct timespec inicio, inicio_busca, fim;
+    struct rusage uso_memoria;
+    ContadoresHardware contadores;
+    int arena_pronta = 0;
+
+    metricas.tempo = 0.0;
+    metricas.tempo_preparo = 0.0;
+    metricas.tempo_busca = 0.0;
+    metricas.memoria = 0;
+    metricas.qualidade = 0.0;
+    metricas.n_solucao = 0;
+    metricas.nos_visitados = 0;
+    metricas.limite_inferior = 0;
+    metricas.gap = 0.0;
+    metricas.busca_concluida = 0;
+    metricas.pico_memoria = 0;
+    metricas.n_alocacoes = 0;
+    metricas.profundidade_maxima = 0;
+    for (int k = 0; k < N_CONTADORES_HARDWARE; k++)
+    {
+        metricas.contadores[k] = -1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+
+    /**
+     * A contabilidade de memória recomeça a cada resolução, a partir da
+     * instância: as estruturas da resolução anterior voltam à arena.
+     */
+    arena_pronta = garantir_arena_backtracking(problema);
+    arena_restaurar(&problema->arena, problema->marcador_instancia);
+    problema->memoria.pico_bytes = problema->memoria.bytes_em_uso;
+    problema->memoria.n_alocacoes = 0;
+    problema->profundidade_maxima = 0;
+    problema->nos_por_thread = NULL;
+    problema->n_threads_utilizadas = 0;
+
+    if (arena_pronta && problema->configuracao.aplicar_reducao)
+    {
+        reduzir_problema_backtracking(problema);
+    }
+
+    /**
+     * Todos os motores usam os pontos ordenados por posição: é o que
+     * torna contígua a faixa de pontos coberta por cada intervalo.
+     */
+    qsort(problema->pontos, problema->n_pontos, sizeof(Ponto), comparar_pontos);
+
+    if (alocar_estruturas_busca(problema) == 0)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &fim);
+        problema->tempo_execucao = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
+        metricas.tempo = problema->tempo_execucao;
+        metricas.tempo_preparo = problema->tempo_execucao;
+        getrusage(RUSAGE_SELF, &uso_memoria);
+        problema->memoria_utilizada = uso_memoria.ru_maxrss;
+        metricas.memoria = problema->memoria_utilizada;
+        metricas.pico_memoria = problema->memoria.pico_bytes;
+        metricas.n_alocacoes = problema->memoria.n_alocacoes;
+        return metricas;
+    }
+
+    problema->n_pontos_cobertos = 0;
+    problema->n_solucao_atual = 0;
+    problema->n_melhor_solucao = INT_MAX;
+    problema->nos_visitados = 0;
+    problema->limite_inferior = 0;
+    problema->gap = 0.0;
+    problema->busca_concluida = 0;
+
+    if (problema->configuracao.medir_contadores)
+    {
+        contadores_abrir(&contadores);
+        contadores_iniciar(&contadores);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &inicio_busca);
+
+    if (problema->n_pontos == 0)
+    {
+        /* Sem pontos, a cobertura vazia é a solução ótima em qualquer motor. */
+        problema->n_melhor_solucao = 0;
+        problema->busca_concluida = 1;
+    }
+    else if (problema->configuracao.motor == MOTOR_BACKTRACKING_PODA)
+    {
+        if (preparar_busca_com_poda(problema))
+        {
+            backtracking_com_poda(problema, 0);
+        }
+    }
+    else if (problema->configuracao.motor == MOTOR_BACKTRACKING_PARALELO)
+    {
+        if (backtracking_paralelo(problema) == 0)
+        {
+            printf("Erro: falha ao preparar a busca paralela.\n");
+        }
+    }
+    else if (problema->configuracao.motor == MOTOR_BACKTRACKING_ITERATIVO)
+    {
+        iniciar_backtracking_iterativo(problema);
+        backtracking_iterativo(problema, 0);
+    }
+    else if (problema->configuracao.motor == MOTOR_BACKTRACKING_LIMITADO)
+    {
+        if (backtracking_limitado(problema, &inicio) == 0)
+        {
+            printf("Erro: falha ao preparar a busca limitada.\n");
+        }
+    }
+    else if (problema->configuracao.motor == MOTOR_BACKTRACKING_DINAMICA)
+    {
+        if (programacao_dinamica_backtracking(problema) == 0)
+        {
+            printf("Erro: falha ao preparar a programacao dinamica.\n");
+        }
+    }
+    else if (busca_pequena_backtracking(problema) == 0)
+    {
+        backtracking_recursivo(problema, 0);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+
+    if (problema->configuracao.medir_contadores)
+    {
+        contadores_parar(&contadores);
+        contadores_fechar(&contadores);
+        memcpy(metricas.contadores, contadores.valores, sizeof(metricas.contadores));
+    }
+
+    problema->tempo_execucao = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
+    metricas.tempo = problema->tempo_execucao;
+    metricas.tempo_preparo = (inicio_busca.tv_sec - inicio.tv_sec) * 1000.0 + (inicio_busca.tv_nsec - inicio.tv_nsec) / 1000000.0;
+    metricas.tempo_busca = (fim.tv_sec - inicio_busca.tv_sec) * 1000.0 + (fim.tv_nsec - inicio_busca.tv_nsec) / 1000000.0;
+
+    getrusage(RUSAGE_SELF, &uso_memoria);
+    problema->memoria_utilizada = uso_memoria.ru_maxrss;
+    metricas.memoria = problema->memoria_utilizada;
+
+    if (problema->n_intervalos > 0)
+    {
+        problema->qualidade = 1.0 - ((double)problema->n_melhor_solucao / problema->n_intervalos);
+        metricas.qualidade = problema->qualidade;
+    }
+    else
+    {
+        problema->qualidade = 0.0;
+        metricas.qualidade = 0.0;
+    }
+
+    metricas.n_solucao = problema->n_melhor_solucao;
+    metricas.nos_visitados = problema->nos_visitados;
+    metricas.limite_inferior = problema->limite_inferior;
+    metricas.gap = problema->gap;
+    metricas.busca_concluida = problema->busca_concluida;
+    metricas.pico_memoria = problema->memoria.pico_bytes;
+    metricas.n_alocacoes = problema->memoria.n_alocacoes;
+    metricas.profundidade_maxima = problema->profundidade_maxima;
+
+    return metricas;
+}
+
+/**
+ * @brief Converte o nome de um motor de busca em sua constante.
+ *
+ * @param nome Nome do motor, como exibido por `nome_motor_backtracking`.
+ * @return Constante MOTOR_BACKTRACKING_* correspondente, ou -1 se o nome for desconhecido.
+ */
+int motor_por_nome_backtracking(const char *nome)
+{
+    int motor;
+
+    for (motor = 0; motor < N_MOTORES_BACKTRACKING; motor++)
+    {
+        if (strcmp(nome, nome_motor_backtracking(motor)) == 0)
+        {
+            return motor;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Preenche um registro do repositório com o resultado de uma resolução.
+ *
+ * Completa o registro iniciado por `registro_iniciar` com o motor, as
+ * threads e as métricas. Sem repetições, a busca tem uma única amostra.
+ *
+ * @param registro Registro já iniciado com a instância.
+ * @param configuracao Opções usadas na resolução.
+ * @param metricas Métricas da (última) resolução.
+ */
+void preencher_registro_backtracking(RegistroExecucao *registro, const ConfiguracaoBacktracking *configuracao, const MetricasBacktracking *metricas)
+{
+    double tempo_busca = metricas->tempo_busca;
+
+    snprintf(registro->motor, sizeof(registro->motor), "%s", nome_motor_backtracking(configuracao->motor));
+    if (configuracao->motor == MOTOR_BACKTRACKING_PARALELO || configuracao->decompor)
+    {
+        registro->threads = configuracao->n_threads;
+    }
+    registro->n_solucao = metricas->n_solucao == INT_MAX ? -1 : metricas->n_solucao;
+    registro->tempo = metricas->tempo;
+    calcular_estatisticas_tempo(&tempo_busca, 1, &registro->busca);
+    registro->pico_memoria = metricas->pico_memoria;
+    registro->n_alocacoes = metricas->n_alocacoes;
+    registro->memoria_kb = metricas->memoria;
+    registro->nos_visitados = metricas->nos_visitados;
+}
+
+/**
+ * @brief Converte a configuração do backtracking nas opções de `resolver_cobertura`.
+ *
+ * @param configuracao Configuração do programa.
+ * @param opcoes Opções equivalentes, com o solucionador do motor escolhido.
+ */
+void converter_opcoes_backtracking(const ConfiguracaoBacktracking *configuracao, OpcoesCobertura *opcoes)
+{
+    opcoes_cobertura_padrao(opcoes);
+    /* Os SOLUCIONADOR_* do backtracking seguem a ordem dos MOTOR_BACKTRACKING_*. */
+    opcoes->solucionador = SOLUCIONADOR_BACKTRACKING + configuracao->motor;
+    opcoes->usar_bitset = configuracao->usar_bitset;
+    opcoes->aplicar_reducao = configuracao->aplicar_reducao;
+    opcoes->n_threads = configuracao->n_threads;
+    opcoes->profundidade_divisao = configuracao->profundidade_divisao;
+    opcoes->limite_tempo_ms = configuracao->limite_tempo_ms;
+    opcoes->limite_nos = configuracao->limite_nos;
+}
+
+/**
+ * @brief Resolve uma instância do modo em lote, por componentes ou pelo cache se configurado.
+ *
+ * Com `configuracao.decompor` ou com um cache, a instância é entregue a
+ * `resolver_cobertura_com_cache` com o mesmo motor e as mesmas opções
+ * (por componentes, com `decompor`), e o resultado é convertido para as
+ * métricas do backtracking: sem cobertura, o tamanho da solução fica em
+ * INT_MAX, e o limitante inferior, o gap e a conclusão só valem para o
+ * motor limitado. Os contadores de hardware não são lidos nesse caso.
+ * Sem as duas opções, é o próprio `resolver_backtracking`.
+ *
+ * @param problema Instância carregada, com a configuração definida.
+ * @param cache Cache de soluções, ou NULL.
+ * @return Métricas da resolução.
+ */
+MetricasBacktracking resolver_lote_backtracking(ProblemaBacktracking *problema, CacheCobertura *cache)
+{
+    InstanciaCobertura instancia;
+    OpcoesCobertura opcoes;
+    ResultadoCobertura resultado;
+    MetricasBacktracking metricas;
+
+    if (problema->configuracao.decompor == 0 && cache == NULL)
+    {
+        return resolver_backtracking(problema);
+    }
+
+    memset(&metricas, 0, sizeof(metricas));
+    for (int c = 0; c < N_CONTADORES_HARDWARE; c++)
+    {
+        metricas.contadores[c] = -1;
+    }
+    metricas.n_solucao = INT_MAX;
+    metricas.limite_inferior = INT_MAX;
+
+    instancia.pontos = problema->pontos;
+    instancia.n_pontos = problema->n_pontos;
+    instancia.intervalos = problema->intervalos;
+    instancia.n_intervalos = problema->n_intervalos;
+    converter_opcoes_backtracking(&problema->configuracao, &opcoes);
+    opcoes.decompor = problema->configuracao.decompor;
+
+    if (resolver_cobertura_com_cache(cache, &instancia, &opcoes, &resultado))
+    {
+        metricas.tempo = resultado.tempo_ms;
+        metricas.tempo_preparo = resultado.tempo_preparo_ms;
+        metricas.tempo_busca = resultado.tempo_busca_ms;
+        metricas.n_solucao = resultado.cobertura_completa ? resultado.n_solucao : INT_MAX;
+        metricas.nos_visitados = resultado.nos_visitados;
+        metricas.limite_inferior = resultado.limite_inferior;
+        metricas.gap = resultado.gap;
+        metricas.busca_concluida = problema->configuracao.motor == MOTOR_BACKTRACKING_LIMITADO && resultado.otima;
+        metricas.pico_memoria = resultado.pico_memoria;
+        metricas.n_alocacoes = resultado.n_alocacoes;
+        metricas.profundidade_maxima = resultado.profundidade_maxima;
+        liberar_resultado_cobertura(&resultado);
+    }
+
+    return metricas;
+}
+
+/**
+ * @brief Compara o guloso e o motor exato em uma instância do modo em lote.
+ *
+ * Os dois solucionadores resolvem a mesma instância, preparada (e
+ * reduzida, com `--reducao`) uma única vez por `comparar_solucionadores`,
+ * e a linha segue o cabeçalho de comparação de `escrever_cabecalho_lote`.
+ * Com `medicao->repeticoes` positivo, cada solucionador é executado
+ * esse número de vezes e os tempos são as medianas.
+ *
+ * @param problema Instância carregada, com a configuração definida.
+ * @param medicao Opções de medição do lote, com o guloso a comparar.
+ * @param origem Nome da origem, registrado na primeira coluna.
+ * @param indice Posição da instância na origem, a partir de 1.
+ * @param saida Fluxo que recebe a linha de resultado.
+ */
+void registrar_comparacao_lote_backtracking(ProblemaBacktracking *problema, const ConfiguracaoMedicao *medicao, const char *origem, int indice,
+                                            FILE *saida)
+{
+    InstanciaCobertura instancia;
+    OpcoesCobertura exato, guloso;
+    ComparacaoCobertura comparacao;
+    int limite_inferior;
+
+    instancia.pontos = problema->pontos;
+    instancia.n_pontos = problema->n_pontos;
+    instancia.intervalos = problema->intervalos;
+    instancia.n_intervalos = problema->n_intervalos;
+    converter_opcoes_backtracking(&problema->configuracao, &exato);
+    exato.decompor = problema->configuracao.decompor;
+    guloso = exato;
+    guloso.solucionador = medicao->guloso_comparado;
+    guloso.decompor = 0;
+
+    if (comparar_solucionadores(&instancia, &guloso, &exato, medicao->repeticoes, &comparacao) == 0)
+    {
+        fprintf(stderr, "Erro: memoria insuficiente para comparar a instancia %d de %s.\n", indice, origem);
+        return;
+    }
+
+    /* Fora do motor limitado, o limitante só é conhecido quando a solução é ótima. */
+    limite_inferior = comparacao.exato.otima ? comparacao.exato.n_solucao : comparacao.exato.limite_inferior;
+    if (comparacao.exato.cobertura_completa == 0)
+    {
+        limite_inferior = -1;
+    }
+
+    fprintf(saida, "%s,%d,%d,%d,%s,%s,%.4f,%.4f,%.4f,%.2f,%d,%d,%d,%d,%.4f,%zu,%zu\n",
+            origem, indice, instancia.n_pontos, instancia.n_intervalos,
+            nome_solucionador(guloso.solucionador), nome_motor_backtracking(problema->configuracao.motor),
+            comparacao.tempo_preparo_ms, comparacao.tempo_guloso_ms, comparacao.tempo_exato_ms, comparacao.speedup,
+            comparacao.guloso.cobertura_completa ? comparacao.guloso.n_solucao : -1,
+            comparacao.exato.cobertura_completa ? comparacao.exato.n_solucao : -1,
+            comparacao.exato.otima, limite_inferior,
+            comparacao.razao_aproximacao, comparacao.guloso.pico_memoria, comparacao.exato.pico_memoria);
+
+    liberar_comparacao(&comparacao);
+}
+
+/**
+ * @brief Escreve as colunas do backtracking na linha de resultado do modo em lote.
+ *
+ * São as colunas do cabeçalho de `escrever_cabecalho_lote` antes dos
+ * contadores e das estatísticas de tempo, que `registrar_instancia_lote`
+ * acrescenta. Instâncias sem cobertura possível são registradas com -1
+ * no tamanho da solução e no limitante inferior.
+ *
+ * @param problema Problema resolvido.
+ * @param metricas Métricas da (última) resolução.
+ * @param origem Nome da origem, registrado na primeira coluna.
+ * @param indice Posição da instância na origem, a partir de 1.
+ * @param n_pontos Pontos da instância antes da redução.
+ * @param n_intervalos Intervalos da instância antes da redução.
+ * @param saida Fluxo que recebe a linha.
+ */
+void escrever_resultado_lote_backtracking(const ProblemaBacktracking *problema, const MetricasBacktracking *metricas, const char *origem, int indice,
+                                          int n_pontos, int n_intervalos, FILE *saida)
+{
+    fprintf(saida, "%s,%d,%d,%d,%s,%.4f,%d,%" PRId64 ",%d,%.4f,%d,%zu,%" PRId64 ",%d",
+            origem, indice, n_pontos, n_intervalos,
+            nome_motor_backtracking(problema->configuracao.motor), metricas->tempo,
+            metricas->n_solucao == INT_MAX ? -1 : metricas->n_solucao, metricas->nos_visitados,
+            metricas->limite_inferior == INT_MAX ? -1 : metricas->limite_inferior,
+            metricas->gap, metricas->busca_concluida,
+            metricas->pico_memoria, metricas->n_alocacoes, metricas->profundidade_maxima);
+}
+
+/** Sinalizado por SIGINT ou SIGTERM para o servidor de socket parar de aceitar conexões. */
+static volatile sig_atomic_t servidor_interrompido = 0;
+
+/**
+ * @brief Tratador de SIGINT e SIGTERM do modo servidor.
+ *
+ * @param sinal Sinal recebido.
+ */
+void interromper_servidor(int sinal)
+{
+    (void)sinal;
+    servidor_interrompido = 1;
+}
+
+/**
+ * @brief Acrescenta texto formatado, como `printf`, ao fim de uma resposta.
+ *
+ * @param texto Texto acumulado.
+ * @param formato Formato no estilo de `printf`.
+ * @return 1 se o texto foi acrescentado, ou 0 se faltar memória.
+ */
+int anexar_resposta(TextoResposta *texto, const char *formato, ...)
+{
+    va_list argumentos;
+    int escritos = -1;
+    int anexado = 0;
+    int espaco = 1;
+
+    while (anexado == 0 && espaco)
+    {
+        size_t livre = texto->capacidade - texto->tamanho;
+
+        va_start(argumentos, formato);
+        escritos = vsnprintf(texto->dados != NULL ? texto->dados + texto->tamanho : NULL, livre, formato, argumentos);
+        va_end(argumentos);
+
+        if (escritos < 0)
+        {
+            espaco = 0;
+        }
+        else if ((size_t)escritos < livre)
+        {
+            texto->tamanho += (size_t)escritos;
+            anexado = 1;
+        }
+        else
+        {
+            size_t capacidade = texto->capacidade > 0 ? texto->capacidade : 4096;
+            char *dados;
+
+            while (capacidade - texto->tamanho <= (size_t)escritos)
+            {
+                capacidade *= 2;
+            }
+            dados = (char *)realloc(texto->dados, capacidade);
+            espaco = dados != NULL;
+            if (espaco)
+            {
+                texto->dados = dados;
+                texto->capacidade = capacidade;
+            }
+        }
+    }
+
+    return anexado;
+}
+
+/**
+ * @brief Escreve um bloco inteiro em um descritor, repetindo escritas parciais.
+ *
+ * @param descritor Descritor de destino.
+ * @param dados Bytes a escrever.
+ * @param tamanho Quantidade de bytes.
+ * @return 1 se tudo foi escrito, ou 0 se o descritor falhou (por exemplo, cliente desconectado).
+ */
+int escrever_tudo(int descritor, const char *dados, size_t tamanho)
+{
+    while (tamanho > 0)
+    {
+        ssize_t escritos = write(descritor, dados, tamanho);
+        if (escritos < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (escritos <= 0)
+        {
+            return 0;
+        }
+        dados += escritos;
+        tamanho -= (size_t)escritos;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Escreve as respostas acumuladas em uma conexão e esvazia o texto.
+ *
+ * @param conexao Conexão de destino.
+ * @param texto Respostas acumuladas.
+ */
+void enviar_respostas(ConexaoServidor *conexao, TextoResposta *texto)
+{
+    if (texto->tamanho > 0)
+    {
+        pthread_mutex_lock(&conexao->escrita);
+        escrever_tudo(conexao->descritor, texto->dados, texto->tamanho);
+        pthread_mutex_unlock(&conexao->escrita);
+        texto->tamanho = 0;
+    }
+}
+
+/**
+ * @brief Cria uma conexão que escreve as respostas em um descritor.
+ *
+ * A conexão começa com a referência do seu leitor.
+ *
+ * @param descritor Descritor das respostas.
+ * @param fechar 1 para fechar o descritor ao liberar a conexão.
+ * @return A conexão, ou NULL se faltar memória.
+ */
+ConexaoServidor *criar_conexao_servidor(int descritor, int fechar)
+{
+    ConexaoServidor *conexao = (ConexaoServidor *)malloc(sizeof(ConexaoServidor));
+
+    if (conexao != NULL)
+    {
+        conexao->descritor = descritor;
+        conexao->fechar = fechar;
+        pthread_mutex_init(&conexao->escrita, NULL);
+        atomic_init(&conexao->referencias, 1);
+    }
+
+    return conexao;
+}
+
+/**
+ * @brief Devolve uma referência da conexão, liberando-a na última.
+ *
+ * @param conexao Conexão referenciada.
+ */
+void liberar_referencia_conexao(ConexaoServidor *conexao)
+{
+    if (atomic_fetch_sub(&conexao->referencias, 1) == 1)
+    {
+        if (conexao->fechar)
+        {
+            close(conexao->descritor);
+        }
+        pthread_mutex_destroy(&conexao->escrita);
+        free(conexao);
+    }
+}
+
+/**
+ * @brief Coloca uma requisição lida na fila correspondente ao seu tamanho.
+ *
+ * Espera enquanto houver `MAX_REQUISICOES_SERVIDOR` requisições nas
+ * filas. Depois que o servidor começa a encerrar, os trabalhadores
+ * podem já ter saído, então a requisição é recusada.
+ *
+ * @param servidor Servidor que recebe a requisição.
+ * @param requisicao Requisição lida.
+ * @return 1 se a requisição foi enfileirada, ou 0 se o servidor está encerrando.
+ */
+int enfileirar_requisicao(Servidor *servidor, RequisicaoServidor *requisicao)
+{
+    int pequena = requisicao->problema.n_pontos <= MAX_PONTOS_PEQUENA && requisicao->problema.n_intervalos <= MAX_INTERVALOS_PEQUENA;
+    FilaServidor *fila = pequena ? &servidor->pequenas : &servidor->grandes;
+    int enfileirada = 0;
+
+    requisicao->proxima = NULL;
+
+    pthread_mutex_lock(&servidor->trava);
+    while (servidor->pendentes >= MAX_REQUISICOES_SERVIDOR && servidor->encerrando == 0)
+    {
+        pthread_cond_wait(&servidor->sinal_espaco, &servidor->trava);
+    }
+
+    if (servidor->encerrando == 0)
+    {
+        if (fila->ultima != NULL)
+        {
+            fila->ultima->proxima = requisicao;
+        }
+        else
+        {
+            fila->primeira = requisicao;
+        }
+        fila->ultima = requisicao;
+        servidor->pendentes++;
+        enfileirada = 1;
+
+        pthread_cond_signal(pequena ? &servidor->sinal_pequenas : &servidor->sinal_grandes);
+    }
+    pthread_mutex_unlock(&servidor->trava);
+
+    return enfileirada;
+}
+
+/**
+ * @brief Retira da fila um lote de requisições, esperando se ela estiver vazia.
+ *
+ * @param servidor Servidor cujas filas são atendidas.
+ * @param pequenas 1 para a fila das pequenas, 0 para a das grandes.
+ * @param lote Destino das requisições retiradas, na ordem de chegada.
+ * @param maximo Máximo de requisições retiradas.
+ * @return Quantidade de requisições retiradas, ou 0 se o servidor está
+ *         encerrando e a fila esvaziou.
+ */
+int retirar_lote_servidor(Servidor *servidor, int pequenas, RequisicaoServidor **lote, int maximo)
+{
+    FilaServidor *fila = pequenas ? &servidor->pequenas : &servidor->grandes;
+    pthread_cond_t *sinal = pequenas ? &servidor->sinal_pequenas : &servidor->sinal_grandes;
+    int n_lote = 0;
+
+    pthread_mutex_lock(&servidor->trava);
+    while (fila->primeira == NULL && servidor->encerrando == 0)
+    {
+        pthread_cond_wait(sinal, &servidor->trava);
+    }
+
+    while (fila->primeira != NULL && n_lote < maximo)
+    {
+        lote[n_lote++] = fila->primeira;
+        fila->primeira = fila->primeira->proxima;
+    }
+    if (fila->primeira == NULL)
+    {
+        fila->ultima = NULL;
+    }
+    servidor->pendentes -= n_lote;
+
+    if (n_lote > 0)
+    {
+        pthread_cond_broadcast(&servidor->sinal_espaco);
+    }
+    pthread_mutex_unlock(&servidor->trava);
+
+    return n_lote;
+}
+
+/**
+ * @brief Resolve uma requisição e acrescenta sua resposta ao texto do lote.
+ *
+ * A resposta é uma linha `id estado motor n_solucao otima espera_ms
+ * tempo_ms`, seguida dos pares `inicio fim` dos intervalos escolhidos,
+ * nas coordenadas originais. O estado é `ok`, `sem_cobertura` ou
+ * `expirado`. O prazo conta desde a chegada: se já terminou na fila, a
+ * requisição não é resolvida; se não, o tempo restante vira o
+ * orçamento do motor limitado, que devolve a melhor solução encontrada
+ * (com `otima` 0 se a busca não terminou). Só a programação dinâmica,
+ * polinomial, resolve uma requisição sem passar pelo motor limitado:
+ * os demais motores são exponenciais, e sem prazo recebem o orçamento
+ * `ORCAMENTO_PADRAO_SERVIDOR_MS`, para que nenhuma requisição prenda
+ * um trabalhador indefinidamente.
+ *
+ * @param servidor Servidor que recebeu a requisição.
+ * @param requisicao Requisição a resolver; sua instância é liberada.
+ * @param motor Motor da fila (o das pequenas ou o das grandes).
+ * @param texto Respostas do lote.
+ */
+void resolver_requisicao_servidor(Servidor *servidor, RequisicaoServidor *requisicao, int motor, TextoResposta *texto)
+{
+    ProblemaBacktracking *problema = &requisicao->problema;
+    MetricasBacktracking metricas;
+    struct timespec agora;
+    double espera;
+    int otima;
+    const char *estado;
+
+    clock_gettime(CLOCK_MONOTONIC, &agora);
+    espera = (agora.tv_sec - requisicao->chegada.tv_sec) * 1000.0 + (agora.tv_nsec - requisicao->chegada.tv_nsec) / 1000000.0;
+
+    if (motor != MOTOR_BACKTRACKING_DINAMICA)
+    {
+        motor = MOTOR_BACKTRACKING_LIMITADO;
+        problema->configuracao.limite_tempo_ms = requisicao->prazo_ms > 0.0 ? requisicao->prazo_ms - espera : ORCAMENTO_PADRAO_SERVIDOR_MS;
+    }
+
+    if (requisicao->prazo_ms > 0.0 && espera >= requisicao->prazo_ms)
+    {
+        atomic_fetch_add(&servidor->n_expiradas, 1);
+        anexar_resposta(texto, "%lld expirado %s 0 0 %.4f 0.0000\n", requisicao->id, nome_motor_backtracking(motor), espera);
+        liberar_problema_backtracking(problema);
+        return;
+    }
+
+    problema->configuracao.motor = motor;
+    metricas = resolver_backtracking(problema);
+
+    otima = problema->n_melhor_solucao != INT_MAX && (motor != MOTOR_BACKTRACKING_LIMITADO || metricas.busca_concluida);
+    if (problema->n_melhor_solucao != INT_MAX)
+    {
+        estado = "ok";
+    }
+    else if (motor == MOTOR_BACKTRACKING_LIMITADO && metricas.busca_concluida == 0)
+    {
+        estado = "expirado";
+        atomic_fetch_add(&servidor->n_expiradas, 1);
+    }
+    else
+    {
+        estado = "sem_cobertura";
+    }
+
+    anexar_resposta(texto, "%lld %s %s %d %d %.4f %.4f", requisicao->id, estado, nome_motor_backtracking(motor),
+                    problema->n_melhor_solucao != INT_MAX ? problema->n_melhor_solucao : 0, otima, espera, metricas.tempo);
+    for (int i = 0; problema->n_melhor_solucao != INT_MAX && i < problema->n_melhor_solucao; i++)
+    {
+        anexar_resposta(texto, " %lld %lld", coordenada_original(&problema->coordenadas, problema->melhor_solucao[i].inicio),
+                        coordenada_original(&problema->coordenadas, problema->melhor_solucao[i].fim));
+    }
+    anexar_resposta(texto, "\n");
+
+    liberar_problema_backtracking(problema);
+}
+
+/**
+ * @brief Laço de uma thread que resolve as requisições de uma fila.
+ *
+ * As requisições pequenas são retiradas em lotes de até
+ * `tamanho_lote` e resolvidas em sequência, sem voltar à fila entre
+ * elas; as respostas consecutivas da mesma conexão saem em uma única
+ * escrita. As grandes são retiradas uma a uma e resolvidas por
+ * `motor_grandes`.
+ *
+ * @param argumento Ponteiro para o `TrabalhadorServidor`.
+ * @return NULL.
+ */
+void *trabalhar_servidor(void *argumento)
+{
+    TrabalhadorServidor *trabalhador = (TrabalhadorServidor *)argumento;
+    Servidor *servidor = trabalhador->servidor;
+    int maximo = trabalhador->pequenas ? servidor->tamanho_lote : 1;
+    int motor = trabalhador->pequenas ? servidor->motor_pequenas : servidor->motor_grandes;
+    RequisicaoServidor **lote = (RequisicaoServidor **)malloc((size_t)maximo * sizeof(RequisicaoServidor *));
+    TextoResposta texto = {NULL, 0, 0};
+    int n_lote;
+
+    if (lote == NULL)
+    {
+        fprintf(stderr, "Erro: memoria insuficiente para o trabalhador do servidor.\n");
+        return NULL;
+    }
+
+    while ((n_lote = retirar_lote_servidor(servidor, trabalhador->pequenas, lote, maximo)) > 0)
+    {
+        int inicio_conexao = 0;
+
+        for (int i = 0; i < n_lote; i++)
+        {
+            resolver_requisicao_servidor(servidor, lote[i], motor, &texto);
+
+            if (i + 1 == n_lote || lote[i + 1]->conexao != lote[i]->conexao)
+            {
+                enviar_respostas(lote[i]->conexao, &texto);
+                for (int j = inicio_conexao; j <= i; j++)
+                {
+                    liberar_referencia_conexao(lote[j]->conexao);
+                    free(lote[j]);
+                }
+                inicio_conexao = i + 1;
+            }
+        }
+
+        atomic_fetch_add(trabalhador->pequenas ? &servidor->n_pequenas : &servidor->n_grandes, n_lote);
+        if (trabalhador->pequenas)
+        {
+            atomic_fetch_add(&servidor->n_lotes, 1);
+        }
+    }
+
+    free(texto.dados);
+    free(lote);
+
+    return NULL;
+}
+
+/**
+ * @brief Lê as requisições de uma conexão até o fim e as enfileira.
+ *
+ * Cada requisição é `id prazo_ms` seguida de uma instância em qualquer
+ * um dos formatos de `ler_cabecalho_instancia` (no texto, terminada por
+ * uma quebra de linha). Um `prazo_ms` 0 usa o prazo padrão do servidor.
+ * Uma requisição inválida é respondida com `id erro` e encerra a
+ * leitura da conexão, já que não há como reencontrar o início da
+ * próxima. O mesmo vale para uma requisição recusada porque o servidor
+ * está encerrando e para uma cujo cabeçalho anuncia mais que
+ * `servidor->max_elementos` pontos ou intervalos, recusada antes de a
+ * instância ser alocada ou lida: sem esse limite, um cliente faria o
+ * servidor reservar a memória de `MAX_ELEMENTOS_INSTANCIA` elementos
+ * com uma linha.
+ *
+ * @param servidor Servidor que recebe as requisições.
+ * @param leitor Leitor da conexão.
+ * @param conexao Conexão que recebe as respostas.
+ * @return Quantidade de requisições enfileiradas.
+ */
+int ler_requisicoes_servidor(Servidor *servidor, LeitorInstancia *leitor, ConexaoServidor *conexao)
+{
+    int n_requisicoes = 0;
+    int lendo = 1;
+
+    while (lendo && leitor_pular_espacos(leitor) != -1)
+    {
+        RequisicaoServidor *requisicao = (RequisicaoServidor *)malloc(sizeof(RequisicaoServidor));
+        int64_t id = -1;
+        int prazo = 0;
+        int formato = FORMATO_INSTANCIA_TEXTO;
+        int n_pontos = 0;
+        int n_intervalos = 0;
+
+        lendo = 0;
+        if (requisicao != NULL)
+        {
+            inicializar_problema_backtracking(&requisicao->problema);
+            requisicao->problema.configuracao = servidor->configuracao;
+
+            if (leitor_ler_inteiro64(leitor, &id) && leitor_ler_inteiro(leitor, &prazo) && prazo >= 0 &&
+                ler_cabecalho_instancia(leitor, &formato, &n_pontos, &n_intervalos) == 1 && n_pontos <= servidor->max_elementos &&
+                n_intervalos <= servidor->max_elementos &&
+                ler_corpo_instancia_backtracking(leitor, &requisicao->problema, formato, n_pontos, n_intervalos))
+            {
+                requisicao->id = (long long)id;
+                requisicao->prazo_ms = prazo > 0 ? (double)prazo : servidor->prazo_padrao_ms;
+                requisicao->conexao = conexao;
+                clock_gettime(CLOCK_MONOTONIC, &requisicao->chegada);
+                atomic_fetch_add(&conexao->referencias, 1);
+                lendo = enfileirar_requisicao(servidor, requisicao);
+                if (lendo)
+                {
+                    n_requisicoes++;
+                }
+                else
+                {
+                    liberar_referencia_conexao(conexao);
+                }
+            }
+        }
+
+        if (lendo == 0)
+        {
+            TextoResposta texto = {NULL, 0, 0};
+
+            anexar_resposta(&texto, "%lld erro\n", (long long)id);
+            enviar_respostas(conexao, &texto);
+            free(texto.dados);
+            if (requisicao != NULL)
+            {
+                liberar_problema_backtracking(&requisicao->problema);
+                free(requisicao);
+            }
+        }
+    }
+
+    return n_requisicoes;
+}
+
+/**
+ * @brief Thread que atende uma conexão aceita pelo socket.
+ *
+ * As requisições são lidas de uma cópia do descritor, fechada pelo
+ * leitor, e as respostas são escritas em outra, que continua aberta até
+ * a última resposta. O descritor original só é fechado quando a thread
+ * é aguardada, de modo que o encerramento pode interromper a leitura
+ * com `shutdown` a qualquer momento.
+ *
+ * @param argumento Ponteiro para o `AtendimentoServidor`, liberado por `aguardar_atendimentos_servidor`.
+ * @return NULL.
+ */
+void *atender_conexao_servidor(void *argumento)
+{
+    AtendimentoServidor *atendimento = (AtendimentoServidor *)argumento;
+    Servidor *servidor = atendimento->servidor;
+    LeitorInstancia leitor;
+    ConexaoServidor *conexao = NULL;
+    int descritor_escrita = dup(atendimento->descritor);
+    int descritor_leitura = dup(atendimento->descritor);
+
+    if (descritor_escrita >= 0)
+    {
+        conexao = criar_conexao_servidor(descritor_escrita, 1);
+        if (conexao == NULL)
+        {
+            close(descritor_escrita);
+        }
+    }
+
+    if (conexao != NULL && descritor_leitura >= 0 && leitor_abrir_descritor(&leitor, descritor_leitura))
+    {
+        ler_requisicoes_servidor(servidor, &leitor, conexao);
+        leitor_fechar(&leitor);
+    }
+    else if (descritor_leitura >= 0 && conexao == NULL)
+    {
+        close(descritor_leitura);
+    }
+
+    if (conexao != NULL)
+    {
+        liberar_referencia_conexao(conexao);
+    }
+
+    pthread_mutex_lock(&servidor->trava);
+    atendimento->terminado = 1;
+    pthread_mutex_unlock(&servidor->trava);
+
+    return NULL;
+}
+
+/**
+ * @brief Aguarda as threads das conexões e libera seus atendimentos.
+ *
+ * Sem `todos`, só as threads que já terminaram são aguardadas, o que
+ * não bloqueia e impede a lista de crescer com conexões encerradas.
+ * Com `todos`, a leitura de cada conexão ainda aberta é interrompida
+ * com `shutdown`, e todas as threads são aguardadas; as respostas
+ * pendentes continuam sendo escritas.
+ *
+ * @param servidor Servidor cujas conexões são aguardadas.
+ * @param todos 1 para interromper e aguardar todas as conexões, 0 para só as terminadas.
+ */
+void aguardar_atendimentos_servidor(Servidor *servidor, int todos)
+{
+    AtendimentoServidor *aguardados = NULL;
+    AtendimentoServidor **anterior;
+
+    pthread_mutex_lock(&servidor->trava);
+    anterior = &servidor->atendimentos;
+    while (*anterior != NULL)
+    {
+        AtendimentoServidor *atendimento = *anterior;
+
+        if (todos || atendimento->terminado)
+        {
+            if (atendimento->terminado == 0)
+            {
+                shutdown(atendimento->descritor, SHUT_RD);
+            }
+            *anterior = atendimento->proximo;
+            atendimento->proximo = aguardados;
+            aguardados = atendimento;
+        }
+        else
+        {
+            anterior = &atendimento->proximo;
+        }
+    }
+    pthread_mutex_unlock(&servidor->trava);
+
+    while (aguardados != NULL)
+    {
+        AtendimentoServidor *atendimento = aguardados;
+
+        aguardados = atendimento->proximo;
+        pthread_join(atendimento->thread, NULL);
+        close(atendimento->descritor);
+        free(atendimento);
+    }
+}
+
+/**
+ * @brief Aceita conexões em um socket Unix até SIGINT ou SIGTERM.
+ *
+ * Cada conexão ganha uma thread que lê suas requisições, registrada em
+ * `servidor->atendimentos`; as que já terminaram são aguardadas a cada
+ * nova conexão. Um arquivo existente no caminho do socket é removido
+ * antes de criá-lo, e o socket é fechado (com `shutdown`) e removido ao
+ * final. As conexões ainda abertas são encerradas pelo chamador, com
+ * `aguardar_atendimentos_servidor`.
+ *
+ * @param servidor Servidor que recebe as requisições.
+ * @param caminho Caminho do socket.
+ * @return 1 se o socket foi criado, ou 0 em caso de falha.
+ */
+int aceitar_conexoes_servidor(Servidor *servidor, const char *caminho)
+{
+    struct sockaddr_un endereco;
+    int descritor;
+
+    if (strlen(caminho) >= sizeof(endereco.sun_path))
+    {
+        fprintf(stderr, "Erro: caminho do socket longo demais: %s.\n", caminho);
+        return 0;
+    }
+
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    strcpy(endereco.sun_path, caminho);
+    unlink(caminho);
+
+    descritor = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (descritor < 0 || bind(descritor, (struct sockaddr *)&endereco, sizeof(endereco)) != 0 ||
+        listen(descritor, CONEXOES_PENDENTES_SERVIDOR) != 0)
+    {
+        fprintf(stderr, "Erro ao criar o socket %s: %s.\n", caminho, strerror(errno));
+        if (descritor >= 0)
+        {
+            close(descritor);
+        }
+        return 0;
+    }
+
+    fprintf(stderr, "Servidor aguardando conexoes em %s.\n", caminho);
+
+    while (servidor_interrompido == 0)
+    {
+        int cliente = accept(descritor, NULL, NULL);
+        AtendimentoServidor *atendimento;
+
+        aguardar_atendimentos_servidor(servidor, 0);
+        if (cliente < 0)
+        {
+            if (errno != EINTR && errno != ECONNABORTED)
+            {
+                fprintf(stderr, "Erro ao aceitar conexao: %s.\n", strerror(errno));
+                break;
+            }
+            continue;
+        }
+
+        atendimento = (AtendimentoServidor *)malloc(sizeof(AtendimentoServidor));
+        if (atendimento == NULL)
+        {
+            close(cliente);
+            continue;
+        }
+        atendimento->servidor = servidor;
+        atendimento->descritor = cliente;
+        atendimento->terminado = 0;
+
+        /* O atendimento entra na lista antes de a thread existir, então nenhuma thread fica sem ser aguardada. */
+        pthread_mutex_lock(&servidor->trava);
+        if (pthread_create(&atendimento->thread, NULL, atender_conexao_servidor, atendimento) == 0)
+        {
+            atendimento->proximo = servidor->atendimentos;
+            servidor->atendimentos = atendimento;
+            atendimento = NULL;
+        }
+        pthread_mutex_unlock(&servidor->trava);
+
+        if (atendimento != NULL)
+        {
+            close(cliente);
+            free(atendimento);
+        }
+    }
+
+    shutdown(descritor, SHUT_RDWR);
+    close(descritor);
+    unlink(caminho);
+
+    return 1;
+}
+
+/**
+ * @brief Executa o modo servidor: um processo que resolve instâncias sob demanda.
+ *
+ * Em vez de um processo por resolução, as requisições chegam pela
+ * entrada padrão (endereço "-", com as respostas na saída padrão) ou
+ * por conexões a um socket Unix, e são resolvidas sem passar pelo
+ * menu. As pequenas vão para `n_trabalhadores` threads que as resolvem
+ * em lotes com `motor_pequenas`; as grandes, para uma thread que as
+ * resolve uma a uma com `motor_grandes`. Os motores exponenciais rodam
+ * sempre sob `limitado`, com o prazo da requisição ou um orçamento
+ * padrão; por isso o padrão dos dois motores, escolhido pelo programa,
+ * é a programação dinâmica, e não o núcleo de instâncias pequenas ou o
+ * motor paralelo, que sob `limitado` não seriam usados. As respostas podem sair fora da ordem das requisições e são
+ * identificadas pelo `id` de cada uma.
+ *
+ * Com a entrada padrão, o servidor termina quando ela acaba e todas as
+ * requisições foram respondidas; com o socket, ao receber SIGINT ou
+ * SIGTERM. No encerramento, o socket deixa de aceitar conexões, a
+ * leitura das conexões abertas é interrompida e suas threads são
+ * aguardadas; requisições que chegam nesse intervalo recebem `erro`, e
+ * as já enfileiradas são respondidas antes de os trabalhadores terminarem.
+ *
+ * @param endereco "-" ou o caminho do socket.
+ * @param configuracao Opções copiadas para cada requisição.
+ * @param motor_pequenas Motor das requisições pequenas.
+ * @param motor_grandes Motor das requisições grandes.
+ * @param n_trabalhadores Threads das requisições pequenas.
+ * @param tamanho_lote Máximo de requisições pequenas por lote.
+ * @param prazo_padrao_ms Prazo das requisições sem prazo, ou 0.
+ * @param max_elementos Máximo de pontos e de intervalos por requisição.
+ * @return 0 se o servidor terminou normalmente, 1 em caso de falha.
+ */
+int executar_servidor_backtracking(const char *endereco, const ConfiguracaoBacktracking *configuracao, int motor_pequenas,
+                                   int motor_grandes, int n_trabalhadores, int tamanho_lote, double prazo_padrao_ms, int max_elementos)
+{
+    Servidor servidor;
+    TrabalhadorServidor *trabalhadores;
+    struct sigaction acao;
+    sigset_t sinais, anteriores;
+    int n_criados = 0;
+    int falhou = 0;
+
+    memset(&servidor, 0, sizeof(servidor));
+    pthread_mutex_init(&servidor.trava, NULL);
+    pthread_cond_init(&servidor.sinal_pequenas, NULL);
+    pthread_cond_init(&servidor.sinal_grandes, NULL);
+    pthread_cond_init(&servidor.sinal_espaco, NULL);
+    servidor.configuracao = *configuracao;
+    servidor.configuracao.intervalo_progresso_ms = 0.0;
+    servidor.configuracao.medir_contadores = 0;
+    servidor.motor_pequenas = motor_pequenas;
+    servidor.motor_grandes = motor_grandes;
+    servidor.tamanho_lote = tamanho_lote;
+    servidor.prazo_padrao_ms = prazo_padrao_ms;
+    servidor.max_elementos = max_elementos;
+    atomic_init(&servidor.n_pequenas, 0);
+    atomic_init(&servidor.n_grandes, 0);
+    atomic_init(&servidor.n_lotes, 0);
+    atomic_init(&servidor.n_expiradas, 0);
+
+    /* Um cliente que desconecta antes da resposta não pode derrubar o servidor. */
+    signal(SIGPIPE, SIG_IGN);
+
+    /**
+     * As threads herdam SIGINT e SIGTERM bloqueados, de modo que os
+     * sinais interrompem o `accept` da thread principal.
+     */
+    sigemptyset(&sinais);
+    sigaddset(&sinais, SIGINT);
+    sigaddset(&sinais, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &sinais, &anteriores);
+
+    trabalhadores = (TrabalhadorServidor *)malloc(((size_t)n_trabalhadores + 1) * sizeof(TrabalhadorServidor));
+    for (int t = 0; trabalhadores != NULL && t <= n_trabalhadores; t++)
+    {
+        trabalhadores[t].servidor = &servidor;
+        trabalhadores[t].pequenas = t < n_trabalhadores;
+        if (pthread_create(&trabalhadores[t].thread, NULL, trabalhar_servidor, &trabalhadores[t]) != 0)
+        {
+            break;
+        }
+        n_criados++;
+    }
+
+    pthread_sigmask(SIG_SETMASK, &anteriores, NULL);
+
+    if (n_criados <= n_trabalhadores)
+    {
+        fprintf(stderr, "Erro: falha ao criar as threads do servidor.\n");
+        falhou = 1;
+    }
+    else if (strcmp(endereco, "-") == 0)
+    {
+        LeitorInstancia leitor;
+        ConexaoServidor *conexao = criar_conexao_servidor(STDOUT_FILENO, 0);
+        int descritor_entrada = dup(STDIN_FILENO);
+
+        /**
+         * A cópia do descritor faz o leitor usar `read`, que devolve o
+         * que já chegou, em vez do `fread` da entrada padrão, que
+         * esperaria o buffer inteiro enquanto o cliente aguarda respostas.
+         */
+        fflush(stdout);
+        if (conexao != NULL && descritor_entrada >= 0 && leitor_abrir_descritor(&leitor, descritor_entrada))
+        {
+            ler_requisicoes_servidor(&servidor, &leitor, conexao);
+            leitor_fechar(&leitor);
+        }
+        else
+        {
+            if (conexao == NULL && descritor_entrada >= 0)
+            {
+                close(descritor_entrada);
+            }
+            falhou = 1;
+        }
+        if (conexao != NULL)
+        {
+            liberar_referencia_conexao(conexao);
+        }
+    }
+    else
+    {
+        memset(&acao, 0, sizeof(acao));
+        acao.sa_handler = interromper_servidor;
+        sigemptyset(&acao.sa_mask);
+        sigaction(SIGINT, &acao, NULL);
+        sigaction(SIGTERM, &acao, NULL);
+        falhou = aceitar_conexoes_servidor(&servidor, endereco) == 0;
+    }
+
+    pthread_mutex_lock(&servidor.trava);
+    servidor.encerrando = 1;
+    pthread_cond_broadcast(&servidor.sinal_pequenas);
+    pthread_cond_broadcast(&servidor.sinal_grandes);
+    pthread_cond_broadcast(&servidor.sinal_espaco);
+    pthread_mutex_unlock(&servidor.trava);
+
+    /* As conexões são aguardadas antes dos trabalhadores, que ainda respondem o que elas enfileiraram. */
+    aguardar_atendimentos_servidor(&servidor, 1);
+
+    for (int t = 0; t < n_criados; t++)
+    {
+        pthread_join(trabalhadores[t].thread, NULL);
+    }
+    free(trabalhadores);
+
+    fprintf(stderr, "Servidor: %" PRId64 " requisicoes pequenas em %" PRId64 " lotes, %" PRId64 " grandes, %" PRId64 " expiradas.\n",
+            atomic_load(&servidor.n_pequenas), atomic_load(&servidor.n_lotes), atomic_load(&servidor.n_grandes),
+            atomic_load(&servidor.n_expiradas));
+
+    pthread_cond_destroy(&servidor.sinal_espaco);
+    pthread_cond_destroy(&servidor.sinal_grandes);
+    pthread_cond_destroy(&servidor.sinal_pequenas);
+    pthread_mutex_destroy(&servidor.trava);
+
+    return falhou;
+}
@@ -0,0 +1,393 @@
+#ifndef SOLUCIONADOR_BACKTRACKING_H
+#define SOLUCIONADOR_BACKTRACKING_H
+
+#include <time.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "cobertura.h"
+
+#define CABECALHO_MEMORIA 16
+
+#define MOTOR_BACKTRACKING_CLASSICO 0
+#define MOTOR_BACKTRACKING_PODA 1
+#define MOTOR_BACKTRACKING_PARALELO 2
+#define MOTOR_BACKTRACKING_ITERATIVO 3
+#define MOTOR_BACKTRACKING_LIMITADO 4
+#define MOTOR_BACKTRACKING_DINAMICA 5
+#define N_MOTORES_BACKTRACKING 6
+
+#define FASE_QUADRO_ENTRADA 0
+#define FASE_QUADRO_APOS_INCLUSAO 1
+
+#define FATIA_NOS_LIMITADA 4096
+
+#define PROFUNDIDADE_DIVISAO_PADRAO 10
+#define MAX_PROFUNDIDADE_DIVISAO 24
+
+#define TAMANHO_LOTE_SERVIDOR 64
+#define MAX_REQUISICOES_SERVIDOR 4096
+#define CONEXOES_PENDENTES_SERVIDOR 64
+#define ORCAMENTO_PADRAO_SERVIDOR_MS 1000.0
+#define MAX_ELEMENTOS_SERVIDOR 1000000
+
+#define MAX_INTERVALOS_PEQUENA 128
+#ifdef __SIZEOF_INT128__
+#define MAX_PONTOS_PEQUENA 128
+#else
+#define MAX_PONTOS_PEQUENA 64
+#endif
+
+/**
+ * @brief Opções de execução do algoritmo de backtracking.
+ *
+ * Reúne as escolhas que não fazem parte da instância do problema,
+ * mas alteram a forma como ela é resolvida. Cada problema carrega
+ * sua própria cópia da configuração, definida antes da resolução.
+ */
+typedef struct
+{
+    int usar_bitset; /**< 1 para representar a cobertura em bitsets de 64 bits, 0 para o vetor de contadores */
+    int motor; /**< Estratégia de busca (MOTOR_BACKTRACKING_*) */
+    int aplicar_reducao; /**< 1 para remover pontos e intervalos redundantes antes da busca */
+    int n_threads; /**< Quantidade de threads do motor paralelo */
+    int profundidade_divisao; /**< Profundidade em que o motor paralelo divide a árvore em tarefas */
+    double limite_tempo_ms; /**< Orçamento de tempo do motor limitado (em ms), ou 0 para não limitar */
+    int64_t limite_nos; /**< Orçamento de nós visitados do motor limitado, ou 0 para não limitar */
+    double intervalo_progresso_ms; /**< Intervalo entre registros de progresso do motor limitado (em ms), ou 0 para não registrar */
+    int medir_contadores; /**< 1 para ler os contadores de hardware durante a busca */
+    int decompor; /**< 1 para resolver em paralelo os componentes independentes da reta (modo em lote) */
+} ConfiguracaoBacktracking;
+
+/**
+ * @brief Quadro da pilha explícita da busca iterativa.
+ *
+ * Guarda o estado de uma chamada de `backtracking_recursivo` ainda não
+ * concluída: o intervalo em decisão e em que ponto da chamada a busca
+ * está (antes de decidir o intervalo ou de volta do ramo de inclusão).
+ */
+typedef struct
+{
+    int indice_intervalo; /**< Intervalo considerado pelo quadro */
+    int fase; /**< FASE_QUADRO_ENTRADA ou FASE_QUADRO_APOS_INCLUSAO */
+} QuadroBusca;
+
+/**
+ * @brief Entrada do heap de mínimo da programação dinâmica.
+ *
+ * Representa um intervalo que cobre o ponto em avaliação, com o custo
+ * ótimo de cobrir os pontos depois da sua faixa.
+ */
+typedef struct
+{
+    int valor; /**< Custo ótimo dos pontos após a faixa do intervalo, ou INT_MAX se não houver cobertura */
+    int intervalo; /**< Índice do intervalo */
+} EntradaDinamica;
+
+/**
+ * @brief Estrutura principal do problema de cobertura de pontos usando backtracking.
+ *
+ * Esta estrutura centraliza todos os dados necessários para a execução
+ * do algoritmo de backtracking, incluindo:
+ * - os pontos que devem ser cobertos;
+ * - os intervalos disponíveis para cobertura;
+ * - a solução em construção (parcial);
+ * - a melhor solução encontrada até o momento;
+ * - métricas de desempenho e qualidade.
+ *
+ * Ela permite organizar o estado do problema durante a busca na árvore
+ * de soluções, facilitando a aplicação de podas e a coleta de métricas.
+ */
+typedef struct
+{
+    Intervalo *intervalos; /**< Vetor com todos os intervalos disponíveis */
+    int n_intervalos; /**< Quantidade total de intervalos */
+    Ponto *pontos;  /**< Vetor com os pontos que devem ser cobertos */
+    int n_pontos;  /**< Quantidade total de pontos */
+    int *pontos_cobertos; /**< Contador, por ponto, de intervalos da solução parcial que o cobrem */
+    int n_pontos_cobertos; /**< Quantidade de pontos cobertos por pelo menos um intervalo da solução parcial */
+    Intervalo *solucao_atual; /**< Conjunto de intervalos da solução parcial */
+    int n_solucao_atual;  /**< Tamanho da solução parcial atual */
+    int *indices_solucao_atual; /**< Índice, em `intervalos`, de cada intervalo de `solucao_atual` */
+    Intervalo *melhor_solucao; /**< Melhor solução completa encontrada */
+    int n_melhor_solucao; /**< Quantidade de intervalos da melhor solução */
+    double tempo_execucao;  /**< Tempo total de execução do algoritmo (em ms) */
+    long memoria_utilizada; /**< Memória máxima utilizada pelo processo (em KB) */
+    double qualidade;  /**< Qualidade da solução encontrada */
+    int64_t nos_visitados; /**< Número de nós visitados na árvore de busca */
+    ConfiguracaoBacktracking configuracao; /**< Opções de execução do algoritmo */
+    int n_palavras; /**< Quantidade de palavras de 64 bits de cada bitset de pontos */
+    uint64_t *mascaras; /**< Bitset dos pontos cobertos por cada intervalo (n_intervalos x n_palavras) */
+    uint64_t *cobertura_bits; /**< Pilha de bitsets de cobertura, um nível por intervalo da solução parcial */
+    Intervalo *intervalos_por_inicio; /**< Cópia dos intervalos ordenada por início (motor com poda) */
+    Intervalo *alcance_ponto; /**< Para cada ponto, o intervalo que o cobre e alcança mais à direita (motor com poda) */
+    int *posicoes; /**< Posições dos pontos em vetor contíguo, lidas pelos laços de cobertura */
+    int *inicios; /**< Inícios dos intervalos em vetor contíguo */
+    int *fins; /**< Fins dos intervalos em vetor contíguo */
+    int *faixa_inicio; /**< Para cada intervalo, índice do primeiro ponto que ele cobre (pontos ordenados por posição) */
+    int *faixa_fim; /**< Para cada intervalo, índice seguinte ao último ponto que ele cobre */
+    Reducao reducao; /**< Resumo da redução aplicada antes da busca */
+    int64_t *nos_por_thread; /**< Nós visitados por cada thread do motor paralelo */
+    int n_threads_utilizadas; /**< Quantidade de posições válidas em `nos_por_thread` */
+    QuadroBusca *pilha_busca; /**< Pilha de quadros da busca iterativa (n_intervalos + 1 posições) */
+    int n_pilha_busca; /**< Quantidade de quadros empilhados */
+    int limite_inferior; /**< Limitante inferior do tamanho da solução ótima (motor limitado) */
+    double gap; /**< Gap de otimalidade da melhor solução: (solucao - limitante) / solucao (motor limitado) */
+    int busca_concluida; /**< 1 se o motor limitado terminou a busca dentro do orçamento */
+    CompressaoCoordenadas coordenadas; /**< Coordenadas originais, se a instância lida foi comprimida */
+    Arena arena; /**< Memória da instância e das estruturas da resolução */
+    size_t marcador_instancia; /**< Posição da arena logo após os pontos e intervalos */
+    ContabilidadeMemoria memoria; /**< Memória usada pela resolução, na arena e no heap */
+    int profundidade_maxima; /**< Maior profundidade de recursão ou de pilha atingida pela busca */
+} ProblemaBacktracking;
+
+/**
+ * @brief Subproblema da busca paralela: uma subárvore da busca clássica.
+ *
+ * A árvore de incluir/excluir de `backtracking_recursivo` é dividida na
+ * profundidade `configuracao.profundidade_divisao`. Cada tarefa guarda o
+ * prefixo de intervalos incluídos até ali e o próximo intervalo a
+ * decidir. As tarefas são numeradas na ordem em que a busca serial as
+ * visitaria, o que permite reproduzir exatamente o resultado serial.
+ */
+typedef struct
+{
+    int inicio_escolhas; /**< Posição, em `escolhas`, do primeiro intervalo do prefixo */
+    int n_escolhas; /**< Quantidade de intervalos incluídos no prefixo */
+    int indice_intervalo; /**< Próximo intervalo a ser decidido na subárvore */
+    int completa; /**< 1 se o prefixo já cobre todos os pontos (folha da divisão) */
+} TarefaBusca;
+
+/**
+ * @brief Fila dupla de tarefas de um trabalhador.
+ *
+ * Cada trabalhador recebe um bloco contíguo de tarefas, e as filas só
+ * perdem tarefas pelas pontas: a fila é a faixa `[inicio, fim)` dos
+ * índices das tarefas, sem vetor próprio. O dono consome tarefas pelo
+ * início (na ordem da busca serial) e os demais trabalhadores roubam
+ * tarefas pelo fim quando suas filas esvaziam.
+ */
+typedef struct
+{
+    int inicio; /**< Próxima tarefa a ser consumida pelo dono */
+    int fim; /**< Uma posição após a última tarefa disponível para roubo */
+    pthread_mutex_t trava; /**< Protege `inicio` e `fim` */
+} FilaTarefas;
+
+typedef struct ContextoParalelo ContextoParalelo;
+
+/**
+ * @brief Estado de um trabalhador da busca paralela.
+ *
+ * Cada trabalhador possui uma cópia rasa do problema, compartilhando os
+ * pontos, os intervalos e as máscaras (somente leitura) e mantendo sua
+ * própria solução parcial e cobertura.
+ */
+typedef struct
+{
+    ContextoParalelo *contexto; /**< Contexto compartilhado da busca */
+    int indice; /**< Índice do trabalhador (e da sua fila de tarefas) */
+    ProblemaBacktracking local; /**< Estado de busca privado do trabalhador */
+    uint64_t tarefa_atual; /**< Índice da tarefa em execução */
+    pthread_t thread; /**< Thread que executa o trabalhador */
+    int iniciada; /**< 1 se `thread` foi criada e precisa ser aguardada */
+} TrabalhadorBusca;
+
+/**
+ * @brief Estado compartilhado entre os trabalhadores da busca paralela.
+ *
+ * A melhor solução é identificada pela chave `(tamanho << 32) | tarefa`,
+ * lida atomicamente por todos os trabalhadores para podar. Entre soluções
+ * de mesmo tamanho vence a de menor tarefa, que é a primeira encontrada
+ * pela busca serial; assim, o resultado final é o mesmo do motor clássico.
+ */
+struct ContextoParalelo
+{
+    ProblemaBacktracking *problema; /**< Problema sendo resolvido */
+    TarefaBusca *tarefas; /**< Tarefas geradas, na ordem da busca serial */
+    int n_tarefas; /**< Quantidade de tarefas geradas */
+    int capacidade_tarefas; /**< Capacidade alocada de `tarefas` */
+    int *escolhas; /**< Prefixos de todas as tarefas, concatenados */
+    int n_escolhas; /**< Quantidade de posições usadas em `escolhas` */
+    int capacidade_escolhas; /**< Capacidade alocada de `escolhas` */
+    int *prefixo; /**< Prefixo corrente durante a geração das tarefas (na arena) */
+    FilaTarefas *filas; /**< Uma fila de tarefas por trabalhador (na arena) */
+    TrabalhadorBusca *trabalhadores; /**< Trabalhadores da busca (na arena) */
+    int n_threads; /**< Quantidade de trabalhadores */
+    _Atomic uint64_t incumbente; /**< Chave da melhor solução encontrada */
+    pthread_mutex_t trava_incumbente; /**< Serializa a cópia da melhor solução */
+};
+
+/**
+ * @brief Estrutura que armazena as métricas de desempenho do algoritmo de backtracking.
+ *
+ * Esta estrutura é utilizada para registrar e transportar os resultados
+ * da execução do algoritmo, permitindo analisar seu desempenho em
+ * diferentes cenários de teste (pequeno, médio e grande).
+ *
+ * As métricas incluem tempo de execução, uso de memória, qualidade da
+ * solução encontrada e o esforço computacional medido pelo número de
+ * nós visitados.
+ */
+typedef struct
+{
+    double tempo; /**< Tempo total de execução do algoritmo (em milissegundos) */
+    double tempo_preparo; /**< Parte do tempo gasta em redução, ordenação e alocação (em milissegundos) */
+    double tempo_busca; /**< Parte do tempo gasta apenas na busca (em milissegundos) */
+    long memoria; /**< Memória máxima utilizada durante a execução (em KB) */
+    double qualidade;  /**< Qualidade da solução (1 - intervalos_usados / intervalos_totais) */
+    int n_solucao;  /**< Número de intervalos da solução final encontrada */
+    int64_t nos_visitados; /**< Quantidade de nós visitados na árvore de busca */
+    int limite_inferior; /**< Limitante inferior do tamanho da solução ótima (motor limitado) */
+    double gap; /**< Gap de otimalidade da solução (motor limitado) */
+    int busca_concluida; /**< 1 se a busca terminou dentro do orçamento (motor limitado) */
+    size_t pico_memoria; /**< Pico de bytes em uso durante a resolução, incluindo a instância */
+    int64_t n_alocacoes; /**< Quantidade de alocações feitas durante a resolução */
+    int profundidade_maxima; /**< Maior profundidade de recursão ou de pilha atingida pela busca */
+    long long contadores[N_CONTADORES_HARDWARE]; /**< Contadores de hardware da busca (CONTADOR_*), ou -1 se não medidos */
+} MetricasBacktracking;
+
+/**
+ * @brief Conexão de um cliente do modo servidor.
+ *
+ * As respostas de uma conexão são escritas por várias threads (as que
+ * resolvem as requisições pequenas e a que resolve as grandes), uma
+ * escrita de cada vez. A conexão é liberada quando a thread que lê as
+ * requisições termina e todas as requisições lidas foram respondidas.
+ */
+typedef struct
+{
+    int descritor; /**< Descritor em que as respostas são escritas. */
+    int fechar; /**< 1 para fechar o descritor ao liberar a conexão (sockets), 0 para a saída padrão. */
+    pthread_mutex_t escrita; /**< Serializa as escritas das respostas. */
+    atomic_int referencias; /**< Leitor da conexão mais requisições ainda não respondidas. */
+} ConexaoServidor;
+
+/**
+ * @brief Requisição lida e ainda não respondida pelo modo servidor.
+ */
+typedef struct RequisicaoServidor
+{
+    ProblemaBacktracking problema; /**< Instância lida, com a configuração do servidor. */
+    long long id; /**< Identificador escolhido pelo cliente, repetido na resposta. */
+    double prazo_ms; /**< Prazo a partir da chegada (em ms), ou 0 sem prazo. */
+    struct timespec chegada; /**< Instante em que a requisição terminou de ser lida. */
+    ConexaoServidor *conexao; /**< Conexão que recebe a resposta. */
+    struct RequisicaoServidor *proxima; /**< Próxima requisição da mesma fila. */
+} RequisicaoServidor;
+
+/**
+ * @brief Fila de requisições na ordem de chegada.
+ */
+typedef struct
+{
+    RequisicaoServidor *primeira; /**< Próxima requisição a resolver, ou NULL. */
+    RequisicaoServidor *ultima; /**< Requisição mais recente, ou NULL. */
+} FilaServidor;
+
+/**
+ * @brief Thread que atende uma conexão de socket, acompanhada até o encerramento.
+ */
+typedef struct AtendimentoServidor
+{
+    struct Servidor *servidor; /**< Servidor que recebe as requisições. */
+    int descritor; /**< Descritor de leitura da conexão, ou -1 depois que a thread o fecha. */
+    int terminado; /**< 1 quando a thread terminou e pode ser aguardada sem bloquear. */
+    pthread_t thread; /**< Thread que lê as requisições da conexão. */
+    struct AtendimentoServidor *proximo; /**< Próximo atendimento da lista do servidor. */
+} AtendimentoServidor;
+
+/**
+ * @brief Estado compartilhado entre as threads do modo servidor.
+ *
+ * As requisições pequenas (que cabem no núcleo de instâncias pequenas,
+ * até `MAX_PONTOS_PEQUENA` pontos e `MAX_INTERVALOS_PEQUENA`
+ * intervalos) e as grandes ficam em filas separadas. O total de
+ * requisições enfileiradas é limitado por `MAX_REQUISICOES_SERVIDOR`:
+ * acima dele, a leitura espera, o que devolve a pressão aos clientes.
+ * As threads das conexões ficam em `atendimentos` e são todas aguardadas
+ * antes que o servidor deixe de existir.
+ */
+typedef struct Servidor
+{
+    pthread_mutex_t trava; /**< Protege as filas, `pendentes`, `encerrando` e `atendimentos`. */
+    pthread_cond_t sinal_pequenas; /**< Sinalizado quando chega uma requisição pequena ou no encerramento. */
+    pthread_cond_t sinal_grandes; /**< Sinalizado quando chega uma requisição grande ou no encerramento. */
+    pthread_cond_t sinal_espaco; /**< Sinalizado quando requisições saem das filas. */
+    FilaServidor pequenas; /**< Requisições resolvidas em lotes pelo motor das instâncias pequenas. */
+    FilaServidor grandes; /**< Requisições resolvidas uma a uma por `motor_grandes`. */
+    int pendentes; /**< Requisições nas duas filas. */
+    int encerrando; /**< 1 quando não chegam mais requisições. */
+    ConfiguracaoBacktracking configuracao; /**< Configuração copiada para cada requisição. */
+    int motor_pequenas; /**< Motor das requisições pequenas (MOTOR_BACKTRACKING_*). */
+    int motor_grandes; /**< Motor das requisições grandes (MOTOR_BACKTRACKING_*). */
+    int tamanho_lote; /**< Máximo de requisições pequenas retiradas da fila de uma vez. */
+    double prazo_padrao_ms; /**< Prazo das requisições que não informam um, ou 0 sem prazo. */
+    int max_elementos; /**< Máximo de pontos e de intervalos aceito em uma requisição. */
+    _Atomic int64_t n_pequenas; /**< Requisições pequenas respondidas. */
+    _Atomic int64_t n_grandes; /**< Requisições grandes respondidas. */
+    _Atomic int64_t n_lotes; /**< Lotes de requisições pequenas resolvidos. */
+    _Atomic int64_t n_expiradas; /**< Requisições cujo prazo terminou antes de uma solução. */
+    AtendimentoServidor *atendimentos; /**< Threads das conexões de socket ainda não aguardadas. */
+} Servidor;
+
+/**
+ * @brief Uma thread que resolve as requisições de uma das filas.
+ */
+typedef struct
+{
+    Servidor *servidor; /**< Servidor cujas filas são atendidas. */
+    int pequenas; /**< 1 para a fila das requisições pequenas, 0 para a das grandes. */
+    pthread_t thread; /**< Thread criada para o trabalhador. */
+} TrabalhadorServidor;
+
+/**
+ * @brief Texto das respostas de um lote, acumulado para uma única escrita.
+ */
+typedef struct
+{
+    char *dados; /**< Texto acumulado, terminado em zero. */
+    size_t tamanho; /**< Bytes de texto em `dados`. */
+    size_t capacidade; /**< Bytes reservados em `dados`. */
+} TextoResposta;
+
+void inicializar_problema_backtracking(ProblemaBacktracking *problema);
+void liberar_problema_backtracking(ProblemaBacktracking *problema);
+int comparar_intervalos_backtracking(const void *a, const void *b);
+const char *nome_motor_backtracking(int motor);
+int alocar_instancia_backtracking(ProblemaBacktracking *problema, int n_pontos, int n_intervalos);
+int configurar_cenario_backtracking(ProblemaBacktracking *problema, int cenario);
+int gerar_instancia_backtracking(ProblemaBacktracking *problema, int n_pontos, int n_intervalos, int distribuicao, uint64_t semente);
+int ler_corpo_instancia_backtracking(LeitorInstancia *leitor, ProblemaBacktracking *problema, int formato, int n_pontos, int n_intervalos);
+int ler_instancia_backtracking(LeitorInstancia *leitor, ProblemaBacktracking *problema);
+MetricasBacktracking resolver_backtracking(ProblemaBacktracking *problema);
+int motor_por_nome_backtracking(const char *nome);
+
+/* Modo em lote. */
+void preencher_registro_backtracking(RegistroExecucao *registro, const ConfiguracaoBacktracking *configuracao, const MetricasBacktracking *metricas);
+void converter_opcoes_backtracking(const ConfiguracaoBacktracking *configuracao, OpcoesCobertura *opcoes);
+MetricasBacktracking resolver_lote_backtracking(ProblemaBacktracking *problema, CacheCobertura *cache);
+void registrar_comparacao_lote_backtracking(ProblemaBacktracking *problema, const ConfiguracaoMedicao *medicao, const char *origem, int indice,
+                                            FILE *saida);
+void escrever_resultado_lote_backtracking(const ProblemaBacktracking *problema, const MetricasBacktracking *metricas, const char *origem, int indice,
+                                          int n_pontos, int n_intervalos, FILE *saida);
+
+/* Modo servidor. */
+void interromper_servidor(int sinal);
+int anexar_resposta(TextoResposta *texto, const char *formato, ...);
+int escrever_tudo(int descritor, const char *dados, size_t tamanho);
+void enviar_respostas(ConexaoServidor *conexao, TextoResposta *texto);
+ConexaoServidor *criar_conexao_servidor(int descritor, int fechar);
+void liberar_referencia_conexao(ConexaoServidor *conexao);
+int enfileirar_requisicao(Servidor *servidor, RequisicaoServidor *requisicao);
+int retirar_lote_servidor(Servidor *servidor, int pequenas, RequisicaoServidor **lote, int maximo);
+void resolver_requisicao_servidor(Servidor *servidor, RequisicaoServidor *requisicao, int motor, TextoResposta *texto);
+void *trabalhar_servidor(void *argumento);
+int ler_requisicoes_servidor(Servidor *servidor, LeitorInstancia *leitor, ConexaoServidor *conexao);
+void *atender_conexao_servidor(void *argumento);
+void aguardar_atendimentos_servidor(Servidor *servidor, int todos);
+int aceitar_conexoes_servidor(Servidor *servidor, const char *caminho);
+int executar_servidor_backtracking(const char *endereco, const ConfiguracaoBacktracking *configuracao, int motor_pequenas,
+                                   int motor_grandes, int n_trabalhadores, int tamanho_lote, double prazo_padrao_ms, int max_elementos);
+
+#endif
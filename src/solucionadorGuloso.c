@@ -0,0 +1,3097 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <math.h>
+#include <limits.h>
+#include <stdint.h>
+#include <sched.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "solucionadorGuloso.h"
+
+/**
+ * @brief Inicializa a estrutura do problema para o algoritmo guloso.
+ *
+ * Esta função prepara a estrutura `Problema` para uso, inicializando
+ * todos os ponteiros como NULL e zerando os contadores e métricas.
+ *
+ * Ela deve ser chamada antes de configurar qualquer cenário ou executar
+ * o algoritmo guloso, garantindo que o estado inicial do problema seja
+ * consistente e evitando acessos indevidos à memória.
+ *
+ * @param problema Ponteiro para a estrutura `Problema` a ser inicializada.
+ */
+void inicializar_problema(Problema *problema)
+{
+    problema->intervalos = NULL;
+    problema->pontos = NULL;
+    problema->pontos_cobertos = NULL;
+    problema->solucao = NULL;
+    problema->n_intervalos = 0;
+    problema->n_pontos = 0;
+    problema->n_pontos_cobertos = 0;
+    problema->n_solucao = 0;
+    problema->tempo_execucao = 0.0;
+    problema->memoria_utilizada = 0;
+    problema->qualidade = 0.0;
+    problema->configuracao.usar_bitset = 0;
+    problema->configuracao.motor = MOTOR_GULOSO_CLASSICO;
+    problema->configuracao.aplicar_reducao = 0;
+    problema->configuracao.medir_contadores = 0;
+    problema->n_palavras = 0;
+    problema->mascaras = NULL;
+    problema->pontos_cobertos_bits = NULL;
+    problema->intervalos_por_inicio = NULL;
+    problema->posicoes = NULL;
+    problema->inicios = NULL;
+    problema->fins = NULL;
+    problema->posto = NULL;
+    problema->faixa_inicio = NULL;
+    problema->faixa_fim = NULL;
+    problema->arvore_descobertos = NULL;
+    problema->proximo_descoberto = NULL;
+    problema->proximo_ponto = 0;
+    problema->intervalos_por_faixa = NULL;
+    problema->folhas_alcance = 0;
+    problema->arvore_alcance = NULL;
+    problema->ganho_estimado = NULL;
+    problema->candidatos = NULL;
+    problema->reducao.aplicada = 0;
+    problema->reducao.pontos_duplicados = 0;
+    problema->reducao.pontos_dominados = 0;
+    problema->reducao.intervalos_dominados = 0;
+    problema->coordenadas.valores = NULL;
+    problema->coordenadas.n_valores = 0;
+    problema->arena.base = NULL;
+    problema->arena.capacidade = 0;
+    problema->arena.usado = 0;
+    problema->arena.contabilidade = NULL;
+    problema->marcador_instancia = 0;
+    problema->memoria.bytes_em_uso = 0;
+    problema->memoria.pico_bytes = 0;
+    problema->memoria.n_alocacoes = 0;
+}
+
+/**
+ * @brief Libera toda a memória alocada dinamicamente pelo problema guloso.
+ *
+ * Esta função é responsável por desalocar todos os vetores associados
+ * à estrutura `Problema`, incluindo intervalos, pontos, controle de
+ * cobertura e solução construída pelo algoritmo guloso. Todos vivem
+ * na arena do problema, liberada em uma única chamada.
+ *
+ * Após a liberação, todos os ponteiros são definidos como NULL para
+ * evitar ponteiros pendentes (dangling pointers) e possíveis acessos
+ * inválidos à memória.
+ *
+ * Essa função deve ser chamada ao final da execução de cada cenário
+ * para garantir a correta liberação de recursos.
+ *
+ * @param problema Ponteiro para a estrutura `Problema` cujos recursos
+ *        serão liberados.
+ */
+void liberar_problema(Problema *problema)
+{
+    /**
+     * Todos os vetores pertencem à arena e são devolvidos juntos
+     * por `arena_liberar`.
+     */
+    problema->intervalos = NULL;
+    problema->pontos = NULL;
+    problema->pontos_cobertos = NULL;
+    problema->solucao = NULL;
+    problema->mascaras = NULL;
+    problema->pontos_cobertos_bits = NULL;
+    problema->intervalos_por_inicio = NULL;
+    problema->posicoes = NULL;
+    problema->inicios = NULL;
+    problema->fins = NULL;
+    problema->posto = NULL;
+    problema->faixa_inicio = NULL;
+    problema->faixa_fim = NULL;
+    problema->arvore_descobertos = NULL;
+    problema->proximo_descoberto = NULL;
+    problema->proximo_ponto = 0;
+    problema->intervalos_por_faixa = NULL;
+    problema->folhas_alcance = 0;
+    problema->arvore_alcance = NULL;
+    problema->ganho_estimado = NULL;
+    problema->candidatos = NULL;
+    liberar_compressao(&problema->coordenadas);
+    arena_liberar(&problema->arena);
+}
+
+/**
+ * @brief Função de comparação entre intervalos para ordenação no algoritmo guloso.
+ *
+ * Esta função define o critério de ordenação dos intervalos utilizado
+ * pelo algoritmo guloso. Os intervalos são ordenados primeiramente
+ * pelo valor de término (`fim`) em ordem crescente.
+ *
+ * Em caso de empate no valor de término, o desempate é feito pelo
+ * valor de início (`inicio`), também em ordem crescente.
+ *
+ * Esse critério é fundamental para a estratégia gulosa adotada,
+ * pois prioriza intervalos que terminam mais cedo, aumentando a
+ * chance de cobrir o maior número de pontos com menos intervalos.
+ *
+ * A função é projetada para ser utilizada com a função `qsort`.
+ *
+ * @param a Ponteiro para o primeiro intervalo a ser comparado.
+ * @param b Ponteiro para o segundo intervalo a ser comparado.
+ *
+ * @return Valor negativo se `a` deve vir antes de `b`,
+ *         valor positivo se `a` deve vir depois de `b`,
+ *         ou zero se ambos forem considerados equivalentes
+ *         segundo o critério de ordenação.
+ */
+int comparar_intervalos(const void *a, const void *b)
+{
+    int resultado = 0;
+    Intervalo *intervalo_a = (Intervalo *)a;
+    Intervalo *intervalo_b = (Intervalo *)b;
+
+    if (intervalo_a->fim < intervalo_b->fim)
+    {
+        resultado = -1;
+    }
+    else if (intervalo_a->fim > intervalo_b->fim)
+    {
+        resultado = 1;
+    }
+    else
+    {
+        if (intervalo_a->inicio < intervalo_b->inicio)
+        {
+            resultado = -1;
+        }
+        else if (intervalo_a->inicio > intervalo_b->inicio)
+        {
+            resultado = 1;
+        }
+        else
+        {
+            resultado = 0;
+        }
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Retorna o nome de um motor guloso, para exibição e registro.
+ *
+ * @param motor Identificador do motor (MOTOR_GULOSO_*).
+ * @return Nome curto do motor.
+ */
+const char *nome_motor_guloso(int motor)
+{
+    const char *nome = "desconhecido";
+    if (motor == MOTOR_GULOSO_CLASSICO)
+    {
+        nome = "classico";
+    }
+    else if (motor == MOTOR_GULOSO_VARREDURA)
+    {
+        nome = "varredura";
+    }
+    return nome;
+}
+
+/**
+ * @brief Aplica a redução de pontos e intervalos redundantes ao problema.
+ *
+ * Compacta no lugar os vetores `pontos` e `intervalos` do problema com
+ * `reduzir_instancia`, atualiza `n_pontos` e `n_intervalos` e guarda
+ * o resumo da redução em `problema->reducao`. Deve ser chamada antes da
+ * alocação das estruturas auxiliares da resolução.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @return Resumo da redução aplicada.
+ */
+Reducao reduzir_problema(Problema *problema)
+{
+    problema->reducao = reduzir_instancia(&problema->arena, problema->pontos, &problema->n_pontos, problema->intervalos, &problema->n_intervalos);
+    return problema->reducao;
+}
+
+/**
+ * @brief Calcula o tamanho da arena de uma instância do algoritmo guloso.
+ *
+ * Soma, com a folga de alinhamento de cada bloco, a instância (pontos
+ * e intervalos), a memória temporária da redução e as estruturas de
+ * cobertura do motor e da representação escolhidos em `configuracao`.
+ *
+ * @param n_pontos Quantidade de pontos da instância.
+ * @param n_intervalos Quantidade de intervalos da instância.
+ * @param configuracao Opções de execução que serão usadas na resolução.
+ * @return Quantidade de bytes necessária.
+ */
+size_t calcular_tamanho_arena(int n_pontos, int n_intervalos, const ConfiguracaoGuloso *configuracao)
+{
+    size_t pontos = (size_t)n_pontos;
+    size_t intervalos = (size_t)n_intervalos;
+    size_t palavras = (pontos + 63) / 64; /* o mesmo que calcular_palavras_bitset */
+    size_t tamanho = 0;
+
+    tamanho += ALINHAR_ARENA(pontos * sizeof(Ponto));
+    tamanho += ALINHAR_ARENA(intervalos * sizeof(Intervalo));
+
+    if (configuracao->aplicar_reducao)
+    {
+        tamanho += ALINHAR_ARENA((intervalos + 1) * sizeof(FaixaReducao));
+        tamanho += ALINHAR_ARENA((intervalos + pontos + 1) * sizeof(int));
+        tamanho += 2 * ALINHAR_ARENA((pontos + 1) * sizeof(int));
+    }
+
+    tamanho += ALINHAR_ARENA(intervalos * sizeof(Intervalo));
+    if (configuracao->motor == MOTOR_GULOSO_CLASSICO)
+    {
+        tamanho += ALINHAR_ARENA(pontos * sizeof(int)) + 2 * ALINHAR_ARENA(intervalos * sizeof(int));
+    }
+    if (configuracao->motor == MOTOR_GULOSO_CLASSICO && configuracao->usar_bitset == 0)
+    {
+        size_t folhas = 1; /* o mesmo que construir_indices_cobertura */
+
+        while (folhas < intervalos)
+        {
+            folhas *= 2;
+        }
+        tamanho += ALINHAR_ARENA(pontos * sizeof(int)) + 2 * ALINHAR_ARENA((pontos + 1) * sizeof(int));
+        tamanho += 4 * ALINHAR_ARENA(intervalos * sizeof(int)) + ALINHAR_ARENA(2 * folhas * sizeof(int));
+        tamanho += ALINHAR_ARENA(intervalos * sizeof(CandidatoGanho));
+        tamanho += ALINHAR_ARENA(pontos * sizeof(Ponto)) + ALINHAR_ARENA((pontos + 2) * sizeof(int));
+    }
+    if (configuracao->usar_bitset)
+    {
+        if (configuracao->motor == MOTOR_GULOSO_CLASSICO)
+        {
+            tamanho += ALINHAR_ARENA(intervalos * palavras * sizeof(uint64_t));
+        }
+        tamanho += ALINHAR_ARENA(palavras * sizeof(uint64_t));
+    }
+    else
+    {
+        tamanho += ALINHAR_ARENA(pontos * sizeof(int));
+    }
+    if (configuracao->motor == MOTOR_GULOSO_VARREDURA)
+    {
+        tamanho += ALINHAR_ARENA(intervalos * sizeof(Intervalo));
+    }
+
+    return tamanho;
+}
+
+/**
+ * @brief Cria a arena de uma instância e reserva nela os pontos e intervalos.
+ *
+ * A arena é dimensionada uma única vez por `calcular_tamanho_arena`,
+ * a partir do tamanho da instância e de `problema->configuracao`, que
+ * por isso deve estar definida antes. Toda a memória da resolução sai
+ * dela e é devolvida de uma vez por `liberar_problema`.
+ *
+ * Os vetores `pontos` e `intervalos` ficam alocados mas não
+ * preenchidos; a posição da arena logo após eles é guardada em
+ * `marcador_instancia`, para onde cada resolução retorna antes de
+ * alocar suas estruturas.
+ *
+ * @param problema Ponteiro para a estrutura do problema, inicializada.
+ * @param n_pontos Quantidade de pontos da instância.
+ * @param n_intervalos Quantidade de intervalos da instância.
+ * @return 1 se a instância foi alocada, ou 0 em caso de falha de alocação.
+ */
+int alocar_instancia(Problema *problema, int n_pontos, int n_intervalos)
+{
+    int resultado = 0;
+
+    if (arena_criar(&problema->arena, calcular_tamanho_arena(n_pontos, n_intervalos, &problema->configuracao), &problema->memoria))
+    {
+        problema->pontos = (Ponto *)arena_alocar(&problema->arena, (size_t)n_pontos * sizeof(Ponto));
+        problema->intervalos = (Intervalo *)arena_alocar(&problema->arena, (size_t)n_intervalos * sizeof(Intervalo));
+        problema->n_pontos = n_pontos;
+        problema->n_intervalos = n_intervalos;
+        problema->marcador_instancia = arena_marcador(&problema->arena);
+        resultado = 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Garante que a arena comporte a resolução com a configuração atual.
+ *
+ * A arena é dimensionada pela configuração vigente em `alocar_instancia`.
+ * Se as opções mudarem depois (por exemplo, passando a usar bitsets),
+ * uma arena maior é criada, os pontos e intervalos são copiados para
+ * ela e a antiga é liberada.
+ *
+ * @param problema Ponteiro para a estrutura do problema, com a instância
+ *        alocada por `alocar_instancia`.
+ * @return 1 se a arena comporta a resolução, ou 0 em caso de falha de alocação.
+ */
+int garantir_arena(Problema *problema)
+{
+    size_t necessario = calcular_tamanho_arena(problema->n_pontos, problema->n_intervalos, &problema->configuracao);
+    int resultado = 1;
+
+    if (necessario > problema->arena.capacidade)
+    {
+        Arena nova;
+
+        resultado = 0;
+        if (arena_criar(&nova, necessario, &problema->memoria))
+        {
+            Ponto *pontos = (Ponto *)arena_alocar(&nova, (size_t)problema->n_pontos * sizeof(Ponto));
+            Intervalo *intervalos = (Intervalo *)arena_alocar(&nova, (size_t)problema->n_intervalos * sizeof(Intervalo));
+
+            memcpy(pontos, problema->pontos, (size_t)problema->n_pontos * sizeof(Ponto));
+            memcpy(intervalos, problema->intervalos, (size_t)problema->n_intervalos * sizeof(Intervalo));
+            arena_liberar(&problema->arena);
+
+            problema->arena = nova;
+            problema->pontos = pontos;
+            problema->intervalos = intervalos;
+            problema->marcador_instancia = arena_marcador(&problema->arena);
+            resultado = 1;
+        }
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Configura um dos cenários fixos do problema de cobertura de pontos.
+ *
+ * Copia para a instância os pontos e intervalos determinísticos de
+ * `obter_cenario` (8 pontos e 10 intervalos no pequeno, 10 e 12 no
+ * médio, 12 e 15 no grande), escolhidos de forma a garantir que todos
+ * os pontos possam ser cobertos.
+ *
+ * Os intervalos são ordenados conforme o critério guloso antes da
+ * execução do algoritmo.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @param cenario Cenário (CENARIO_PEQUENO, CENARIO_MEDIO ou CENARIO_GRANDE).
+ * @return 1 se o cenário foi configurado, ou 0 em caso de falha.
+ */
+int configurar_cenario(Problema *problema, int cenario)
+{
+    const CenarioCobertura *dados = obter_cenario(cenario);
+    int resultado = 0;
+
+    if (dados != NULL && alocar_instancia(problema, dados->n_pontos, dados->n_intervalos))
+    {
+        memcpy(problema->pontos, dados->pontos, (size_t)dados->n_pontos * sizeof(Ponto));
+        memcpy(problema->intervalos, dados->intervalos, (size_t)dados->n_intervalos * sizeof(Intervalo));
+        qsort(problema->intervalos, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos);
+        resultado = 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Gera uma instância sintética reprodutível a partir de uma semente.
+ *
+ * Complementa os cenários fixos `configurar_cenario_*` com instâncias de
+ * qualquer tamanho. O domínio cresce com a instância (dez posições por
+ * elemento), e as distribuições são:
+ * - uniforme: inícios uniformes e comprimentos que dão, em média, dois
+ *   intervalos por posição;
+ * - agrupada: intervalos curtos concentrados em torno de √n centros;
+ * - sobreposta: intervalos longos, com cerca de 32 intervalos por posição;
+ * - aninhada: cadeias de 16 intervalos encaixados uns nos outros;
+ * - adversaria: blocos em que o guloso clássico usa 3 intervalos e o
+ *   ótimo usa 2 (veja `gerar_blocos_adversarios`); abaixo de 4 pontos
+ *   ou 3 intervalos, recai na uniforme.
+ *
+ * Exceto na adversária, cada ponto é sorteado dentro de um intervalo
+ * sorteado, o que garante que toda instância gerada tenha cobertura.
+ * O problema deve estar inicializado e com a configuração definida.
+ *
+ * @param problema Problema que recebe a instância.
+ * @param n_pontos Quantidade de pontos.
+ * @param n_intervalos Quantidade de intervalos (ao menos 1 se houver pontos).
+ * @param distribuicao Constante DISTRIBUICAO_*.
+ * @param semente Semente do gerador.
+ * @return 1 se a instância foi gerada, ou 0 se os parâmetros forem inválidos ou faltar memória.
+ */
+int gerar_instancia(Problema *problema, int n_pontos, int n_intervalos, int distribuicao, uint64_t semente)
+{
+    GeradorAleatorio gerador;
+    int maior = n_pontos > n_intervalos ? n_pontos : n_intervalos;
+    int dominio, comprimento_medio;
+    int n_centros = 1, espalhamento = 1;
+    int centro = 0, raio = 0;
+
+    if (n_pontos < 0 || n_intervalos < 0 || (n_pontos > 0 && n_intervalos == 0) ||
+        maior > (INT_MAX / 4 - 100) / 10 || distribuicao < 0 || distribuicao >= N_DISTRIBUICOES)
+    {
+        return 0;
+    }
+
+    if (alocar_instancia(problema, n_pontos, n_intervalos) == 0)
+    {
+        return 0;
+    }
+
+    gerador.estado = semente;
+    dominio = 10 * maior + 100;
+    comprimento_medio = n_intervalos > 0 ? (int)((2LL * dominio) / n_intervalos) : 1;
+    if (distribuicao == DISTRIBUICAO_SOBREPOSTA)
+    {
+        comprimento_medio *= 16;
+    }
+    if (comprimento_medio < 1)
+    {
+        comprimento_medio = 1;
+    }
+    else if (comprimento_medio > dominio)
+    {
+        comprimento_medio = dominio;
+    }
+
+    if (distribuicao == DISTRIBUICAO_ADVERSARIA && n_pontos >= 4 && n_intervalos >= 3)
+    {
+        gerar_blocos_adversarios(&gerador, problema->pontos, n_pontos, problema->intervalos, n_intervalos);
+    }
+    else
+    {
+        if (distribuicao == DISTRIBUICAO_AGRUPADA)
+        {
+            n_centros = (int)sqrt((double)n_pontos) + 1;
+            espalhamento = dominio / (4 * n_centros) + 1;
+        }
+
+        for (int i = 0; i < n_intervalos; i++)
+        {
+            int comprimento = 1 + gerador_uniforme(&gerador, 2 * comprimento_medio);
+            int inicio;
+
+            if (distribuicao == DISTRIBUICAO_AGRUPADA)
+            {
+                /* Centros reproduzidos a partir da semente, sem guardar um vetor. */
+                GeradorAleatorio centros = {semente ^ (uint64_t)gerador_uniforme(&gerador, n_centros)};
+                int deslocamento = gerador_uniforme(&gerador, 2 * espalhamento) - espalhamento;
+                deslocamento = (deslocamento + gerador_uniforme(&gerador, 2 * espalhamento) - espalhamento) / 2;
+                comprimento = 1 + gerador_uniforme(&gerador, espalhamento);
+                inicio = gerador_uniforme(&centros, dominio) + deslocamento - comprimento / 2;
+            }
+            else if (distribuicao == DISTRIBUICAO_ANINHADA)
+            {
+                if (i % 16 == 0)
+                {
+                    centro = gerador_uniforme(&gerador, dominio);
+                    raio = 0;
+                }
+                raio += 1 + gerador_uniforme(&gerador, comprimento_medio / 16 + 1);
+                comprimento = 2 * raio;
+                inicio = centro - raio;
+            }
+            else
+            {
+                inicio = gerador_uniforme(&gerador, dominio) - comprimento / 2;
+            }
+
+            problema->intervalos[i] = (Intervalo){inicio, inicio + comprimento};
+        }
+
+        for (int j = 0; j < n_pontos; j++)
+        {
+            Intervalo intervalo = problema->intervalos[gerador_uniforme(&gerador, n_intervalos)];
+            problema->pontos[j].posicao = intervalo.inicio + gerador_uniforme(&gerador, intervalo.fim - intervalo.inicio + 1);
+        }
+    }
+
+    for (int j = 0; j < n_pontos; j++)
+    {
+        problema->pontos[j].id = j + 1;
+    }
+
+    qsort(problema->intervalos, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos);
+
+    return 1;
+}
+
+/**
+ * @brief Lê a próxima instância de uma origem para o problema.
+ *
+ * Uma origem pode conter várias instâncias em sequência, cada uma em
+ * um dos formatos reconhecidos por `ler_cabecalho_instancia` (texto,
+ * "CPI1" com valores de 32 bits ou "CPI2" com valores de 64 bits).
+ * Instâncias com coordenadas fora do intervalo de `int` são
+ * comprimidas para postos densos por `ler_valores_instancia`, e a
+ * tabela das coordenadas originais fica em `problema->coordenadas`.
+ *
+ * Os pontos recebem identificadores de 1 a `n_pontos`, na ordem lida.
+ * Os vetores são alocados na arena do problema por
+ * `alocar_instancia`, de modo que `problema->configuracao`
+ * deve estar definida antes, e os intervalos são ordenados como nos
+ * cenários fixos.
+ *
+ * @param leitor Leitor aberto por `leitor_abrir`.
+ * @param problema Ponteiro para a estrutura do problema, inicializada.
+ * @return 1 se uma instância foi lida, 0 se a origem terminou antes
+ *         de uma nova instância, ou -1 se a instância é inválida ou
+ *         não pôde ser alocada.
+ */
+int ler_instancia(LeitorInstancia *leitor, Problema *problema)
+{
+    int n_pontos = 0;
+    int n_intervalos = 0;
+    int formato = FORMATO_INSTANCIA_TEXTO;
+    int resultado = ler_cabecalho_instancia(leitor, &formato, &n_pontos, &n_intervalos);
+
+    if (resultado != 1)
+    {
+        return resultado;
+    }
+
+    if (alocar_instancia(problema, n_pontos, n_intervalos) == 0 ||
+        ler_valores_instancia(leitor, formato, problema->pontos, n_pontos, problema->intervalos, n_intervalos, &problema->coordenadas) == 0)
+    {
+        return -1;
+    }
+
+    qsort(problema->intervalos, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos);
+
+    return 1;
+}
+
+/**
+ * @brief Copia as coordenadas da instância para vetores contíguos.
+ *
+ * Os laços de cobertura do guloso clássico só leem a posição de cada
+ * ponto e os extremos de cada intervalo. Separados em `posicoes`,
+ * `inicios` e `fins` (estrutura de vetores), alinhados pela arena,
+ * esses laços percorrem metade dos bytes dos vetores de `Ponto` e de
+ * `Intervalo` e podem ser vetorizados; o `id` dos pontos permanece
+ * apenas em `pontos`, consultado na exibição.
+ *
+ * Deve ser chamada depois da redução, que altera `pontos` e `intervalos`.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @return 1 se os vetores foram criados, ou 0 em caso de falha de alocação.
+ */
+int separar_coordenadas(Problema *problema)
+{
+    int resultado = 0;
+
+    problema->posicoes = (int *)arena_alocar(&problema->arena, problema->n_pontos * sizeof(int));
+    problema->inicios = (int *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(int));
+    problema->fins = (int *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(int));
+    if (problema->posicoes != NULL && problema->inicios != NULL && problema->fins != NULL)
+    {
+        for (int j = 0; j < problema->n_pontos; j++)
+        {
+            problema->posicoes[j] = problema->pontos[j].posicao;
+        }
+        for (int i = 0; i < problema->n_intervalos; i++)
+        {
+            problema->inicios[i] = problema->intervalos[i].inicio;
+            problema->fins[i] = problema->intervalos[i].fim;
+        }
+        resultado = 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Calcula a faixa de pontos coberta por cada intervalo.
+ *
+ * O guloso clássico escolhe sempre o primeiro ponto descoberto na
+ * ordem da instância, então os pontos não são reordenados: cada um
+ * recebe um posto, seu índice na ordem por posição. Nessa ordem, os
+ * pontos cobertos por um intervalo formam a faixa contígua de postos
+ * `[faixa_inicio[i], faixa_fim[i])`, obtida por duas buscas binárias.
+ *
+ * Lê as coordenadas de `posicoes`, `inicios` e `fins`, e por isso deve
+ * ser chamada depois de `separar_coordenadas`.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @return 1 se as faixas foram calculadas, ou 0 em caso de falha de alocação.
+ */
+int calcular_faixas(Problema *problema)
+{
+    int resultado = 0;
+    int n_pontos = problema->n_pontos;
+    size_t marcador;
+    Ponto *ordenados;
+    int *posicoes_ordenadas;
+
+    problema->posto = (int *)arena_alocar(&problema->arena, n_pontos * sizeof(int));
+    problema->faixa_inicio = (int *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(int));
+    problema->faixa_fim = (int *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(int));
+
+    /**
+     * As cópias ordenadas só são usadas aqui: o campo `id` guarda o
+     * índice original de cada ponto, `posicoes_ordenadas` recebe as
+     * posições em vetor contíguo para as buscas, e a arena é restaurada
+     * ao final.
+     */
+    marcador = arena_marcador(&problema->arena);
+    ordenados = (Ponto *)arena_alocar(&problema->arena, n_pontos * sizeof(Ponto));
+    posicoes_ordenadas = (int *)arena_alocar(&problema->arena, n_pontos * sizeof(int));
+
+    if (problema->posto != NULL && problema->faixa_inicio != NULL && problema->faixa_fim != NULL &&
+        ordenados != NULL && posicoes_ordenadas != NULL)
+    {
+        for (int j = 0; j < n_pontos; j++)
+        {
+            ordenados[j].id = j;
+            ordenados[j].posicao = problema->posicoes[j];
+        }
+        qsort(ordenados, n_pontos, sizeof(Ponto), comparar_pontos);
+
+        for (int k = 0; k < n_pontos; k++)
+        {
+            problema->posto[ordenados[k].id] = k;
+            posicoes_ordenadas[k] = ordenados[k].posicao;
+        }
+
+        for (int i = 0; i < problema->n_intervalos; i++)
+        {
+            int fim = problema->fins[i];
+
+            problema->faixa_inicio[i] = primeira_posicao_a_partir(posicoes_ordenadas, n_pontos, problema->inicios[i]);
+            problema->faixa_fim[i] = fim == INT_MAX ? n_pontos : primeira_posicao_a_partir(posicoes_ordenadas, n_pontos, fim + 1);
+            if (problema->faixa_fim[i] < problema->faixa_inicio[i])
+            {
+                problema->faixa_fim[i] = problema->faixa_inicio[i];
+            }
+        }
+        resultado = 1;
+    }
+
+    arena_restaurar(&problema->arena, marcador);
+
+    return resultado;
+}
+
+/**
+ * @brief Constrói os índices usados pelo guloso clássico sobre as faixas.
+ *
+ * - `arvore_descobertos`: árvore de Fenwick sobre os postos, que conta
+ *   os pontos descobertos de qualquer faixa em O(log n);
+ * - `proximo_descoberto`: floresta de conjuntos disjuntos em que cada
+ *   posto coberto aponta para o seguinte, para que marcar uma faixa
+ *   visite só os pontos ainda descobertos;
+ * - `intervalos_por_faixa` e `arvore_alcance`: os intervalos ordenados
+ *   por `faixa_inicio` e uma árvore de segmentos com o maior
+ *   `faixa_fim` de cada bloco, para listar só os intervalos que cobrem
+ *   um posto;
+ * - `ganho_estimado` e `candidatos`: os limites superiores dos ganhos e
+ *   a fila de prioridade de `encontrar_melhor_intervalo`.
+ *
+ * Deve ser chamada depois de `calcular_faixas`.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @return 1 se os índices foram construídos, ou 0 em caso de falha de alocação.
+ */
+int construir_indices_cobertura(Problema *problema)
+{
+    int resultado = 0;
+    int n_pontos = problema->n_pontos;
+    int n_intervalos = problema->n_intervalos;
+    int folhas = 1;
+    size_t marcador;
+    int *contagem;
+
+    while (folhas < n_intervalos)
+    {
+        folhas *= 2;
+    }
+    problema->folhas_alcance = folhas;
+
+    problema->arvore_descobertos = (int *)arena_alocar(&problema->arena, ((size_t)n_pontos + 1) * sizeof(int));
+    problema->proximo_descoberto = (int *)arena_alocar(&problema->arena, ((size_t)n_pontos + 1) * sizeof(int));
+    problema->intervalos_por_faixa = (int *)arena_alocar(&problema->arena, n_intervalos * sizeof(int));
+    problema->arvore_alcance = (int *)arena_alocar(&problema->arena, 2 * (size_t)folhas * sizeof(int));
+    problema->ganho_estimado = (int *)arena_alocar(&problema->arena, n_intervalos * sizeof(int));
+    problema->candidatos = (CandidatoGanho *)arena_alocar(&problema->arena, n_intervalos * sizeof(CandidatoGanho));
+
+    /**
+     * A ordenação por `faixa_inicio` é por contagem, já que os valores
+     * estão em [0, n_pontos]; o vetor de contagem é temporário.
+     */
+    marcador = arena_marcador(&problema->arena);
+    contagem = (int *)arena_alocar(&problema->arena, ((size_t)n_pontos + 2) * sizeof(int));
+
+    if (problema->arvore_descobertos != NULL && problema->proximo_descoberto != NULL &&
+        problema->intervalos_por_faixa != NULL && problema->arvore_alcance != NULL &&
+        problema->ganho_estimado != NULL && problema->candidatos != NULL && contagem != NULL)
+    {
+        /* Todos os pontos começam descobertos: cada nó soma o tamanho do seu bloco. */
+        problema->arvore_descobertos[0] = 0;
+        for (int k = 1; k <= n_pontos; k++)
+        {
+            problema->arvore_descobertos[k] = k & -k;
+        }
+        for (int k = 0; k <= n_pontos; k++)
+        {
+            problema->proximo_descoberto[k] = k;
+        }
+        problema->proximo_ponto = 0;
+
+        memset(contagem, 0, ((size_t)n_pontos + 2) * sizeof(int));
+        for (int i = 0; i < n_intervalos; i++)
+        {
+            contagem[problema->faixa_inicio[i] + 1]++;
+        }
+        for (int k = 1; k <= n_pontos + 1; k++)
+        {
+            contagem[k] += contagem[k - 1];
+        }
+        for (int i = 0; i < n_intervalos; i++)
+        {
+            problema->intervalos_por_faixa[contagem[problema->faixa_inicio[i]]++] = i;
+            problema->ganho_estimado[i] = problema->faixa_fim[i] - problema->faixa_inicio[i];
+        }
+
+        for (int j = 0; j < folhas; j++)
+        {
+            problema->arvore_alcance[folhas + j] = j < n_intervalos ? problema->faixa_fim[problema->intervalos_por_faixa[j]] : -1;
+        }
+        for (int no = folhas - 1; no >= 1; no--)
+        {
+            int esquerda = problema->arvore_alcance[2 * no];
+            int direita = problema->arvore_alcance[2 * no + 1];
+
+            problema->arvore_alcance[no] = esquerda > direita ? esquerda : direita;
+        }
+        resultado = 1;
+    }
+
+    arena_restaurar(&problema->arena, marcador);
+
+    return resultado;
+}
+
+/**
+ * @brief Conta os pontos descobertos com posto menor que `posto`.
+ *
+ * @param arvore Árvore de Fenwick dos pontos descobertos.
+ * @param posto Quantidade de postos considerados, a partir do primeiro.
+ * @return Quantidade de pontos descobertos entre os postos `[0, posto)`.
+ */
+int contar_descobertos_ate(const int *arvore, int posto)
+{
+    int resultado = 0;
+
+    for (int k = posto; k > 0; k -= k & -k)
+    {
+        resultado += arvore[k];
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Conta os pontos ainda descobertos na faixa de um intervalo.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @param indice_intervalo Índice do intervalo.
+ * @return Quantidade de pontos descobertos que o intervalo cobriria.
+ */
+int contar_descobertos_faixa(Problema *problema, int indice_intervalo)
+{
+    return contar_descobertos_ate(problema->arvore_descobertos, problema->faixa_fim[indice_intervalo]) -
+           contar_descobertos_ate(problema->arvore_descobertos, problema->faixa_inicio[indice_intervalo]);
+}
+
+/**
+ * @brief Encontra o primeiro posto descoberto a partir de `posto`.
+ *
+ * Segue `proximo_descoberto` comprimindo o caminho pela metade, de modo
+ * que consultas sucessivas custam tempo quase constante.
+ *
+ * @param proximo Vetor de conjuntos disjuntos dos postos (`proximo_descoberto`).
+ * @param posto Posto de partida.
+ * @return Primeiro posto descoberto maior ou igual a `posto`, ou `n_pontos` se não houver.
+ */
+int encontrar_descoberto(int *proximo, int posto)
+{
+    while (proximo[posto] != posto)
+    {
+        proximo[posto] = proximo[proximo[posto]];
+        posto = proximo[posto];
+    }
+    return posto;
+}
+
+/**
+ * @brief Liga na máscara os bits dos pontos que pertencem a um intervalo, ponto a ponto.
+ *
+ * Caminho portável de `preencher_mascara`, sem desvios, que o
+ * compilador vetoriza quando a CPU alvo é conhecida na compilação.
+ * Trata os pontos a partir de `primeiro`, para completar também o
+ * resto deixado por `preencher_mascara_avx2`.
+ *
+ * @param mascara Bitset do intervalo, com os bits a partir de `primeiro` desligados.
+ * @param posicoes Posições dos pontos.
+ * @param primeiro Primeiro ponto tratado.
+ * @param n_pontos Quantidade de pontos.
+ * @param inicio Início do intervalo.
+ * @param fim Fim do intervalo.
+ */
+void preencher_mascara_escalar(uint64_t *mascara, const int *posicoes, int primeiro, int n_pontos, int inicio, int fim)
+{
+    for (int j = primeiro; j < n_pontos; j++)
+    {
+        mascara[j / 64] |= (uint64_t)ponto_coberto_por_intervalo(posicoes[j], inicio, fim) << (j % 64);
+    }
+}
+
+#ifdef DESPACHO_AVX2
+/**
+ * @brief Liga na máscara os bits dos pontos de um intervalo, 8 posições por vez, com AVX2.
+ *
+ * Cada passo compara um vetor de 8 posições com os dois extremos do
+ * intervalo (comparações com sinal) e extrai os 8 bits do resultado
+ * com `_mm256_movemask_ps`; oito passos formam uma palavra da máscara.
+ * O restante, menos de 64 pontos, segue pelo caminho escalar.
+ *
+ * @param mascara Bitset do intervalo, zerado.
+ * @param posicoes Posições dos pontos.
+ * @param n_pontos Quantidade de pontos.
+ * @param inicio Início do intervalo.
+ * @param fim Fim do intervalo.
+ */
+__attribute__((target("avx2")))
+void preencher_mascara_avx2(uint64_t *mascara, const int *posicoes, int n_pontos, int inicio, int fim)
+{
+    const __m256i limite_inicio = _mm256_set1_epi32(inicio);
+    const __m256i limite_fim = _mm256_set1_epi32(fim);
+    int j = 0;
+
+    for (; j + 64 <= n_pontos; j += 64)
+    {
+        uint64_t palavra = 0;
+
+        for (int k = 0; k < 64; k += 8)
+        {
+            __m256i posicao = _mm256_loadu_si256((const __m256i *)(posicoes + j + k));
+            __m256i fora = _mm256_or_si256(_mm256_cmpgt_epi32(limite_inicio, posicao), _mm256_cmpgt_epi32(posicao, limite_fim));
+
+            palavra |= (uint64_t)(~_mm256_movemask_ps(_mm256_castsi256_ps(fora)) & 0xff) << k;
+        }
+        mascara[j / 64] = palavra;
+    }
+
+    preencher_mascara_escalar(mascara, posicoes, j, n_pontos, inicio, fim);
+}
+
+/**
+ * @brief Conta os pontos de uma máscara ainda não cobertos, 256 por vez, com AVX2.
+ *
+ * Calcula `popcount(mascara AND NOT cobertura)` sobre quatro palavras
+ * por iteração, com a contagem por tabela de nibbles de
+ * `_mm256_shuffle_epi8` somada em acumuladores de 64 bits por
+ * `_mm256_sad_epu8`. O restante segue por `bitset_contar_novos`.
+ *
+ * @param mascara Bitset dos pontos cobertos por um intervalo.
+ * @param cobertura Bitset dos pontos já cobertos.
+ * @param n_palavras Quantidade de palavras dos bitsets.
+ * @return Quantidade de pontos novos cobertos pela máscara.
+ */
+__attribute__((target("avx2")))
+int contar_pontos_novos_avx2(const uint64_t *mascara, const uint64_t *cobertura, int n_palavras)
+{
+    const __m256i tabela = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    __m256i acumulador = _mm256_setzero_si256();
+    int i = 0;
+
+    for (; i + 4 <= n_palavras; i += 4)
+    {
+        __m256i novos = _mm256_andnot_si256(_mm256_loadu_si256((const __m256i *)(cobertura + i)),
+                                            _mm256_loadu_si256((const __m256i *)(mascara + i)));
+        __m256i baixo = _mm256_and_si256(novos, nibble);
+        __m256i alto = _mm256_and_si256(_mm256_srli_epi16(novos, 4), nibble);
+        __m256i contagem = _mm256_add_epi8(_mm256_shuffle_epi8(tabela, baixo), _mm256_shuffle_epi8(tabela, alto));
+
+        acumulador = _mm256_add_epi64(acumulador, _mm256_sad_epu8(contagem, _mm256_setzero_si256()));
+    }
+
+    return (int)(_mm256_extract_epi64(acumulador, 0) + _mm256_extract_epi64(acumulador, 1) +
+                 _mm256_extract_epi64(acumulador, 2) + _mm256_extract_epi64(acumulador, 3)) +
+           bitset_contar_novos(mascara + i, cobertura + i, n_palavras - i);
+}
+#endif
+
+/**
+ * @brief Liga na máscara os bits dos pontos que pertencem a um intervalo.
+ *
+ * Roda uma vez por intervalo, sobre todos os pontos, ao construir as
+ * máscaras do guloso clássico em bitset. Usa `preencher_mascara_avx2`
+ * quando a CPU oferece AVX2, verificado em tempo de execução, e
+ * `preencher_mascara_escalar` nos demais casos.
+ *
+ * @param mascara Bitset do intervalo, zerado.
+ * @param posicoes Posições dos pontos.
+ * @param n_pontos Quantidade de pontos.
+ * @param inicio Início do intervalo.
+ * @param fim Fim do intervalo.
+ */
+void preencher_mascara(uint64_t *mascara, const int *posicoes, int n_pontos, int inicio, int fim)
+{
+#ifdef DESPACHO_AVX2
+    if (__builtin_cpu_supports("avx2"))
+    {
+        preencher_mascara_avx2(mascara, posicoes, n_pontos, inicio, fim);
+    }
+    else
+#endif
+    {
+        preencher_mascara_escalar(mascara, posicoes, 0, n_pontos, inicio, fim);
+    }
+}
+
+/**
+ * @brief Conta os pontos que um intervalo candidato cobriria pela primeira vez.
+ *
+ * É o laço mais executado do guloso clássico em bitset: roda uma vez
+ * para cada intervalo que cobre o ponto atual. Quando o programa não
+ * foi compilado com AVX2 (caso em que `bitset_contar_novos` já usa os
+ * caminhos vetoriais), usa `contar_pontos_novos_avx2` se a CPU oferecer
+ * AVX2, verificado em tempo de execução, e `bitset_contar_novos` nos
+ * demais casos.
+ *
+ * @param mascara Bitset dos pontos cobertos pelo intervalo.
+ * @param cobertura Bitset dos pontos já cobertos.
+ * @param n_palavras Quantidade de palavras dos bitsets.
+ * @return Quantidade de pontos novos cobertos pela máscara.
+ */
+int contar_pontos_novos(const uint64_t *mascara, const uint64_t *cobertura, int n_palavras)
+{
+    int total = 0;
+
+#if defined(DESPACHO_AVX2) && !defined(__AVX2__)
+    if (__builtin_cpu_supports("avx2"))
+    {
+        total = contar_pontos_novos_avx2(mascara, cobertura, n_palavras);
+    }
+    else
+#endif
+    {
+        total = bitset_contar_novos(mascara, cobertura, n_palavras);
+    }
+
+    return total;
+}
+
+/**
+ * @brief Pré-calcula o bitset de pontos cobertos por cada intervalo.
+ *
+ * Para cada intervalo `i`, o bit `j` da máscara `mascaras[i]` é ligado
+ * quando o ponto `j` pertence ao intervalo. Com as máscaras prontas,
+ * contar pontos novos e marcar pontos cobertos passam a ser operações
+ * palavra a palavra sobre bitsets.
+ *
+ * Lê as posições de `posicoes`, preenchido por `separar_coordenadas`,
+ * com o núcleo de `preencher_mascara`.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @return 1 se as máscaras foram construídas, ou 0 em caso de falha de alocação.
+ */
+int construir_mascaras(Problema *problema)
+{
+    int resultado = 0;
+
+    problema->n_palavras = calcular_palavras_bitset(problema->n_pontos);
+    problema->mascaras = (uint64_t *)arena_alocar(&problema->arena, (size_t)problema->n_intervalos * problema->n_palavras * sizeof(uint64_t));
+    if (problema->mascaras != NULL)
+    {
+        memset(problema->mascaras, 0, (size_t)problema->n_intervalos * problema->n_palavras * sizeof(uint64_t));
+        for (int i = 0; i < problema->n_intervalos; i++)
+        {
+            preencher_mascara(problema->mascaras + (size_t)i * problema->n_palavras, problema->posicoes, problema->n_pontos,
+                              problema->inicios[i], problema->fins[i]);
+        }
+        resultado = 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Indica se um ponto já está coberto, em qualquer representação.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @param indice_ponto Índice do ponto consultado.
+ * @return 1 se o ponto estiver coberto, 0 caso contrário.
+ */
+int ponto_esta_coberto(Problema *problema, int indice_ponto)
+{
+    int resultado = 0;
+    if (problema->configuracao.usar_bitset)
+    {
+        resultado = (int)((problema->pontos_cobertos_bits[indice_ponto / 64] >> (indice_ponto % 64)) & 1);
+    }
+    else if (problema->posto != NULL)
+    {
+        resultado = problema->pontos_cobertos[problema->posto[indice_ponto]] != 0;
+    }
+    else
+    {
+        resultado = problema->pontos_cobertos[indice_ponto] != 0;
+    }
+    return resultado;
+}
+
+/**
+ * @brief Marca os pontos cobertos por um determinado intervalo.
+ *
+ * Atualiza o vetor de controle de cobertura, marcando como cobertos
+ * todos os pontos ainda não cobertos que pertencem ao intervalo
+ * selecionado. Dentro da faixa de postos do intervalo, só os pontos
+ * ainda descobertos são visitados, saltando os cobertos por
+ * `proximo_descoberto`; cada um é descontado da árvore de Fenwick.
+ *
+ * Também atualiza o contador total de pontos cobertos.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @param indice_intervalo Índice do intervalo selecionado pelo algoritmo guloso.
+ */
+void marcar_pontos_cobertos(Problema *problema, int indice_intervalo)
+{
+    int n_pontos = problema->n_pontos;
+    int fim = problema->faixa_fim[indice_intervalo];
+    int posto = encontrar_descoberto(problema->proximo_descoberto, problema->faixa_inicio[indice_intervalo]);
+
+    while (posto < fim)
+    {
+        problema->pontos_cobertos[posto] = 1;
+        problema->n_pontos_cobertos++;
+        for (int k = posto + 1; k <= n_pontos; k += k & -k)
+        {
+            problema->arvore_descobertos[k]--;
+        }
+        problema->proximo_descoberto[posto] = posto + 1;
+        posto = encontrar_descoberto(problema->proximo_descoberto, posto + 1);
+    }
+}
+
+/**
+ * @brief Verifica se todos os pontos do problema já foram cobertos.
+ *
+ * Compara o número de pontos cobertos com o total de pontos existentes.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @return 1 se todos os pontos estiverem cobertos, 0 caso contrário.
+ */
+int todos_pontos_cobertos(Problema *problema)
+{
+    int resultado = 0;
+    if (problema->n_pontos_cobertos == problema->n_pontos)
+    {
+        resultado = 1;
+    }
+    else
+    {
+        resultado = 0;
+    }
+    return resultado;
+}
+
+/**
+ * @brief Obtém o índice do próximo ponto ainda não coberto.
+ *
+ * Percorre o vetor de pontos cobertos e retorna o índice do primeiro
+ * ponto que ainda não foi coberto por nenhum intervalo selecionado.
+ * Como um ponto coberto não volta a ficar descoberto, a busca começa
+ * em `proximo_ponto`, onde a anterior parou.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @return Índice do ponto não coberto ou -1 se todos estiverem cobertos.
+ */
+int obter_proximo_ponto_nao_coberto(Problema *problema)
+{
+    int resultado = -1;
+    int i = problema->proximo_ponto;
+
+    while (i < problema->n_pontos && problema->pontos_cobertos[problema->posto[i]] != 0)
+    {
+        i++;
+    }
+    problema->proximo_ponto = i;
+    if (i < problema->n_pontos)
+    {
+        resultado = i;
+    }
+    return resultado;
+}
+
+/**
+ * @brief Indica se um candidato deve sair da fila antes de outro.
+ *
+ * A ordem é a do guloso: maior ganho, depois menor tamanho e, por
+ * último, menor índice, o mesmo intervalo que uma busca linear pelos
+ * índices escolheria.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @param a Primeiro candidato.
+ * @param b Segundo candidato.
+ * @return 1 se `a` precede `b`, 0 caso contrário.
+ */
+int candidato_precede(const Problema *problema, const CandidatoGanho *a, const CandidatoGanho *b)
+{
+    int resultado = 0;
+
+    if (a->ganho != b->ganho)
+    {
+        resultado = a->ganho > b->ganho;
+    }
+    else
+    {
+        int tamanho_a = problema->fins[a->intervalo] - problema->inicios[a->intervalo];
+        int tamanho_b = problema->fins[b->intervalo] - problema->inicios[b->intervalo];
+
+        if (tamanho_a != tamanho_b)
+        {
+            resultado = tamanho_a < tamanho_b;
+        }
+        else
+        {
+            resultado = a->intervalo < b->intervalo;
+        }
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Desce um candidato no heap de máximo até restaurar a ordem.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @param heap Vetor do heap.
+ * @param n_candidatos Quantidade de candidatos no heap.
+ * @param indice Posição do candidato a descer.
+ */
+void descer_candidato(const Problema *problema, CandidatoGanho *heap, int n_candidatos, int indice)
+{
+    CandidatoGanho candidato = heap[indice];
+    int filho = 2 * indice + 1;
+
+    while (filho < n_candidatos)
+    {
+        if (filho + 1 < n_candidatos && candidato_precede(problema, &heap[filho + 1], &heap[filho]))
+        {
+            filho++;
+        }
+        if (candidato_precede(problema, &candidato, &heap[filho]))
+        {
+            break;
+        }
+        heap[indice] = heap[filho];
+        indice = filho;
+        filho = 2 * indice + 1;
+    }
+    heap[indice] = candidato;
+}
+
+/**
+ * @brief Lista os intervalos de um bloco da árvore de alcance que cobrem um posto.
+ *
+ * Desce apenas pelos nós cujo maior `faixa_fim` passa do posto e que
+ * começam antes de `limite`, de modo que o custo é proporcional à
+ * quantidade de intervalos listados, vezes a altura da árvore.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @param no Nó atual de `arvore_alcance` (a raiz é 1).
+ * @param inicio Primeira posição de `intervalos_por_faixa` coberta pelo nó.
+ * @param largura Quantidade de posições cobertas pelo nó.
+ * @param limite Posições a partir desta têm `faixa_inicio` maior que o posto.
+ * @param posto Posto do ponto atual.
+ * @param n_candidatos Quantidade de candidatos já listados, atualizada.
+ */
+void listar_candidatos(Problema *problema, int no, int inicio, int largura, int limite, int posto, int *n_candidatos)
+{
+    if (inicio < limite && problema->arvore_alcance[no] > posto)
+    {
+        if (largura == 1)
+        {
+            int intervalo = problema->intervalos_por_faixa[inicio];
+
+            problema->candidatos[*n_candidatos].intervalo = intervalo;
+            problema->candidatos[*n_candidatos].ganho = problema->ganho_estimado[intervalo];
+            problema->candidatos[*n_candidatos].exato = 0;
+            (*n_candidatos)++;
+        }
+        else
+        {
+            listar_candidatos(problema, 2 * no, inicio, largura / 2, limite, posto, n_candidatos);
+            listar_candidatos(problema, 2 * no + 1, inicio + largura / 2, largura / 2, limite, posto, n_candidatos);
+        }
+    }
+}
+
+/**
+ * @brief Seleciona o melhor intervalo segundo a estratégia gulosa.
+ *
+ * A função avalia todos os intervalos que cobrem o ponto atualmente
+ * não coberto e seleciona aquele que cobre o maior número de pontos
+ * ainda descobertos.
+ *
+ * Em caso de empate, o intervalo de menor tamanho é escolhido como
+ * critério de desempate.
+ *
+ * Os intervalos que cobrem o ponto, os que têm o posto dele na sua
+ * faixa, são listados pela árvore de alcance e postos em um heap pelo
+ * último ganho calculado. Como os ganhos só diminuem, esse valor é um
+ * limite superior: o ganho exato, lido da árvore de Fenwick, só é
+ * recalculado para o candidato do topo, até que o topo seja exato.
+ *
+ * Essa estratégia busca maximizar o ganho local a cada escolha,
+ * característica fundamental do algoritmo guloso.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @param indice_ponto Índice do ponto atualmente não coberto.
+ * @return Índice do melhor intervalo ou -1 se nenhum for adequado.
+ */
+int encontrar_melhor_intervalo(Problema *problema, int indice_ponto)
+{
+    int melhor_intervalo = -1;
+    int posto_atual = problema->posto[indice_ponto];
+    CandidatoGanho *heap = problema->candidatos;
+    int n_candidatos = 0;
+    int limite = 0;
+    int fim = problema->n_intervalos;
+
+    /* Busca binária: os intervalos em [0, limite) começam até o posto atual. */
+    while (limite < fim)
+    {
+        int meio = limite + (fim - limite) / 2;
+
+        if (problema->faixa_inicio[problema->intervalos_por_faixa[meio]] <= posto_atual)
+        {
+            limite = meio + 1;
+        }
+        else
+        {
+            fim = meio;
+        }
+    }
+
+    listar_candidatos(problema, 1, 0, problema->folhas_alcance, limite, posto_atual, &n_candidatos);
+    for (int i = n_candidatos / 2 - 1; i >= 0; i--)
+    {
+        descer_candidato(problema, heap, n_candidatos, i);
+    }
+
+    while (n_candidatos > 0 && melhor_intervalo == -1)
+    {
+        if (heap[0].exato)
+        {
+            melhor_intervalo = heap[0].intervalo;
+        }
+        else
+        {
+            heap[0].ganho = contar_descobertos_faixa(problema, heap[0].intervalo);
+            heap[0].exato = 1;
+            problema->ganho_estimado[heap[0].intervalo] = heap[0].ganho;
+            descer_candidato(problema, heap, n_candidatos, 0);
+        }
+    }
+
+    return melhor_intervalo;
+}
+
+/**
+ * @brief Marca os pontos cobertos por um intervalo na representação em bitset.
+ *
+ * Equivalente a `marcar_pontos_cobertos`, mas a quantidade de pontos
+ * novos é obtida por `popcount(mascara AND NOT cobertura)` e a marcação
+ * é uma união palavra a palavra da máscara do intervalo com o bitset
+ * de pontos cobertos.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @param indice_intervalo Índice do intervalo selecionado pelo algoritmo guloso.
+ */
+void marcar_pontos_cobertos_bitset(Problema *problema, int indice_intervalo)
+{
+    const uint64_t *mascara = problema->mascaras + (size_t)indice_intervalo * problema->n_palavras;
+
+    problema->n_pontos_cobertos = bitset_uniao_contar(problema->pontos_cobertos_bits, problema->pontos_cobertos_bits,
+                                                      mascara, problema->n_palavras);
+}
+
+/**
+ * @brief Obtém o índice do próximo ponto não coberto na representação em bitset.
+ *
+ * Procura a primeira palavra com algum bit desligado e localiza o bit
+ * com `__builtin_ctzll`, em vez de testar ponto a ponto.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @return Índice do ponto não coberto ou -1 se todos estiverem cobertos.
+ */
+int obter_proximo_ponto_nao_coberto_bitset(Problema *problema)
+{
+    int resultado = -1;
+    for (int i = 0; i < problema->n_palavras; i++)
+    {
+        uint64_t livres = ~problema->pontos_cobertos_bits[i];
+        if (livres != 0)
+        {
+            int indice = i * 64 + __builtin_ctzll(livres);
+            if (indice < problema->n_pontos)
+            {
+                resultado = indice;
+            }
+            break;
+        }
+    }
+    return resultado;
+}
+
+/**
+ * @brief Seleciona o melhor intervalo segundo a estratégia gulosa, usando bitsets.
+ *
+ * Aplica o mesmo critério de `encontrar_melhor_intervalo` (maior número
+ * de pontos novos, com desempate pelo menor tamanho), mas o teste de
+ * pertinência do ponto atual é a leitura de um bit da máscara e a
+ * contagem de pontos novos é um popcount sobre palavras de 64 bits
+ * (`contar_pontos_novos`).
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @param indice_ponto Índice do ponto atualmente não coberto.
+ * @return Índice do melhor intervalo ou -1 se nenhum for adequado.
+ */
+int encontrar_melhor_intervalo_bitset(Problema *problema, int indice_ponto)
+{
+    int melhor_intervalo = -1;
+    int max_pontos_cobertos = 0;
+    int palavra_ponto = indice_ponto / 64;
+    uint64_t bit_ponto = UINT64_C(1) << (indice_ponto % 64);
+
+    for (int i = 0; i < problema->n_intervalos; i++)
+    {
+        const uint64_t *mascara = problema->mascaras + (size_t)i * problema->n_palavras;
+
+        if (mascara[palavra_ponto] & bit_ponto)
+        {
+            int pontos_cobertos_potencial = contar_pontos_novos(mascara, problema->pontos_cobertos_bits, problema->n_palavras);
+
+            if (pontos_cobertos_potencial > max_pontos_cobertos)
+            {
+                max_pontos_cobertos = pontos_cobertos_potencial;
+                melhor_intervalo = i;
+            }
+            else if (pontos_cobertos_potencial == max_pontos_cobertos && pontos_cobertos_potencial > 0)
+            {
+                if (melhor_intervalo == -1)
+                {
+                    melhor_intervalo = i;
+                }
+                else
+                {
+                    int tamanho_melhor = problema->fins[melhor_intervalo] - problema->inicios[melhor_intervalo];
+                    int tamanho_atual = problema->fins[i] - problema->inicios[i];
+
+                    if (tamanho_atual < tamanho_melhor)
+                    {
+                        melhor_intervalo = i;
+                    }
+                }
+            }
+        }
+    }
+
+    return melhor_intervalo;
+}
+
+/**
+ * @brief Aloca as estruturas de cobertura usadas pelo algoritmo guloso.
+ *
+ * Conforme `configuracao.usar_bitset`, aloca o vetor de inteiros
+ * `pontos_cobertos` ou o bitset `pontos_cobertos_bits` (e, no motor
+ * clássico, as máscaras dos intervalos), além do vetor da solução.
+ * O motor clássico recebe antes os vetores contíguos de coordenadas
+ * (`separar_coordenadas`) e o de varredura, uma cópia dos intervalos,
+ * que será ordenada por início.
+ *
+ * Tudo é alocado na arena do problema, a partir de `marcador_instancia`,
+ * de modo que resolver a mesma instância outra vez reaproveita a memória.
+ *
+ * Em caso de falha (arena sem espaço), os vetores já alocados
+ * permanecem na arena e são liberados por `liberar_problema`.
+ *
+ * @param problema Ponteiro para a estrutura do problema.
+ * @return 1 se todas as estruturas foram alocadas, ou 0 caso contrário.
+ */
+int alocar_estruturas_guloso(Problema *problema)
+{
+    int resultado = 0;
+    int coordenadas_prontas = 1;
+
+    /**
+     * Devolve à arena as estruturas de uma resolução anterior, mantendo
+     * apenas os pontos e intervalos da instância.
+     */
+    arena_restaurar(&problema->arena, problema->marcador_instancia);
+    problema->pontos_cobertos = NULL;
+    problema->mascaras = NULL;
+    problema->pontos_cobertos_bits = NULL;
+    problema->intervalos_por_inicio = NULL;
+    problema->posicoes = NULL;
+    problema->inicios = NULL;
+    problema->fins = NULL;
+    problema->posto = NULL;
+    problema->faixa_inicio = NULL;
+    problema->faixa_fim = NULL;
+    problema->arvore_descobertos = NULL;
+    problema->proximo_descoberto = NULL;
+    problema->proximo_ponto = 0;
+    problema->intervalos_por_faixa = NULL;
+    problema->folhas_alcance = 0;
+    problema->arvore_alcance = NULL;
+    problema->ganho_estimado = NULL;
+    problema->candidatos = NULL;
+
+    if (problema->configuracao.motor == MOTOR_GULOSO_CLASSICO)
+    {
+        coordenadas_prontas = separar_coordenadas(problema);
+    }
+
+    if (coordenadas_prontas && problema->configuracao.usar_bitset)
+    {
+        if (problema->configuracao.motor == MOTOR_GULOSO_CLASSICO)
+        {
+            if (construir_mascaras(problema))
+            {
+                problema->pontos_cobertos_bits = (uint64_t *)arena_alocar(&problema->arena, problema->n_palavras * sizeof(uint64_t));
+            }
+        }
+        else
+        {
+            problema->n_palavras = calcular_palavras_bitset(problema->n_pontos);
+            problema->pontos_cobertos_bits = (uint64_t *)arena_alocar(&problema->arena, problema->n_palavras * sizeof(uint64_t));
+        }
+        if (problema->pontos_cobertos_bits != NULL)
+        {
+            memset(problema->pontos_cobertos_bits, 0, problema->n_palavras * sizeof(uint64_t));
+            resultado = 1;
+        }
+    }
+    else if (coordenadas_prontas)
+    {
+        problema->pontos_cobertos = (int *)arena_alocar(&problema->arena, problema->n_pontos * sizeof(int));
+        if (problema->pontos_cobertos != NULL)
+        {
+            memset(problema->pontos_cobertos, 0, problema->n_pontos * sizeof(int));
+            resultado = 1;
+        }
+    }
+
+    if (resultado == 1)
+    {
+        problema->solucao = (Intervalo *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(Intervalo));
+        if (problema->solucao == NULL)
+        {
+            resultado = 0;
+        }
+    }
+
+    if (resultado == 1 && problema->configuracao.motor == MOTOR_GULOSO_CLASSICO && problema->configuracao.usar_bitset == 0)
+    {
+        resultado = calcular_faixas(problema) && construir_indices_cobertura(problema);
+    }
+
+    if (resultado == 1 && problema->configuracao.motor == MOTOR_GULOSO_VARREDURA)
+    {
+        problema->intervalos_por_inicio = (Intervalo *)arena_alocar(&problema->arena, problema->n_intervalos * sizeof(Intervalo));
+        if (problema->intervalos_por_inicio == NULL)
+        {
+            resultado = 0;
+        }
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Executa o laço principal do algoritmo guloso clássico.
+ *
+ * Enquanto houver pontos descobertos, seleciona o primeiro ponto ainda
+ * não coberto, escolhe o intervalo que o cobre e cobre o maior número
+ * de pontos novos (com desempate pelo menor tamanho) e marca os pontos
+ * cobertos por ele.
+ *
+ * As estruturas de cobertura devem ter sido alocadas previamente por
+ * `alocar_estruturas_guloso`.
+ *
+ * @param problema Ponteiro para a estrutura do problema
+ */
+void executar_guloso_classico(Problema *problema)
+{
+    int indice_ponto;
+    int indice_intervalo;
+
+    while (todos_pontos_cobertos(problema) == 0)
+    {
+        if (problema->configuracao.usar_bitset)
+        {
+            indice_ponto = obter_proximo_ponto_nao_coberto_bitset(problema);
+        }
+        else
+        {
+            indice_ponto = obter_proximo_ponto_nao_coberto(problema);
+        }
+
+        if (indice_ponto == -1)
+        {
+            break;
+        }
+
+        if (problema->configuracao.usar_bitset)
+        {
+            indice_intervalo = encontrar_melhor_intervalo_bitset(problema, indice_ponto);
+        }
+        else
+        {
+            indice_intervalo = encontrar_melhor_intervalo(problema, indice_ponto);
+        }
+
+        if (indice_intervalo == -1)
+        {
+            break;
+        }
+
+        problema->solucao[problema->n_solucao] = problema->intervalos[indice_intervalo];
+        problema->n_solucao++;
+
+        if (problema->configuracao.usar_bitset)
+        {
+            marcar_pontos_cobertos_bitset(problema, indice_intervalo);
+        }
+        else
+        {
+            marcar_pontos_cobertos(problema, indice_intervalo);
+        }
+    }
+}
+
+/**
+ * @brief Executa o algoritmo guloso por varredura da reta.
+ *
+ * Os pontos são ordenados por posição (`comparar_pontos`) e uma cópia
+ * dos intervalos é ordenada por início (`comparar_intervalos_por_inicio`).
+ * Em seguida, uma única varredura da esquerda para a direita:
+ * - avança sobre os intervalos que começam até o ponto não coberto mais
+ *   à esquerda, mantendo o que alcança mais longe à direita;
+ * - escolhe esse intervalo e marca todos os pontos até o seu fim;
+ * - repete a partir do primeiro ponto além do fim escolhido.
+ *
+ * Cada ponto e cada intervalo são visitados uma única vez, de modo que
+ * o custo total é dominado pelas ordenações: O((n + m) log(n + m)).
+ *
+ * Para cobertura de pontos na reta essa escolha é ótima: qualquer
+ * solução precisa de um intervalo que cubra o ponto mais à esquerda, e
+ * trocá-lo pelo que alcança mais longe nunca descobre outro ponto.
+ * Por isso o resultado tem o mesmo tamanho da solução do backtracking.
+ *
+ * @param problema Ponteiro para a estrutura do problema
+ */
+void executar_guloso_varredura(Problema *problema)
+{
+    int indice_ponto = 0;
+    int proximo_intervalo = 0;
+    int melhor_intervalo = -1;
+
+    qsort(problema->pontos, problema->n_pontos, sizeof(Ponto), comparar_pontos);
+    memcpy(problema->intervalos_por_inicio, problema->intervalos, problema->n_intervalos * sizeof(Intervalo));
+    qsort(problema->intervalos_por_inicio, problema->n_intervalos, sizeof(Intervalo), comparar_intervalos_por_inicio);
+
+    while (indice_ponto < problema->n_pontos)
+    {
+        int posicao = problema->pontos[indice_ponto].posicao;
+
+        while (proximo_intervalo < problema->n_intervalos && problema->intervalos_por_inicio[proximo_intervalo].inicio <= posicao)
+        {
+            if (melhor_intervalo == -1 || problema->intervalos_por_inicio[proximo_intervalo].fim > problema->intervalos_por_inicio[melhor_intervalo].fim)
+            {
+                melhor_intervalo = proximo_intervalo;
+            }
+            proximo_intervalo++;
+        }
+
+        if (melhor_intervalo == -1 || problema->intervalos_por_inicio[melhor_intervalo].fim < posicao)
+        {
+            break;
+        }
+
+        Intervalo escolhido = problema->intervalos_por_inicio[melhor_intervalo];
+        problema->solucao[problema->n_solucao] = escolhido;
+        problema->n_solucao++;
+
+        while (indice_ponto < problema->n_pontos && problema->pontos[indice_ponto].posicao <= escolhido.fim)
+        {
+            if (problema->configuracao.usar_bitset)
+            {
+                problema->pontos_cobertos_bits[indice_ponto / 64] |= UINT64_C(1) << (indice_ponto % 64);
+            }
+            else
+            {
+                problema->pontos_cobertos[indice_ponto] = 1;
+            }
+            problema->n_pontos_cobertos++;
+            indice_ponto++;
+        }
+    }
+}
+
+/**
+ * @brief Resolve o problema da cobertura de pontos usando um algoritmo guloso.
+ *
+ * A estratégia gulosa consiste em:
+ * - Selecionar o próximo ponto ainda não coberto
+ * - Escolher o intervalo que cobre esse ponto e se estende o mais longe possível
+ * - Marcar todos os pontos cobertos por esse intervalo
+ *
+ * O processo se repete até que todos os pontos estejam cobertos ou
+ * não seja possível avançar.
+ *
+ * A memória da resolução sai da arena do problema, ajustada antes por
+ * `garantir_arena` caso a configuração tenha mudado desde a alocação
+ * da instância.
+ *
+ * Se `configuracao.aplicar_reducao` estiver ativo, pontos e intervalos
+ * redundantes são removidos por `reduzir_problema` antes da resolução.
+ *
+ * O motor definido em `configuracao.motor` seleciona a implementação:
+ * o laço clássico (`executar_guloso_classico`) ou a varredura
+ * O((n + m) log(n + m)) (`executar_guloso_varredura`).
+ *
+ * O tempo total é dividido entre o preparo (redução e alocação) e a
+ * escolha gulosa, medida à parte por `medir_lote`.
+ *
+ * @param problema Ponteiro para a estrutura do problema
+ * @return Estrutura contendo as métricas da execução
+ */
+Metricas resolver_guloso(Problema *problema)
+{
+    Metricas metricas;
+    struct timespec inicio, inicio_busca, fim;
+    struct rusage uso_memoria;
+    ContadoresHardware contadores;
+    int arena_pronta = 0;
+
+    metricas.tempo = 0.0;
+    metricas.tempo_preparo = 0.0;
+    metricas.tempo_busca = 0.0;
+    metricas.memoria = 0;
+    metricas.qualidade = 0.0;
+    metricas.n_solucao = 0;
+    metricas.pico_memoria = 0;
+    metricas.n_alocacoes = 0;
+    for (int k = 0; k < N_CONTADORES_HARDWARE; k++)
+    {
+        metricas.contadores[k] = -1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+
+    /**
+     * A contabilidade de memória recomeça a cada resolução, a partir da
+     * instância: as estruturas da resolução anterior voltam à arena.
+     */
+    arena_pronta = garantir_arena(problema);
+    arena_restaurar(&problema->arena, problema->marcador_instancia);
+    problema->memoria.pico_bytes = problema->memoria.bytes_em_uso;
+    problema->memoria.n_alocacoes = 0;
+
+    if (arena_pronta && problema->configuracao.aplicar_reducao)
+    {
+        reduzir_problema(problema);
+    }
+
+    if (alocar_estruturas_guloso(problema) == 0)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &fim);
+        problema->tempo_execucao = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
+        metricas.tempo = problema->tempo_execucao;
+        metricas.tempo_preparo = problema->tempo_execucao;
+        getrusage(RUSAGE_SELF, &uso_memoria);
+        problema->memoria_utilizada = uso_memoria.ru_maxrss;
+        metricas.memoria = problema->memoria_utilizada;
+        metricas.pico_memoria = problema->memoria.pico_bytes;
+        metricas.n_alocacoes = problema->memoria.n_alocacoes;
+        return metricas;
+    }
+
+    problema->n_pontos_cobertos = 0;
+    problema->n_solucao = 0;
+
+    if (problema->configuracao.medir_contadores)
+    {
+        contadores_abrir(&contadores);
+        contadores_iniciar(&contadores);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &inicio_busca);
+
+    if (problema->configuracao.motor == MOTOR_GULOSO_VARREDURA)
+    {
+        executar_guloso_varredura(problema);
+    }
+    else
+    {
+        executar_guloso_classico(problema);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+
+    if (problema->configuracao.medir_contadores)
+    {
+        contadores_parar(&contadores);
+        contadores_fechar(&contadores);
+        memcpy(metricas.contadores, contadores.valores, sizeof(metricas.contadores));
+    }
+
+    problema->tempo_execucao = (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0;
+    metricas.tempo = problema->tempo_execucao;
+    metricas.tempo_preparo = (inicio_busca.tv_sec - inicio.tv_sec) * 1000.0 + (inicio_busca.tv_nsec - inicio.tv_nsec) / 1000000.0;
+    metricas.tempo_busca = (fim.tv_sec - inicio_busca.tv_sec) * 1000.0 + (fim.tv_nsec - inicio_busca.tv_nsec) / 1000000.0;
+
+    getrusage(RUSAGE_SELF, &uso_memoria);
+    problema->memoria_utilizada = uso_memoria.ru_maxrss;
+    metricas.memoria = problema->memoria_utilizada;
+
+    if (problema->n_intervalos > 0)
+    {
+        problema->qualidade = 1.0 - ((double)problema->n_solucao / problema->n_intervalos);
+        metricas.qualidade = problema->qualidade;
+    }
+    else
+    {
+        problema->qualidade = 0.0;
+        metricas.qualidade = 0.0;
+    }
+
+    metricas.n_solucao = problema->n_solucao;
+    metricas.pico_memoria = problema->memoria.pico_bytes;
+    metricas.n_alocacoes = problema->memoria.n_alocacoes;
+
+    return metricas;
+}
+
+/**
+ * @brief Converte o nome de um motor guloso em sua constante.
+ *
+ * @param nome Nome do motor, como exibido por `nome_motor_guloso`.
+ * @return Constante MOTOR_GULOSO_* correspondente, ou -1 se o nome for desconhecido.
+ */
+int motor_por_nome_guloso(const char *nome)
+{
+    int motor;
+
+    for (motor = 0; motor < N_MOTORES_GULOSO; motor++)
+    {
+        if (strcmp(nome, nome_motor_guloso(motor)) == 0)
+        {
+            return motor;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Recalcula o maior `secundaria` da subárvore de um nó.
+ *
+ * @param nos Vetor de nós.
+ * @param no Nó a atualizar.
+ */
+void atualizar_no_incremental(NoIncremental *nos, int no)
+{
+    int maximo = nos[no].secundaria;
+
+    if (nos[no].esquerda != -1 && nos[nos[no].esquerda].maximo > maximo)
+    {
+        maximo = nos[nos[no].esquerda].maximo;
+    }
+    if (nos[no].direita != -1 && nos[nos[no].direita].maximo > maximo)
+    {
+        maximo = nos[nos[no].direita].maximo;
+    }
+    nos[no].maximo = maximo;
+}
+
+/**
+ * @brief Divide uma treap pela chave (`chave`, `secundaria`).
+ *
+ * @param nos Vetor de nós.
+ * @param raiz Árvore a dividir.
+ * @param chave Primeira coordenada do corte.
+ * @param secundaria Segunda coordenada do corte.
+ * @param inclusiva 1 para que nós iguais ao corte fiquem em `menores`.
+ * @param menores Recebe a árvore dos nós antes do corte.
+ * @param demais Recebe a árvore dos demais nós.
+ */
+void dividir_incremental(NoIncremental *nos, int raiz, int chave, int secundaria, int inclusiva, int *menores, int *demais)
+{
+    if (raiz == -1)
+    {
+        *menores = -1;
+        *demais = -1;
+    }
+    else if (nos[raiz].chave < chave || (nos[raiz].chave == chave && (nos[raiz].secundaria < secundaria ||
+                                                                      (inclusiva && nos[raiz].secundaria == secundaria))))
+    {
+        dividir_incremental(nos, nos[raiz].direita, chave, secundaria, inclusiva, &nos[raiz].direita, demais);
+        atualizar_no_incremental(nos, raiz);
+        *menores = raiz;
+    }
+    else
+    {
+        dividir_incremental(nos, nos[raiz].esquerda, chave, secundaria, inclusiva, menores, &nos[raiz].esquerda);
+        atualizar_no_incremental(nos, raiz);
+        *demais = raiz;
+    }
+}
+
+/**
+ * @brief Une duas treaps em que todos os nós de `a` vêm antes dos de `b`.
+ *
+ * @param nos Vetor de nós.
+ * @param a Árvore da esquerda.
+ * @param b Árvore da direita.
+ * @return Raiz da árvore unida.
+ */
+int unir_incremental(NoIncremental *nos, int a, int b)
+{
+    int raiz = a == -1 ? b : a;
+
+    if (a != -1 && b != -1)
+    {
+        if (nos[a].prioridade > nos[b].prioridade)
+        {
+            nos[a].direita = unir_incremental(nos, nos[a].direita, b);
+            raiz = a;
+        }
+        else
+        {
+            nos[b].esquerda = unir_incremental(nos, a, nos[b].esquerda);
+            raiz = b;
+        }
+        atualizar_no_incremental(nos, raiz);
+    }
+
+    return raiz;
+}
+
+/**
+ * @brief Garante espaço no vetor de nós para mais `extra` nós novos.
+ *
+ * Os nós da lista livre não são contados, então depois desta chamada
+ * `novo_no_incremental` não falha nas próximas `extra` criações.
+ *
+ * @param cobertura Cobertura incremental dona dos nós.
+ * @param extra Quantidade de nós que ainda serão criados.
+ * @return 1 em caso de sucesso, ou 0 se faltar memória.
+ */
+int garantir_nos_incremental(CoberturaIncremental *cobertura, int extra)
+{
+    if (cobertura->n_nos + extra > cobertura->capacidade_nos)
+    {
+        int capacidade = cobertura->capacidade_nos > 0 ? cobertura->capacidade_nos : 64;
+        NoIncremental *nos;
+
+        while (capacidade < cobertura->n_nos + extra)
+        {
+            capacidade *= 2;
+        }
+        nos = (NoIncremental *)realloc(cobertura->nos, (size_t)capacidade * sizeof(NoIncremental));
+        if (nos == NULL)
+        {
+            return 0;
+        }
+        cobertura->nos = nos;
+        cobertura->capacidade_nos = capacidade;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Obtém um nó livre, reaproveitando os removidos antes de crescer o vetor.
+ *
+ * @param cobertura Cobertura incremental dona dos nós.
+ * @param modelo Campos do nó (filhos e prioridade são definidos aqui).
+ * @return Índice do nó, ou -1 se faltar memória.
+ */
+int novo_no_incremental(CoberturaIncremental *cobertura, const NoIncremental *modelo)
+{
+    int no = cobertura->livre;
+
+    if (no != -1)
+    {
+        cobertura->livre = cobertura->nos[no].esquerda;
+    }
+    else if (garantir_nos_incremental(cobertura, 1))
+    {
+        no = cobertura->n_nos++;
+    }
+    else
+    {
+        return -1;
+    }
+
+    cobertura->nos[no] = *modelo;
+    cobertura->nos[no].maximo = modelo->secundaria;
+    cobertura->nos[no].prioridade = (uint32_t)gerador_proximo(&cobertura->gerador);
+    cobertura->nos[no].esquerda = -1;
+    cobertura->nos[no].direita = -1;
+
+    return no;
+}
+
+/**
+ * @brief Devolve à lista livre todos os nós de uma árvore de passos.
+ *
+ * Desconta da solução os passos removidos.
+ *
+ * @param cobertura Cobertura incremental dona dos nós.
+ * @param raiz Árvore a descartar.
+ */
+void descartar_passos_incremental(CoberturaIncremental *cobertura, int raiz)
+{
+    if (raiz != -1)
+    {
+        NoIncremental *no = &cobertura->nos[raiz];
+
+        descartar_passos_incremental(cobertura, no->esquerda);
+        descartar_passos_incremental(cobertura, no->direita);
+        if (no->contagem)
+        {
+            cobertura->n_solucao--;
+        }
+        else
+        {
+            cobertura->n_descobertos--;
+        }
+        cobertura->passos_removidos++;
+        no->esquerda = cobertura->livre;
+        cobertura->livre = raiz;
+    }
+}
+
+/**
+ * @brief Procura o nó com a chave exata (`chave`, `secundaria`).
+ *
+ * @param nos Vetor de nós.
+ * @param raiz Árvore consultada.
+ * @param chave Primeira coordenada.
+ * @param secundaria Segunda coordenada.
+ * @return Índice do nó, ou -1 se não existir.
+ */
+int procurar_no_incremental(const NoIncremental *nos, int raiz, int chave, int secundaria)
+{
+    while (raiz != -1 && (nos[raiz].chave != chave || nos[raiz].secundaria != secundaria))
+    {
+        if (nos[raiz].chave < chave || (nos[raiz].chave == chave && nos[raiz].secundaria < secundaria))
+        {
+            raiz = nos[raiz].direita;
+        }
+        else
+        {
+            raiz = nos[raiz].esquerda;
+        }
+    }
+
+    return raiz;
+}
+
+/**
+ * @brief Soma uma ocorrência de (`chave`, `secundaria`) à árvore, criando o nó se preciso.
+ *
+ * @param cobertura Cobertura incremental dona dos nós.
+ * @param raiz Árvore alterada.
+ * @param chave Primeira coordenada.
+ * @param secundaria Segunda coordenada.
+ * @return 1 em caso de sucesso, ou 0 se faltar memória.
+ */
+int inserir_ocorrencia_incremental(CoberturaIncremental *cobertura, int *raiz, int chave, int secundaria)
+{
+    int no = procurar_no_incremental(cobertura->nos, *raiz, chave, secundaria);
+
+    if (no != -1)
+    {
+        cobertura->nos[no].contagem++;
+    }
+    else
+    {
+        NoIncremental modelo = {chave, secundaria, 0, 1, 0, 0, -1, -1};
+        int menores, demais;
+
+        no = novo_no_incremental(cobertura, &modelo);
+        if (no == -1)
+        {
+            return 0;
+        }
+        dividir_incremental(cobertura->nos, *raiz, chave, secundaria, 0, &menores, &demais);
+        *raiz = unir_incremental(cobertura->nos, unir_incremental(cobertura->nos, menores, no), demais);
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Retira uma ocorrência de (`chave`, `secundaria`) da árvore.
+ *
+ * @param cobertura Cobertura incremental dona dos nós.
+ * @param raiz Árvore alterada.
+ * @param chave Primeira coordenada.
+ * @param secundaria Segunda coordenada.
+ * @return 1 se a ocorrência existia, ou 0 caso contrário.
+ */
+int remover_ocorrencia_incremental(CoberturaIncremental *cobertura, int *raiz, int chave, int secundaria)
+{
+    int no = procurar_no_incremental(cobertura->nos, *raiz, chave, secundaria);
+
+    if (no == -1)
+    {
+        return 0;
+    }
+
+    if (cobertura->nos[no].contagem > 1)
+    {
+        cobertura->nos[no].contagem--;
+    }
+    else
+    {
+        int menores, iguais, demais;
+
+        dividir_incremental(cobertura->nos, *raiz, chave, secundaria, 0, &menores, &demais);
+        dividir_incremental(cobertura->nos, demais, chave, secundaria, 1, &iguais, &demais);
+        cobertura->nos[iguais].esquerda = cobertura->livre;
+        cobertura->livre = iguais;
+        *raiz = unir_incremental(cobertura->nos, menores, demais);
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Encontra o primeiro nó com `chave` maior que um limite.
+ *
+ * @param nos Vetor de nós.
+ * @param raiz Árvore consultada.
+ * @param limite Limite exclusivo (LLONG_MIN para o primeiro nó).
+ * @return Índice do nó, ou -1 se não existir.
+ */
+int primeiro_apos_incremental(const NoIncremental *nos, int raiz, long long limite)
+{
+    int encontrado = -1;
+
+    while (raiz != -1)
+    {
+        if (nos[raiz].chave > limite)
+        {
+            encontrado = raiz;
+            raiz = nos[raiz].esquerda;
+        }
+        else
+        {
+            raiz = nos[raiz].direita;
+        }
+    }
+
+    return encontrado;
+}
+
+/**
+ * @brief Encontra o último nó com `chave` menor que um limite.
+ *
+ * @param nos Vetor de nós.
+ * @param raiz Árvore consultada.
+ * @param limite Limite exclusivo.
+ * @return Índice do nó, ou -1 se não existir.
+ */
+int ultimo_antes_incremental(const NoIncremental *nos, int raiz, long long limite)
+{
+    int encontrado = -1;
+
+    while (raiz != -1)
+    {
+        if (nos[raiz].chave < limite)
+        {
+            encontrado = raiz;
+            raiz = nos[raiz].direita;
+        }
+        else
+        {
+            raiz = nos[raiz].esquerda;
+        }
+    }
+
+    return encontrado;
+}
+
+/**
+ * @brief Escolhe o intervalo da varredura para um ponto descoberto.
+ *
+ * Entre os intervalos com início até `posicao`, escolhe o de maior fim
+ * e, no empate, o de menor início, como `executar_guloso_varredura`.
+ * Primeiro calcula o maior fim desse prefixo e depois desce até o nó
+ * mais à esquerda que o alcança, ambos em O(log m).
+ *
+ * @param nos Vetor de nós.
+ * @param raiz Árvore dos intervalos.
+ * @param posicao Posição do ponto descoberto.
+ * @return Nó do intervalo, ou -1 se nenhum intervalo cobre o ponto.
+ */
+int escolher_intervalo_incremental(const NoIncremental *nos, int raiz, int posicao)
+{
+    long long alcance = LLONG_MIN;
+    int no = raiz;
+
+    while (no != -1)
+    {
+        if (nos[no].chave <= posicao)
+        {
+            if (nos[no].esquerda != -1 && nos[nos[no].esquerda].maximo > alcance)
+            {
+                alcance = nos[nos[no].esquerda].maximo;
+            }
+            if (nos[no].secundaria > alcance)
+            {
+                alcance = nos[no].secundaria;
+            }
+            no = nos[no].direita;
+        }
+        else
+        {
+            no = nos[no].esquerda;
+        }
+    }
+
+    if (alcance < posicao)
+    {
+        return -1;
+    }
+
+    no = raiz;
+    while (no != -1)
+    {
+        if (nos[no].chave > posicao)
+        {
+            no = nos[no].esquerda;
+        }
+        else if (nos[no].esquerda != -1 && nos[nos[no].esquerda].maximo == alcance)
+        {
+            no = nos[no].esquerda;
+        }
+        else if (nos[no].secundaria == alcance)
+        {
+            break;
+        }
+        else
+        {
+            no = nos[no].direita;
+        }
+    }
+
+    return no;
+}
+
+/**
+ * @brief Monta em O(n) uma treap a partir de nós já ordenados e distintos.
+ *
+ * Percorre os nós mantendo em uma pilha a borda direita da árvore: cada
+ * nó novo adota como filho esquerdo os nós da borda com prioridade
+ * menor. Os máximos das subárvores são calculados ao fim, de baixo para
+ * cima, pela ordem inversa de desempilhamento.
+ *
+ * @param cobertura Cobertura incremental dona dos nós.
+ * @param modelos Campos dos nós, em ordem crescente de (`chave`, `secundaria`).
+ * @param n Quantidade de nós.
+ * @param raiz Recebe a raiz da árvore.
+ * @return 1 em caso de sucesso, ou 0 se faltar memória.
+ */
+int construir_arvore_incremental(CoberturaIncremental *cobertura, const NoIncremental *modelos, int n, int *raiz)
+{
+    int *pilha = (int *)malloc(((size_t)n + 1) * sizeof(int));
+    int *ordem = (int *)malloc(((size_t)n + 1) * sizeof(int));
+    int n_pilha = 0, n_ordem = 0;
+
+    *raiz = -1;
+    if (pilha == NULL || ordem == NULL || garantir_nos_incremental(cobertura, n) == 0)
+    {
+        free(pilha);
+        free(ordem);
+        return 0;
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        int no = novo_no_incremental(cobertura, &modelos[i]);
+        int ultimo = -1;
+
+        while (n_pilha > 0 && cobertura->nos[pilha[n_pilha - 1]].prioridade < cobertura->nos[no].prioridade)
+        {
+            ultimo = pilha[--n_pilha];
+            ordem[n_ordem++] = ultimo;
+        }
+        cobertura->nos[no].esquerda = ultimo;
+        if (n_pilha > 0)
+        {
+            cobertura->nos[pilha[n_pilha - 1]].direita = no;
+        }
+        pilha[n_pilha++] = no;
+    }
+    while (n_pilha > 0)
+    {
+        ordem[n_ordem++] = pilha[--n_pilha];
+    }
+
+    for (int i = 0; i < n_ordem; i++)
+    {
+        atualizar_no_incremental(cobertura->nos, ordem[i]);
+    }
+    if (n_ordem > 0)
+    {
+        *raiz = ordem[n_ordem - 1];
+    }
+
+    free(pilha);
+    free(ordem);
+
+    return 1;
+}
+
+/**
+ * @brief Compara dois nós por (`chave`, `secundaria`).
+ *
+ * Função compatível com `qsort`.
+ *
+ * @param a Ponteiro para o primeiro nó.
+ * @param b Ponteiro para o segundo nó.
+ * @return Valor negativo, positivo ou zero conforme a ordem relativa.
+ */
+int comparar_nos_incremental(const void *a, const void *b)
+{
+    const NoIncremental *no_a = (const NoIncremental *)a;
+    const NoIncremental *no_b = (const NoIncremental *)b;
+    int resultado = 0;
+
+    if (no_a->chave != no_b->chave)
+    {
+        resultado = no_a->chave < no_b->chave ? -1 : 1;
+    }
+    else if (no_a->secundaria != no_b->secundaria)
+    {
+        resultado = no_a->secundaria < no_b->secundaria ? -1 : 1;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Monta uma árvore de ocorrências a partir de pares (`chave`, `secundaria`) em qualquer ordem.
+ *
+ * Ordena os pares, agrupa os repetidos em um nó com `contagem` e monta
+ * a treap com `construir_arvore_incremental`.
+ *
+ * @param cobertura Cobertura incremental dona dos nós.
+ * @param modelos Pares a inserir; o vetor é ordenado e reescrito.
+ * @param n Quantidade de pares.
+ * @param raiz Recebe a raiz da árvore.
+ * @return 1 em caso de sucesso, ou 0 se faltar memória.
+ */
+int construir_ocorrencias_incremental(CoberturaIncremental *cobertura, NoIncremental *modelos, int n, int *raiz)
+{
+    int distintos = 0;
+
+    qsort(modelos, (size_t)n, sizeof(NoIncremental), comparar_nos_incremental);
+    for (int i = 0; i < n; i++)
+    {
+        if (distintos > 0 && modelos[distintos - 1].chave == modelos[i].chave &&
+            modelos[distintos - 1].secundaria == modelos[i].secundaria)
+        {
+            modelos[distintos - 1].contagem++;
+        }
+        else
+        {
+            modelos[distintos] = modelos[i];
+            modelos[distintos].contagem = 1;
+            distintos++;
+        }
+    }
+
+    return construir_arvore_incremental(cobertura, modelos, distintos, raiz);
+}
+
+/**
+ * @brief Refaz os passos da varredura afetados por uma edição em [esquerda, direita].
+ *
+ * Recomeça da fronteira do último passo que termina antes de `esquerda`
+ * e produz passos novos até que um deles termine, além de `direita`,
+ * na fronteira de um passo antigo: como o passo seguinte só depende da
+ * fronteira e dos dados à sua direita, os passos antigos dali em diante
+ * são mantidos. Os passos antigos substituídos são descartados de uma
+ * vez por um corte da árvore.
+ *
+ * @param cobertura Cobertura incremental, com a edição já aplicada.
+ * @param esquerda Menor coordenada alterada.
+ * @param direita Maior coordenada alterada.
+ * @return 1 em caso de sucesso, ou 0 se faltar memória.
+ */
+int reparar_varredura_incremental(CoberturaIncremental *cobertura, int esquerda, int direita)
+{
+    int anterior = ultimo_antes_incremental(cobertura->nos, cobertura->raiz_passos, esquerda);
+    long long inicio = anterior != -1 ? cobertura->nos[anterior].chave : LLONG_MIN;
+    long long fronteira = inicio;
+    int convergiu = 0;
+    int n_novos = 0;
+    int menores, antigos, demais, novos;
+
+    cobertura->passos_refeitos = 0;
+    cobertura->passos_removidos = 0;
+
+    while (convergiu == 0)
+    {
+        int ponto = primeiro_apos_incremental(cobertura->nos, cobertura->raiz_pontos, fronteira);
+        NoIncremental passo = {0, 0, 0, 0, 0, 0, -1, -1};
+        int escolhido;
+
+        if (ponto == -1)
+        {
+            break;
+        }
+
+        passo.valor = cobertura->nos[ponto].chave;
+        escolhido = escolher_intervalo_incremental(cobertura->nos, cobertura->raiz_intervalos, passo.valor);
+        if (escolhido != -1)
+        {
+            passo.chave = cobertura->nos[escolhido].secundaria;
+            passo.secundaria = cobertura->nos[escolhido].chave;
+            passo.contagem = 1;
+        }
+        else
+        {
+            passo.chave = passo.valor;
+            passo.secundaria = passo.valor;
+        }
+
+        if (n_novos == cobertura->capacidade_passos_novos)
+        {
+            int capacidade = n_novos > 0 ? 2 * n_novos : 16;
+            NoIncremental *passos = (NoIncremental *)realloc(cobertura->passos_novos, (size_t)capacidade * sizeof(NoIncremental));
+
+            if (passos == NULL)
+            {
+                return 0;
+            }
+            cobertura->passos_novos = passos;
+            cobertura->capacidade_passos_novos = capacidade;
+        }
+        cobertura->passos_novos[n_novos++] = passo;
+        fronteira = passo.chave;
+
+        if (fronteira >= direita)
+        {
+            int antigo = primeiro_apos_incremental(cobertura->nos, cobertura->raiz_passos, fronteira - 1);
+
+            convergiu = antigo != -1 && cobertura->nos[antigo].chave == fronteira;
+        }
+    }
+
+    cobertura->passos_refeitos = n_novos;
+    if (construir_arvore_incremental(cobertura, cobertura->passos_novos, n_novos, &novos) == 0)
+    {
+        return 0;
+    }
+
+    if (inicio == LLONG_MIN)
+    {
+        menores = -1;
+        antigos = cobertura->raiz_passos;
+    }
+    else
+    {
+        dividir_incremental(cobertura->nos, cobertura->raiz_passos, (int)inicio, INT_MAX, 1, &menores, &antigos);
+    }
+    if (convergiu)
+    {
+        dividir_incremental(cobertura->nos, antigos, (int)fronteira, INT_MAX, 1, &antigos, &demais);
+    }
+    else
+    {
+        demais = -1;
+    }
+    descartar_passos_incremental(cobertura, antigos);
+
+    for (int i = 0; i < n_novos; i++)
+    {
+        if (cobertura->passos_novos[i].contagem)
+        {
+            cobertura->n_solucao++;
+        }
+        else
+        {
+            cobertura->n_descobertos++;
+        }
+    }
+    cobertura->raiz_passos = unir_incremental(cobertura->nos, unir_incremental(cobertura->nos, menores, novos), demais);
+
+    return 1;
+}
+
+/**
+ * @brief Carrega uma instância na cobertura incremental e resolve pela varredura.
+ *
+ * Os pontos são identificados apenas pela posição (os `id` são
+ * ignorados). A solução inicial é a mesma de `executar_guloso_varredura`
+ * quando todos os pontos podem ser cobertos.
+ *
+ * @param cobertura Cobertura a inicializar; deve ser devolvida com `incremental_liberar`.
+ * @param instancia Instância inicial (não é alterada), em coordenadas de 32 bits ou em postos (veja `CoberturaIncremental`).
+ * @return 1 em caso de sucesso, ou 0 se faltar memória.
+ */
+int incremental_criar(CoberturaIncremental *cobertura, const InstanciaCobertura *instancia)
+{
+    int sucesso = 1;
+
+    memset(cobertura, 0, sizeof(*cobertura));
+    cobertura->livre = -1;
+    cobertura->raiz_pontos = -1;
+    cobertura->raiz_intervalos = -1;
+    cobertura->raiz_passos = -1;
+    cobertura->gerador.estado = UINT64_C(0x9E3779B97F4A7C15);
+
+    int n_modelos = instancia->n_pontos > instancia->n_intervalos ? instancia->n_pontos : instancia->n_intervalos;
+    NoIncremental *modelos = (NoIncremental *)calloc((size_t)n_modelos + 1, sizeof(NoIncremental));
+
+    if (modelos == NULL)
+    {
+        return 0;
+    }
+
+    for (int i = 0; i < instancia->n_pontos; i++)
+    {
+        modelos[i].chave = instancia->pontos[i].posicao;
+        modelos[i].secundaria = 0;
+    }
+    sucesso = construir_ocorrencias_incremental(cobertura, modelos, instancia->n_pontos, &cobertura->raiz_pontos);
+    for (int i = 0; i < instancia->n_intervalos; i++)
+    {
+        modelos[i].chave = instancia->intervalos[i].inicio;
+        modelos[i].secundaria = instancia->intervalos[i].fim;
+    }
+    sucesso = sucesso && construir_ocorrencias_incremental(cobertura, modelos, instancia->n_intervalos, &cobertura->raiz_intervalos);
+    free(modelos);
+
+    if (sucesso)
+    {
+        cobertura->n_pontos = instancia->n_pontos;
+        cobertura->n_intervalos = instancia->n_intervalos;
+        sucesso = reparar_varredura_incremental(cobertura, INT_MIN, INT_MAX);
+    }
+    if (sucesso == 0)
+    {
+        incremental_liberar(cobertura);
+    }
+
+    return sucesso;
+}
+
+/**
+ * @brief Libera a memória de uma cobertura incremental.
+ *
+ * @param cobertura Cobertura a liberar.
+ */
+void incremental_liberar(CoberturaIncremental *cobertura)
+{
+    free(cobertura->nos);
+    free(cobertura->passos_novos);
+    memset(cobertura, 0, sizeof(*cobertura));
+    cobertura->livre = -1;
+    cobertura->raiz_pontos = -1;
+    cobertura->raiz_intervalos = -1;
+    cobertura->raiz_passos = -1;
+}
+
+/**
+ * @brief Insere um ponto e repara a solução.
+ *
+ * @param cobertura Cobertura incremental.
+ * @param posicao Posição do novo ponto.
+ * @return 1 em caso de sucesso, ou 0 se faltar memória.
+ */
+int incremental_inserir_ponto(CoberturaIncremental *cobertura, int posicao)
+{
+    if (inserir_ocorrencia_incremental(cobertura, &cobertura->raiz_pontos, posicao, 0) == 0)
+    {
+        return 0;
+    }
+    cobertura->n_pontos++;
+
+    return reparar_varredura_incremental(cobertura, posicao, posicao);
+}
+
+/**
+ * @brief Remove um ponto (uma ocorrência da posição) e repara a solução.
+ *
+ * @param cobertura Cobertura incremental.
+ * @param posicao Posição do ponto a remover.
+ * @return 1 em caso de sucesso, ou 0 se não houver ponto na posição ou faltar memória.
+ */
+int incremental_remover_ponto(CoberturaIncremental *cobertura, int posicao)
+{
+    if (remover_ocorrencia_incremental(cobertura, &cobertura->raiz_pontos, posicao, 0) == 0)
+    {
+        return 0;
+    }
+    cobertura->n_pontos--;
+
+    return reparar_varredura_incremental(cobertura, posicao, posicao);
+}
+
+/**
+ * @brief Insere um intervalo e repara a solução.
+ *
+ * Só os passos cujo ponto descoberto fica em [início, fim] podem mudar.
+ *
+ * @param cobertura Cobertura incremental.
+ * @param intervalo Intervalo a inserir.
+ * @return 1 em caso de sucesso, ou 0 se faltar memória.
+ */
+int incremental_inserir_intervalo(CoberturaIncremental *cobertura, Intervalo intervalo)
+{
+    if (inserir_ocorrencia_incremental(cobertura, &cobertura->raiz_intervalos, intervalo.inicio, intervalo.fim) == 0)
+    {
+        return 0;
+    }
+    cobertura->n_intervalos++;
+
+    return intervalo.inicio > intervalo.fim || reparar_varredura_incremental(cobertura, intervalo.inicio, intervalo.fim);
+}
+
+/**
+ * @brief Remove um intervalo (uma ocorrência de início e fim) e repara a solução.
+ *
+ * @param cobertura Cobertura incremental.
+ * @param intervalo Intervalo a remover.
+ * @return 1 em caso de sucesso, ou 0 se o intervalo não existir ou faltar memória.
+ */
+int incremental_remover_intervalo(CoberturaIncremental *cobertura, Intervalo intervalo)
+{
+    if (remover_ocorrencia_incremental(cobertura, &cobertura->raiz_intervalos, intervalo.inicio, intervalo.fim) == 0)
+    {
+        return 0;
+    }
+    cobertura->n_intervalos--;
+
+    return intervalo.inicio > intervalo.fim || reparar_varredura_incremental(cobertura, intervalo.inicio, intervalo.fim);
+}
+
+/**
+ * @brief Copia a solução atual, em ordem crescente de fim.
+ *
+ * A cópia percorre a árvore de passos, em O(n_solucao + n_descobertos).
+ * A solução cobre todos os pontos se `n_descobertos` for zero e, nesse
+ * caso, é ótima, como a da varredura.
+ *
+ * @param cobertura Cobertura incremental.
+ * @param solucao Vetor com espaço para `cobertura->n_solucao` intervalos.
+ * @return Quantidade de intervalos copiados.
+ */
+int incremental_solucao(const CoberturaIncremental *cobertura, Intervalo *solucao)
+{
+    int n_solucao = 0;
+    int no = cobertura->raiz_passos;
+    int *pilha = (int *)malloc(((size_t)cobertura->n_solucao + (size_t)cobertura->n_descobertos + 1) * sizeof(int));
+    int n_pilha = 0;
+
+    if (pilha == NULL)
+    {
+        return 0;
+    }
+
+    while (no != -1 || n_pilha > 0)
+    {
+        while (no != -1)
+        {
+            pilha[n_pilha++] = no;
+            no = cobertura->nos[no].esquerda;
+        }
+        no = pilha[--n_pilha];
+        if (cobertura->nos[no].contagem)
+        {
+            solucao[n_solucao].inicio = cobertura->nos[no].secundaria;
+            solucao[n_solucao].fim = cobertura->nos[no].chave;
+            n_solucao++;
+        }
+        no = cobertura->nos[no].direita;
+    }
+
+    free(pilha);
+
+    return n_solucao;
+}
+
+/**
+ * @brief Prepara uma cobertura sobre fluxos vazia.
+ *
+ * @param fluxo Estado a inicializar; deve ser devolvido com `fluxo_liberar`.
+ */
+void fluxo_iniciar(CoberturaFluxo *fluxo)
+{
+    memset(fluxo, 0, sizeof(*fluxo));
+    fluxo->fronteira = LLONG_MIN;
+    fluxo->ultimo_ponto = LLONG_MIN;
+    fluxo->ultimo_inicio = LLONG_MIN;
+}
+
+/**
+ * @brief Libera a fila de intervalos pendentes de uma cobertura sobre fluxos.
+ *
+ * @param fluxo Estado a liberar.
+ */
+void fluxo_liberar(CoberturaFluxo *fluxo)
+{
+    free(fluxo->pendentes);
+    fluxo->pendentes = NULL;
+    fluxo->capacidade_pendentes = 0;
+    fluxo->inicio_pendentes = 0;
+    fluxo->n_pendentes = 0;
+}
+
+/**
+ * @brief Torna um intervalo candidato da varredura.
+ *
+ * Mantém o de maior fim; no empate fica o que chegou primeiro, como na
+ * comparação estrita de `executar_guloso_varredura`.
+ *
+ * @param fluxo Estado da varredura.
+ * @param intervalo Intervalo com início até a posição do ponto atual.
+ */
+void fluxo_considerar_intervalo(CoberturaFluxo *fluxo, Intervalo intervalo)
+{
+    if (fluxo->tem_melhor == 0 || intervalo.fim > fluxo->melhor.fim)
+    {
+        fluxo->melhor = intervalo;
+        fluxo->tem_melhor = 1;
+    }
+}
+
+/**
+ * @brief Recebe o próximo intervalo do fluxo.
+ *
+ * Os intervalos devem chegar em ordem crescente de início, e nenhum
+ * pode começar em uma posição já alcançada pelos pontos recebidos: a
+ * varredura já teria decidido sem ele.
+ *
+ * @param fluxo Estado da varredura.
+ * @param intervalo Intervalo recebido.
+ * @return 1 em caso de sucesso, 0 se faltar memória, ou -1 se o
+ *         intervalo estiver fora de ordem.
+ */
+int fluxo_receber_intervalo(CoberturaFluxo *fluxo, Intervalo intervalo)
+{
+    int indice;
+
+    if (intervalo.inicio < fluxo->ultimo_inicio || intervalo.inicio <= fluxo->ultimo_ponto)
+    {
+        return -1;
+    }
+
+    if (fluxo->n_pendentes == fluxo->capacidade_pendentes)
+    {
+        int capacidade = fluxo->capacidade_pendentes > 0 ? 2 * fluxo->capacidade_pendentes : 64;
+        Intervalo *pendentes = (Intervalo *)malloc((size_t)capacidade * sizeof(Intervalo));
+
+        if (pendentes == NULL)
+        {
+            return 0;
+        }
+        for (int i = 0; i < fluxo->n_pendentes; i++)
+        {
+            pendentes[i] = fluxo->pendentes[(fluxo->inicio_pendentes + i) & (fluxo->capacidade_pendentes - 1)];
+        }
+        free(fluxo->pendentes);
+        fluxo->pendentes = pendentes;
+        fluxo->capacidade_pendentes = capacidade;
+        fluxo->inicio_pendentes = 0;
+    }
+
+    indice = (fluxo->inicio_pendentes + fluxo->n_pendentes) & (fluxo->capacidade_pendentes - 1);
+    fluxo->pendentes[indice] = intervalo;
+    fluxo->n_pendentes++;
+    if (fluxo->n_pendentes > fluxo->pico_pendentes)
+    {
+        fluxo->pico_pendentes = fluxo->n_pendentes;
+    }
+    fluxo->ultimo_inicio = intervalo.inicio;
+    fluxo->n_intervalos++;
+
+    return 1;
+}
+
+/**
+ * @brief Recebe o próximo ponto do fluxo e emite o intervalo que o cobre, se for escolhido agora.
+ *
+ * Libera da fila os intervalos que começam até a posição do ponto. Se
+ * o ponto já está coberto, nada é emitido; senão, o intervalo liberado
+ * de maior fim é emitido, e a decisão não muda com os próximos pontos.
+ * Se nenhum intervalo cobre o ponto, a cobertura é interrompida, como
+ * em `executar_guloso_varredura`: os intervalos emitidos até ali são a
+ * mesma solução parcial, e os pontos seguintes contam como descobertos.
+ *
+ * @param fluxo Estado da varredura.
+ * @param posicao Posição do ponto recebido.
+ * @param emitido Recebe o intervalo escolhido, quando houver.
+ * @return 1 se um intervalo foi emitido, 0 se não, ou -1 se o ponto
+ *         estiver fora de ordem.
+ */
+int fluxo_receber_ponto(CoberturaFluxo *fluxo, int posicao, Intervalo *emitido)
+{
+    int resultado = 0;
+
+    if (posicao < fluxo->ultimo_ponto)
+    {
+        return -1;
+    }
+
+    while (fluxo->n_pendentes > 0 && fluxo->pendentes[fluxo->inicio_pendentes].inicio <= posicao)
+    {
+        fluxo_considerar_intervalo(fluxo, fluxo->pendentes[fluxo->inicio_pendentes]);
+        fluxo->inicio_pendentes = (fluxo->inicio_pendentes + 1) & (fluxo->capacidade_pendentes - 1);
+        fluxo->n_pendentes--;
+    }
+    fluxo->ultimo_ponto = posicao;
+    fluxo->n_pontos++;
+
+    if (fluxo->interrompido == 0 && posicao > fluxo->fronteira)
+    {
+        if (fluxo->tem_melhor && fluxo->melhor.fim >= posicao)
+        {
+            *emitido = fluxo->melhor;
+            fluxo->fronteira = fluxo->melhor.fim;
+            fluxo->n_solucao++;
+            resultado = 1;
+        }
+        else
+        {
+            fluxo->interrompido = 1;
+        }
+    }
+    if (fluxo->interrompido)
+    {
+        fluxo->n_descobertos++;
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Preenche um registro do repositório com o resultado de uma resolução.
+ *
+ * Completa o registro iniciado por `registro_iniciar` com o motor e as
+ * métricas. Sem repetições, a busca tem uma única amostra.
+ *
+ * @param registro Registro já iniciado com a instância.
+ * @param problema Problema resolvido, de onde vêm o motor e a cobertura.
+ * @param metricas Métricas da (última) resolução.
+ */
+void preencher_registro_guloso(RegistroExecucao *registro, const Problema *problema, const Metricas *metricas)
+{
+    double tempo_busca = metricas->tempo_busca;
+
+    snprintf(registro->motor, sizeof(registro->motor), "%s", nome_motor_guloso(problema->configuracao.motor));
+    registro->n_solucao = problema->n_pontos_cobertos == problema->n_pontos ? metricas->n_solucao : -1;
+    registro->tempo = metricas->tempo;
+    calcular_estatisticas_tempo(&tempo_busca, 1, &registro->busca);
+    registro->pico_memoria = metricas->pico_memoria;
+    registro->n_alocacoes = metricas->n_alocacoes;
+    registro->memoria_kb = metricas->memoria;
+}
+
+/**
+ * @brief Escreve uma linha do modo de edições: o estado da cobertura incremental depois de uma edição.
+ *
+ * @param cobertura Cobertura incremental já editada.
+ * @param origem Nome da origem, registrado na primeira coluna.
+ * @param indice Posição da instância na origem, a partir de 1.
+ * @param edicao Número da edição, ou 0 para a carga inicial.
+ * @param operacao Edição aplicada, como escrita no roteiro.
+ * @param tempo_ms Tempo da edição (ou da carga), em milissegundos.
+ * @param saida Fluxo que recebe a linha.
+ */
+void escrever_linha_edicao(const CoberturaIncremental *cobertura, const char *origem, int indice, int edicao, const char *operacao,
+                           double tempo_ms, FILE *saida)
+{
+    fprintf(saida, "%s,%d,%d,%s,%d,%d,%.4f,%d,%d,%d,%d\n",
+            origem, indice, edicao, operacao, cobertura->n_pontos, cobertura->n_intervalos, tempo_ms,
+            cobertura->n_solucao, cobertura->n_descobertos, cobertura->passos_refeitos, cobertura->passos_removidos);
+}
+
+/**
+ * @brief Aplica o roteiro de edições a uma instância pela cobertura incremental.
+ *
+ * A instância é carregada com `incremental_criar` (a linha da edição 0)
+ * e cada linha do roteiro é uma edição: `+p x` e `-p x` inserem e
+ * removem um ponto na posição x, e `+i a b` e `-i a b` inserem e
+ * removem o intervalo [a, b]. Linhas vazias e iniciadas por `#` são
+ * ignoradas. Depois de cada edição, a solução é reparada a partir da
+ * região editada e uma linha com o tempo, o tamanho da solução, os
+ * pontos descobertos e os passos refeitos e descartados da varredura é
+ * escrita, seguindo o cabeçalho de edições de `escrever_cabecalho_lote`; remoções
+ * de elementos ausentes só geram um aviso. O
+ * roteiro é relido para cada instância. As coordenadas do roteiro são
+ * as da instância, então instâncias comprimidas são recusadas.
+ *
+ * @param problema Instância carregada, ainda não resolvida.
+ * @param caminho Caminho do roteiro de edições.
+ * @param origem Nome da origem, registrado na primeira coluna.
+ * @param indice Posição da instância na origem, a partir de 1.
+ * @param saida Fluxo que recebe as linhas de resultado.
+ */
+void registrar_edicoes_lote(Problema *problema, const char *caminho, const char *origem, int indice, FILE *saida)
+{
+    InstanciaCobertura instancia;
+    CoberturaIncremental cobertura;
+    struct timespec inicio, fim;
+    FILE *roteiro;
+    char linha[256];
+    int edicao = 0;
+    int numero_linha = 0;
+    int sucesso = 1;
+
+    if (problema->coordenadas.valores != NULL)
+    {
+        fprintf(stderr, "Erro: a instancia %d de %s tem coordenadas comprimidas e nao aceita edicoes.\n", indice, origem);
+        return;
+    }
+
+    roteiro = fopen(caminho, "r");
+    if (roteiro == NULL)
+    {
+        fprintf(stderr, "Erro ao abrir o roteiro de edicoes %s.\n", caminho);
+        return;
+    }
+
+    instancia.pontos = problema->pontos;
+    instancia.n_pontos = problema->n_pontos;
+    instancia.intervalos = problema->intervalos;
+    instancia.n_intervalos = problema->n_intervalos;
+
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+    if (incremental_criar(&cobertura, &instancia) == 0)
+    {
+        fprintf(stderr, "Erro: memoria insuficiente para a instancia %d de %s.\n", indice, origem);
+        fclose(roteiro);
+        return;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+    escrever_linha_edicao(&cobertura, origem, indice, 0, "inicial",
+                          (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0, saida);
+
+    while (sucesso && fgets(linha, sizeof(linha), roteiro) != NULL)
+    {
+        char operacao[3];
+        long long a = 0, b = 0;
+        int campos;
+        int aplicada = 0;
+
+        numero_linha++;
+        linha[strcspn(linha, "\r\n")] = '\0';
+        if (linha[0] == '\0' || linha[0] == '#')
+        {
+            continue;
+        }
+
+        campos = sscanf(linha, "%2s %lld %lld", operacao, &a, &b);
+        if (campos < 2 || (operacao[0] != '+' && operacao[0] != '-') || (operacao[1] != 'p' && operacao[1] != 'i') ||
+            campos != (operacao[1] == 'p' ? 2 : 3) || a < INT_MIN || a > INT_MAX || b < INT_MIN || b > INT_MAX ||
+            (operacao[1] == 'i' && a > b))
+        {
+            fprintf(stderr, "Erro: edicao invalida na linha %d de %s: %s\n", numero_linha, caminho, linha);
+            sucesso = 0;
+            continue;
+        }
+
+        edicao++;
+        clock_gettime(CLOCK_MONOTONIC, &inicio);
+        if (operacao[1] == 'p')
+        {
+            aplicada = operacao[0] == '+' ? incremental_inserir_ponto(&cobertura, (int)a) : incremental_remover_ponto(&cobertura, (int)a);
+        }
+        else
+        {
+            Intervalo intervalo = {(int)a, (int)b};
+
+            aplicada = operacao[0] == '+' ? incremental_inserir_intervalo(&cobertura, intervalo)
+                                          : incremental_remover_intervalo(&cobertura, intervalo);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &fim);
+
+        if (aplicada == 0 && operacao[0] == '+')
+        {
+            fprintf(stderr, "Erro: memoria insuficiente na edicao %d da instancia %d de %s.\n", edicao, indice, origem);
+            sucesso = 0;
+        }
+        else if (aplicada == 0)
+        {
+            fprintf(stderr, "Aviso: edicao %d (%s) nao encontrou o elemento na instancia %d de %s.\n", edicao, linha, indice, origem);
+        }
+        else
+        {
+            escrever_linha_edicao(&cobertura, origem, indice, edicao, linha,
+                                  (fim.tv_sec - inicio.tv_sec) * 1000.0 + (fim.tv_nsec - inicio.tv_nsec) / 1000000.0, saida);
+        }
+    }
+
+    incremental_liberar(&cobertura);
+    fclose(roteiro);
+}
+
+/**
+ * @brief Escreve as colunas do guloso na linha de resultado do modo em lote.
+ *
+ * São as colunas do cabeçalho de `escrever_cabecalho_lote` antes dos
+ * contadores e das estatísticas de tempo, que `registrar_instancia_lote`
+ * acrescenta. A coluna `cobertura_completa` indica se a solução cobre
+ * todos os pontos da instância.
+ *
+ * @param problema Problema resolvido.
+ * @param metricas Métricas da (última) resolução.
+ * @param origem Nome da origem, registrado na primeira coluna.
+ * @param indice Posição da instância na origem, a partir de 1.
+ * @param n_pontos Pontos da instância antes da redução.
+ * @param n_intervalos Intervalos da instância antes da redução.
+ * @param saida Fluxo que recebe a linha.
+ */
+void escrever_resultado_lote_guloso(const Problema *problema, const Metricas *metricas, const char *origem, int indice, int n_pontos,
+                                    int n_intervalos, FILE *saida)
+{
+    fprintf(saida, "%s,%d,%d,%d,%s,%.4f,%d,%.4f,%d,%zu,%" PRId64,
+            origem, indice, n_pontos, n_intervalos,
+            nome_motor_guloso(problema->configuracao.motor), metricas->tempo,
+            metricas->n_solucao, metricas->qualidade,
+            problema->n_pontos_cobertos == problema->n_pontos,
+            metricas->pico_memoria, metricas->n_alocacoes);
+}
+
+/**
+ * @brief Resolve pela varredura sobre fluxos uma sequência de eventos lida de um arquivo.
+ *
+ * Cada linha é um evento: `i a b` entrega o intervalo [a, b] e `p x`
+ * entrega um ponto na posição x (linhas vazias e iniciadas por `#` são
+ * ignoradas). Os pontos devem vir em ordem de posição, os intervalos em
+ * ordem de início, e cada intervalo antes do primeiro ponto que ele
+ * alcança. Os eventos são consumidos à medida que são lidos, sem
+ * guardar a instância, e cada intervalo escolhido é escrito em `saida`
+ * assim que a varredura o emite. Ao final, um resumo com as contagens
+ * e o pico de intervalos pendentes vai para a saída de erro.
+ *
+ * @param caminho Caminho do arquivo de eventos, ou "-" para a entrada padrão.
+ * @param caminho_saida Arquivo que recebe os intervalos escolhidos, ou NULL para a saída padrão.
+ * @return 0 se todos os eventos foram consumidos, 1 caso contrário.
+ */
+int executar_fluxo(const char *caminho, const char *caminho_saida)
+{
+    FILE *entrada = strcmp(caminho, "-") == 0 ? stdin : fopen(caminho, "r");
+    FILE *saida = caminho_saida != NULL ? fopen(caminho_saida, "w") : stdout;
+    CoberturaFluxo fluxo;
+    char linha[256];
+    int numero_linha = 0;
+    int falhou = 0;
+
+    if (entrada == NULL || saida == NULL)
+    {
+        fprintf(stderr, "Erro ao abrir %s.\n", entrada == NULL ? caminho : caminho_saida);
+        if (entrada != NULL && entrada != stdin)
+        {
+            fclose(entrada);
+        }
+        if (saida != NULL && saida != stdout)
+        {
+            fclose(saida);
+        }
+        return 1;
+    }
+
+    fluxo_iniciar(&fluxo);
+    fprintf(saida, "inicio,fim\n");
+
+    while (falhou == 0 && fgets(linha, sizeof(linha), entrada) != NULL)
+    {
+        char evento;
+        long long a = 0, b = 0;
+        int campos;
+        int recebido = 1;
+
+        numero_linha++;
+        linha[strcspn(linha, "\r\n")] = '\0';
+        if (linha[0] == '\0' || linha[0] == '#')
+        {
+            continue;
+        }
+
+        campos = sscanf(linha, " %c %lld %lld", &evento, &a, &b);
+        if ((evento != 'p' && evento != 'i') || campos != (evento == 'p' ? 2 : 3) || a < INT_MIN || a > INT_MAX || b < INT_MIN ||
+            b > INT_MAX || (evento == 'i' && a > b))
+        {
+            fprintf(stderr, "Erro: evento invalido na linha %d de %s: %s\n", numero_linha, caminho, linha);
+            falhou = 1;
+        }
+        else if (evento == 'i')
+        {
+            Intervalo intervalo = {(int)a, (int)b};
+
+            recebido = fluxo_receber_intervalo(&fluxo, intervalo);
+            if (recebido == 0)
+            {
+                fprintf(stderr, "Erro: memoria insuficiente na linha %d de %s.\n", numero_linha, caminho);
+                falhou = 1;
+            }
+        }
+        else
+        {
+            Intervalo emitido;
+
+            recebido = fluxo_receber_ponto(&fluxo, (int)a, &emitido);
+            if (recebido == 1)
+            {
+                fprintf(saida, "%d,%d\n", emitido.inicio, emitido.fim);
+            }
+        }
+
+        if (recebido == -1)
+        {
+            fprintf(stderr, "Erro: evento fora de ordem na linha %d de %s: %s\n", numero_linha, caminho, linha);
+            falhou = 1;
+        }
+    }
+
+    fprintf(stderr, "Fluxo: %" PRId64 " pontos, %" PRId64 " intervalos, %" PRId64 " intervalos escolhidos, %" PRId64 " pontos descobertos, pico de %d intervalos pendentes.\n",
+            fluxo.n_pontos, fluxo.n_intervalos, fluxo.n_solucao, fluxo.n_descobertos, fluxo.pico_pendentes);
+
+    fluxo_liberar(&fluxo);
+    if (entrada != stdin)
+    {
+        fclose(entrada);
+    }
+    if (saida != stdout)
+    {
+        fclose(saida);
+    }
+    else
+    {
+        fflush(saida);
+    }
+
+    return falhou;
+}
@@ -0,0 +1,278 @@
+#ifndef SOLUCIONADOR_GULOSO_H
+#define SOLUCIONADOR_GULOSO_H
+
+#include "cobertura.h"
+
+#define MOTOR_GULOSO_CLASSICO 0
+#define MOTOR_GULOSO_VARREDURA 1
+#define N_MOTORES_GULOSO 2
+
+/**
+ * @struct ConfiguracaoGuloso
+ * @brief Opções de execução do algoritmo guloso.
+ *
+ * Reúne as escolhas que não fazem parte da instância do problema,
+ * mas alteram a forma como ela é resolvida. Cada problema carrega
+ * sua própria cópia da configuração, definida antes da resolução.
+ */
+typedef struct
+{
+    int usar_bitset; /**< 1 para representar a cobertura em bitsets de 64 bits, 0 para o vetor de inteiros. */
+    int motor; /**< Estratégia gulosa utilizada (MOTOR_GULOSO_CLASSICO ou MOTOR_GULOSO_VARREDURA). */
+    int aplicar_reducao; /**< 1 para remover pontos e intervalos redundantes antes de resolver. */
+    int medir_contadores; /**< 1 para ler os contadores de hardware durante a escolha gulosa. */
+} ConfiguracaoGuloso;
+
+/**
+ * @struct CandidatoGanho
+ * @brief Entrada da fila de prioridade de intervalos candidatos do guloso clássico.
+ *
+ * O ganho de um intervalo (pontos descobertos que ele cobriria) só
+ * diminui durante a execução, então o último valor calculado é um
+ * limite superior. A fila é ordenada por esse limite e só recalcula o
+ * ganho do candidato do topo, até que o topo tenha ganho exato.
+ */
+typedef struct
+{
+    int intervalo; /**< Índice do intervalo candidato. */
+    int ganho; /**< Ganho do intervalo: exato ou limite superior. */
+    int exato; /**< 1 se `ganho` foi calculado na consulta atual, 0 caso contrário. */
+} CandidatoGanho;
+
+/**
+ * @struct Problema
+ * @brief Estrutura que encapsula todos os dados e métricas do problema
+ *        de cobertura de pontos com intervalos utilizando algoritmo guloso.
+ *
+ * Esta estrutura armazena:
+ * - Os pontos que devem ser cobertos;
+ * - Os intervalos disponíveis para realizar a cobertura;
+ * - O estado atual da cobertura durante a execução do algoritmo guloso;
+ * - A solução construída incrementalmente;
+ * - As métricas de desempenho obtidas ao final da execução.
+ *
+ * No algoritmo guloso, os intervalos são selecionados iterativamente
+ * com base em um critério de escolha (por exemplo, o intervalo que
+ * cobre o maior número de pontos ainda não cobertos), até que todos
+ * os pontos estejam cobertos ou não haja mais intervalos viáveis.
+ */
+typedef struct
+{
+    Intervalo *intervalos; /**< Vetor de intervalos disponíveis para cobertura. */
+    int n_intervalos; /**< Quantidade total de intervalos disponíveis. */
+    Ponto *pontos; /**< Vetor de pontos que devem ser cobertos. */
+    int n_pontos; /**< Quantidade total de pontos. */
+    int *pontos_cobertos; /**< Vetor auxiliar que indica se cada ponto já foi coberto (0 ou 1). */
+    int n_pontos_cobertos; /**< Número total de pontos já cobertos durante a execução. */
+    Intervalo *solucao; /**< Vetor de intervalos escolhidos pelo algoritmo guloso. */
+    int n_solucao; /**< Quantidade de intervalos presentes na solução gulosa. */
+    double tempo_execucao; /**< Tempo total de execução do algoritmo, em milissegundos. */
+    long memoria_utilizada; /**< Memória utilizada pelo algoritmo, em kilobytes. */
+    double qualidade; /**< Métrica de qualidade da solução obtida pelo algoritmo guloso. */
+    ConfiguracaoGuloso configuracao; /**< Opções de execução do algoritmo. */
+    int n_palavras; /**< Quantidade de palavras de 64 bits de cada bitset de pontos. */
+    uint64_t *mascaras; /**< Bitset dos pontos cobertos por cada intervalo (n_intervalos x n_palavras). */
+    uint64_t *pontos_cobertos_bits; /**< Bitset dos pontos já cobertos (usado no lugar de pontos_cobertos). */
+    Intervalo *intervalos_por_inicio; /**< Cópia dos intervalos ordenada por início, usada pela varredura. */
+    int *posicoes; /**< Posições dos pontos em vetor contíguo, lidas pelos laços de cobertura do guloso clássico. */
+    int *inicios; /**< Inícios dos intervalos em vetor contíguo. */
+    int *fins; /**< Fins dos intervalos em vetor contíguo. */
+    int *posto; /**< Para cada ponto, seu índice na ordem por posição (guloso clássico em vetor). */
+    int *faixa_inicio; /**< Para cada intervalo, posto do primeiro ponto que ele cobre. */
+    int *faixa_fim; /**< Para cada intervalo, posto seguinte ao do último ponto que ele cobre. */
+    int *arvore_descobertos; /**< Árvore de Fenwick sobre os postos, com 1 em cada ponto descoberto (n_pontos + 1 posições). */
+    int *proximo_descoberto; /**< Para cada posto, caminho até o primeiro posto descoberto a partir dele (conjuntos disjuntos). */
+    int proximo_ponto; /**< Nenhum ponto com índice menor que este está descoberto. */
+    int *intervalos_por_faixa; /**< Índices dos intervalos ordenados por `faixa_inicio`. */
+    int folhas_alcance; /**< Quantidade de folhas de `arvore_alcance`, potência de 2. */
+    int *arvore_alcance; /**< Árvore de segmentos com o maior `faixa_fim` de cada bloco de `intervalos_por_faixa`. */
+    int *ganho_estimado; /**< Último ganho calculado de cada intervalo, limite superior do ganho atual. */
+    CandidatoGanho *candidatos; /**< Fila de prioridade dos intervalos que cobrem o ponto atual. */
+    Reducao reducao; /**< Resumo da redução aplicada antes da resolução. */
+    CompressaoCoordenadas coordenadas; /**< Coordenadas originais, se a instância lida foi comprimida. */
+    Arena arena; /**< Memória da instância e das estruturas da resolução. */
+    size_t marcador_instancia; /**< Posição da arena logo após os pontos e intervalos. */
+    ContabilidadeMemoria memoria; /**< Memória usada pela resolução, na arena. */
+} Problema;
+
+/**
+ * @struct Metricas
+ * @brief Estrutura que armazena as métricas de desempenho do algoritmo guloso.
+ *
+ * Esta estrutura é utilizada para registrar e exportar os resultados
+ * obtidos após a execução do algoritmo guloso no problema de cobertura
+ * de pontos com intervalos.
+ *
+ * As métricas permitem avaliar:
+ * - O desempenho temporal do algoritmo;
+ * - O consumo de memória;
+ * - A qualidade da solução encontrada;
+ * - O tamanho da solução gerada.
+ *
+ * Esses dados são úteis para análises comparativas com outros algoritmos,
+ * como o backtracking.
+ */
+typedef struct
+{
+    double tempo; /**< Tempo total de execução do algoritmo, em milissegundos. */
+    double tempo_preparo; /**< Parte do tempo gasta em redução e alocação, em milissegundos. */
+    double tempo_busca; /**< Parte do tempo gasta apenas na escolha gulosa, em milissegundos. */
+    long memoria; /**< Memória utilizada durante a execução, em kilobytes. */
+    double qualidade; /**< Qualidade da solução gulosa obtida. */
+    int n_solucao; /**< Número de intervalos selecionados na solução final. */
+    size_t pico_memoria; /**< Pico de bytes em uso durante a resolução, incluindo a instância. */
+    int64_t n_alocacoes; /**< Quantidade de alocações feitas durante a resolução. */
+    long long contadores[N_CONTADORES_HARDWARE]; /**< Contadores de hardware da escolha gulosa (CONTADOR_*), ou -1 se não medidos. */
+} Metricas;
+
+/**
+ * @struct NoIncremental
+ * @brief Nó das árvores (treaps) da cobertura incremental.
+ *
+ * As três árvores de `CoberturaIncremental` usam o mesmo nó, ordenado
+ * pelo par (`chave`, `secundaria`) e equilibrado pela `prioridade`
+ * sorteada na criação:
+ * - pontos: `chave` é a posição, e `contagem` conta pontos repetidos;
+ * - intervalos: (`chave`, `secundaria`) é (início, fim), `contagem`
+ *   conta intervalos repetidos e `maximo` é o maior fim da subárvore;
+ * - passos da varredura: `chave` é a fronteira coberta após o passo,
+ *   `valor` é o ponto descoberto que originou o passo, `secundaria` é o
+ *   início do intervalo escolhido e `contagem` é 0 se nenhum intervalo
+ *   cobre o ponto.
+ */
+typedef struct
+{
+    int chave; /**< Primeira coordenada da ordem. */
+    int secundaria; /**< Segunda coordenada da ordem. */
+    int valor; /**< Dado adicional do nó (ponto de origem de um passo). */
+    int contagem; /**< Multiplicidade do nó, ou 1/0 para passos cobertos/descobertos. */
+    int maximo; /**< Maior `secundaria` da subárvore. */
+    uint32_t prioridade; /**< Prioridade do heap da treap. */
+    int esquerda; /**< Filho esquerdo, ou -1. */
+    int direita; /**< Filho direito, ou -1. */
+} NoIncremental;
+
+/**
+ * @struct CoberturaIncremental
+ * @brief Instância residente com a solução da varredura reparada a cada edição.
+ *
+ * Os pontos, os intervalos e os passos da varredura ficam em treaps
+ * sobre um mesmo vetor de nós, com os nós removidos reaproveitados por
+ * uma lista livre. A varredura só depende da fronteira já coberta, então
+ * uma edição em [esquerda, direita] refaz os passos a partir do último
+ * passo cuja fronteira fica antes de `esquerda` e para assim que um
+ * passo novo alcança uma fronteira antiga além de `direita`: dali em
+ * diante os passos antigos continuam válidos. Cada passo custa
+ * O(log(n + m)).
+ *
+ * Pontos que nenhum intervalo cobre viram passos descobertos e a
+ * varredura continua depois deles, de modo que a solução cobre todos os
+ * pontos que podem ser cobertos.
+ *
+ * As posições são `int` de 32 bits, no mesmo sistema da instância
+ * carregada. Se ela veio em postos de `comprimir_coordenadas`, as
+ * edições também precisam estar em postos, e um valor que não existia
+ * na instância não tem posto: os postos são calculados sobre todos os
+ * valores de uma vez, então a cobertura incremental só aceita edições
+ * sobre coordenadas que já cabem em `int`.
+ */
+typedef struct
+{
+    NoIncremental *nos; /**< Nós das três árvores. */
+    int n_nos; /**< Nós já usados do vetor, incluindo os da lista livre. */
+    int capacidade_nos; /**< Tamanho do vetor de nós. */
+    int livre; /**< Primeiro nó da lista livre (encadeada por `esquerda`), ou -1. */
+    int raiz_pontos; /**< Árvore dos pontos, por posição. */
+    int raiz_intervalos; /**< Árvore dos intervalos, por (início, fim). */
+    int raiz_passos; /**< Árvore dos passos da varredura, por fronteira. */
+    NoIncremental *passos_novos; /**< Passos produzidos pelo reparo em andamento. */
+    int capacidade_passos_novos; /**< Tamanho de `passos_novos`. */
+    GeradorAleatorio gerador; /**< Origem das prioridades dos nós. */
+    int n_pontos; /**< Quantidade de pontos, contando repetidos. */
+    int n_intervalos; /**< Quantidade de intervalos, contando repetidos. */
+    int n_solucao; /**< Intervalos escolhidos pela varredura. */
+    int n_descobertos; /**< Pontos distintos que nenhum intervalo cobre. */
+    int passos_refeitos; /**< Passos calculados pela última edição. */
+    int passos_removidos; /**< Passos antigos descartados pela última edição. */
+} CoberturaIncremental;
+
+/**
+ * @struct CoberturaFluxo
+ * @brief Estado da varredura gulosa sobre fluxos de pontos e intervalos.
+ *
+ * Os pontos chegam em ordem de posição e os intervalos em ordem de
+ * início, e todo intervalo com início até a posição de um ponto deve
+ * chegar antes dele. Como os intervalos chegam por início, o melhor
+ * intervalo da varredura para o ponto descoberto atual é o de maior fim
+ * entre todos os já liberados, e a escolha é definitiva assim que o
+ * ponto chega. Só os intervalos que começam depois do último ponto
+ * ficam guardados, em uma fila circular.
+ *
+ * As posições recebidas são `int` de 32 bits. O fluxo não pode usar os
+ * postos de `comprimir_coordenadas`, que precisam de todos os valores
+ * antes do primeiro; coordenadas de 64 bits devem ser deslocadas por
+ * quem envia os eventos para caber em `int`.
+ */
+typedef struct
+{
+    Intervalo *pendentes; /**< Fila circular dos intervalos que começam depois do último ponto. */
+    int capacidade_pendentes; /**< Tamanho de `pendentes`, potência de 2. */
+    int inicio_pendentes; /**< Posição do primeiro intervalo da fila. */
+    int n_pendentes; /**< Quantidade de intervalos na fila. */
+    int pico_pendentes; /**< Maior quantidade de intervalos guardados ao mesmo tempo. */
+    Intervalo melhor; /**< Intervalo liberado de maior fim (o primeiro, no empate). */
+    int tem_melhor; /**< 1 se algum intervalo já foi liberado. */
+    long long fronteira; /**< Maior posição coberta pelos intervalos emitidos. */
+    long long ultimo_ponto; /**< Posição do último ponto recebido. */
+    long long ultimo_inicio; /**< Início do último intervalo recebido. */
+    int interrompido; /**< 1 depois de um ponto que nenhum intervalo cobre. */
+    int64_t n_pontos; /**< Pontos recebidos. */
+    int64_t n_intervalos; /**< Intervalos recebidos. */
+    int64_t n_solucao; /**< Intervalos emitidos. */
+    int64_t n_descobertos; /**< Pontos não cobertos pelos intervalos emitidos. */
+} CoberturaFluxo;
+
+void inicializar_problema(Problema *problema);
+void liberar_problema(Problema *problema);
+int comparar_intervalos(const void *a, const void *b);
+const char *nome_motor_guloso(int motor);
+int alocar_instancia(Problema *problema, int n_pontos, int n_intervalos);
+int configurar_cenario(Problema *problema, int cenario);
+int gerar_instancia(Problema *problema, int n_pontos, int n_intervalos, int distribuicao, uint64_t semente);
+int ler_instancia(LeitorInstancia *leitor, Problema *problema);
+int ponto_esta_coberto(Problema *problema, int indice_ponto);
+void preencher_mascara_escalar(uint64_t *mascara, const int *posicoes, int primeiro, int n_pontos, int inicio, int fim);
+void preencher_mascara(uint64_t *mascara, const int *posicoes, int n_pontos, int inicio, int fim);
+int contar_pontos_novos(const uint64_t *mascara, const uint64_t *cobertura, int n_palavras);
+#ifdef DESPACHO_AVX2
+void preencher_mascara_avx2(uint64_t *mascara, const int *posicoes, int n_pontos, int inicio, int fim);
+int contar_pontos_novos_avx2(const uint64_t *mascara, const uint64_t *cobertura, int n_palavras);
+#endif
+Metricas resolver_guloso(Problema *problema);
+int motor_por_nome_guloso(const char *nome);
+
+/* Cobertura incremental. */
+int incremental_criar(CoberturaIncremental *cobertura, const InstanciaCobertura *instancia);
+void incremental_liberar(CoberturaIncremental *cobertura);
+int incremental_inserir_ponto(CoberturaIncremental *cobertura, int posicao);
+int incremental_remover_ponto(CoberturaIncremental *cobertura, int posicao);
+int incremental_inserir_intervalo(CoberturaIncremental *cobertura, Intervalo intervalo);
+int incremental_remover_intervalo(CoberturaIncremental *cobertura, Intervalo intervalo);
+int incremental_solucao(const CoberturaIncremental *cobertura, Intervalo *solucao);
+
+/* Cobertura sobre fluxos. */
+void fluxo_iniciar(CoberturaFluxo *fluxo);
+void fluxo_liberar(CoberturaFluxo *fluxo);
+int fluxo_receber_intervalo(CoberturaFluxo *fluxo, Intervalo intervalo);
+int fluxo_receber_ponto(CoberturaFluxo *fluxo, int posicao, Intervalo *emitido);
+
+/* Modo em lote. */
+void preencher_registro_guloso(RegistroExecucao *registro, const Problema *problema, const Metricas *metricas);
+void escrever_linha_edicao(const CoberturaIncremental *cobertura, const char *origem, int indice, int edicao, const char *operacao,
+                           double tempo_ms, FILE *saida);
+void registrar_edicoes_lote(Problema *problema, const char *caminho, const char *origem, int indice, FILE *saida);
+void escrever_resultado_lote_guloso(const Problema *problema, const Metricas *metricas, const char *origem, int indice, int n_pontos,
+                                    int n_intervalos, FILE *saida);
+int executar_fluxo(const char *caminho, const char *caminho_saida);
+
+#endif
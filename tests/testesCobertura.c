@@ -0,0 +1,735 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "cobertura.h"
+#include "solucionadorGuloso.h"
+#include "solucionadorBacktracking.h"
+
+#define VERIFICAR(condicao, descricao) verificar((condicao) != 0, (descricao), __FILE__, __LINE__)
+
+/** Quantidade de verificações feitas. */
+int n_verificacoes = 0;
+
+/** Quantidade de verificações que falharam. */
+int n_falhas = 0;
+
+/**
+ * @brief Registra o resultado de uma verificação e relata as falhas.
+ *
+ * @param condicao 1 se a verificação passou.
+ * @param descricao O que foi verificado.
+ * @param arquivo Arquivo da verificação.
+ * @param linha Linha da verificação.
+ */
+void verificar(int condicao, const char *descricao, const char *arquivo, int linha)
+{
+    n_verificacoes++;
+    if (condicao == 0)
+    {
+        n_falhas++;
+        fprintf(stderr, "%s:%d: falhou: %s\n", arquivo, linha, descricao);
+    }
+}
+
+/**
+ * @brief Instância sem pontos: todos os solucionadores devolvem a cobertura vazia, ótima.
+ *
+ * Vale com e sem intervalos e também na resolução por componentes.
+ */
+void testar_instancia_sem_pontos(void)
+{
+    Intervalo intervalos[2] = {{0, 5}, {3, 9}};
+    InstanciaCobertura instancia;
+
+    instancia.pontos = NULL;
+    instancia.n_pontos = 0;
+    instancia.intervalos = intervalos;
+
+    for (int n_intervalos = 0; n_intervalos <= 2; n_intervalos += 2)
+    {
+        instancia.n_intervalos = n_intervalos;
+        for (int solucionador = 0; solucionador < N_SOLUCIONADORES; solucionador++)
+        {
+            for (int decompor = 0; decompor <= 1; decompor++)
+            {
+                OpcoesCobertura opcoes;
+                ResultadoCobertura resultado;
+                char descricao[128];
+                int sucesso;
+
+                opcoes_cobertura_padrao(&opcoes);
+                opcoes.solucionador = solucionador;
+                opcoes.decompor = decompor;
+                opcoes.n_threads = 2;
+
+                snprintf(descricao, sizeof(descricao), "%s sem pontos, %d intervalos, decompor=%d: cobertura vazia e otima",
+                         nome_solucionador(solucionador), n_intervalos, decompor);
+                sucesso = resolver_cobertura(&instancia, &opcoes, &resultado);
+                VERIFICAR(sucesso && resultado.n_solucao == 0 && resultado.cobertura_completa && resultado.otima, descricao);
+                liberar_resultado_cobertura(&resultado);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Gera uma instância sintética com `gerar_instancia` e a expõe como `InstanciaCobertura`.
+ *
+ * @param problema Problema inicializado que guarda os vetores gerados.
+ * @param instancia Instância que passa a apontar para os vetores do problema.
+ * @param n_pontos Quantidade de pontos.
+ * @param n_intervalos Quantidade de intervalos.
+ * @param distribuicao Constante DISTRIBUICAO_*.
+ * @param semente Semente do gerador.
+ * @return 1 se a instância foi gerada, 0 caso contrário.
+ */
+int gerar_instancia_teste(Problema *problema, InstanciaCobertura *instancia, int n_pontos, int n_intervalos, int distribuicao,
+                          uint64_t semente)
+{
+    int resultado = gerar_instancia(problema, n_pontos, n_intervalos, distribuicao, semente);
+
+    instancia->pontos = problema->pontos;
+    instancia->n_pontos = problema->n_pontos;
+    instancia->intervalos = problema->intervalos;
+    instancia->n_intervalos = problema->n_intervalos;
+
+    return resultado;
+}
+
+/**
+ * @brief Indica se duas soluções têm os mesmos intervalos, na mesma ordem.
+ *
+ * @param a Primeiro resultado.
+ * @param b Segundo resultado.
+ * @return 1 se as soluções forem iguais, 0 caso contrário.
+ */
+int solucoes_iguais(const ResultadoCobertura *a, const ResultadoCobertura *b)
+{
+    int iguais = a->n_solucao == b->n_solucao;
+
+    for (int i = 0; iguais && i < a->n_solucao; i++)
+    {
+        iguais = a->solucao[i].inicio == b->solucao[i].inicio && a->solucao[i].fim == b->solucao[i].fim;
+    }
+
+    return iguais;
+}
+
+/**
+ * @brief Os laços sobre os vetores contíguos de coordenadas mantêm as soluções.
+ *
+ * O guloso clássico escolhe os mesmos intervalos nas duas
+ * representações (as máscaras e os desempates leem `posicoes`,
+ * `inicios` e `fins`), e os solucionadores exatos que percorrem os
+ * pontos ordenados chegam ao tamanho da varredura, que é ótimo. O
+ * paralelo enumera sem limitante inferior e por isso só roda na menor
+ * instância já reduzida, com 1, 2 e 4 threads.
+ */
+void testar_coordenadas_contiguas(void)
+{
+    int tamanhos[3][2] = {{40, 30}, {300, 200}, {1500, 1000}};
+    int exatos[3] = {SOLUCIONADOR_PODA, SOLUCIONADOR_DINAMICA, SOLUCIONADOR_PARALELO};
+    int threads[3] = {1, 2, 4};
+
+    for (int distribuicao = DISTRIBUICAO_UNIFORME; distribuicao <= DISTRIBUICAO_ADVERSARIA; distribuicao++)
+    {
+        for (int t = 0; t < 3; t++)
+        {
+            for (int reducao = 0; reducao <= 1; reducao++)
+            {
+                Problema gerado;
+                InstanciaCobertura instancia;
+                OpcoesCobertura opcoes;
+                ResultadoCobertura vetor, bitset, varredura;
+                char descricao[160];
+
+                inicializar_problema(&gerado);
+                VERIFICAR(gerar_instancia_teste(&gerado, &instancia, tamanhos[t][0], tamanhos[t][1], distribuicao, 7 + t), "gerar instancia");
+
+                opcoes_cobertura_padrao(&opcoes);
+                opcoes.aplicar_reducao = reducao;
+                opcoes.solucionador = SOLUCIONADOR_GULOSO;
+                resolver_cobertura(&instancia, &opcoes, &vetor);
+                opcoes.usar_bitset = 1;
+                resolver_cobertura(&instancia, &opcoes, &bitset);
+                opcoes.usar_bitset = 0;
+                opcoes.solucionador = SOLUCIONADOR_VARREDURA;
+                resolver_cobertura(&instancia, &opcoes, &varredura);
+
+                snprintf(descricao, sizeof(descricao), "guloso %s %dx%d reducao=%d: vetor e bitset escolhem os mesmos intervalos",
+                         nome_distribuicao(distribuicao), tamanhos[t][0], tamanhos[t][1], reducao);
+                VERIFICAR(solucoes_iguais(&vetor, &bitset), descricao);
+
+                for (int e = 0; e < 3; e++)
+                {
+                    int n_variantes = exatos[e] != SOLUCIONADOR_PARALELO ? 1 : (t == 0 && reducao ? 3 : 0);
+
+                    for (int v = 0; v < n_variantes; v++)
+                    {
+                        for (int usar_bitset = 0; usar_bitset <= 1; usar_bitset++)
+                        {
+                            ResultadoCobertura exato;
+
+                            opcoes.solucionador = exatos[e];
+                            opcoes.usar_bitset = usar_bitset;
+                            opcoes.n_threads = threads[v];
+                            resolver_cobertura(&instancia, &opcoes, &exato);
+                            snprintf(descricao, sizeof(descricao),
+                                     "%s %s %dx%d reducao=%d bitset=%d threads=%d: mesmo tamanho da varredura", nome_solucionador(exatos[e]),
+                                     nome_distribuicao(distribuicao), tamanhos[t][0], tamanhos[t][1], reducao, usar_bitset, threads[v]);
+                            VERIFICAR(exato.n_solucao == varredura.n_solucao && exato.cobertura_completa == varredura.cobertura_completa,
+                                      descricao);
+                            liberar_resultado_cobertura(&exato);
+                        }
+                    }
+                }
+
+                liberar_resultado_cobertura(&vetor);
+                liberar_resultado_cobertura(&bitset);
+                liberar_resultado_cobertura(&varredura);
+                liberar_problema(&gerado);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Os caminhos escalar e AVX2 dos núcleos do guloso em bitset dão o mesmo resultado.
+ *
+ * Compara as máscaras de `preencher_mascara_avx2` e
+ * `preencher_mascara_escalar`, e as contagens de
+ * `contar_pontos_novos_avx2` e `bitset_contar_novos`, em todos os
+ * tamanhos de resto e com extremos em `INT_MIN` e `INT_MAX`. Sem
+ * AVX2 na CPU, só o caminho despachado é conferido contra o escalar.
+ */
+void testar_nucleos_avx2(void)
+{
+    enum { MAX_PONTOS_TESTE = 300 };
+    int posicoes[MAX_PONTOS_TESTE];
+    uint64_t escalar[(MAX_PONTOS_TESTE + 63) / 64];
+    uint64_t vetorial[(MAX_PONTOS_TESTE + 63) / 64];
+    uint64_t cobertura[(MAX_PONTOS_TESTE + 63) / 64];
+    GeradorAleatorio gerador = {UINT64_C(0x9e3779b97f4a7c15)};
+    int divergencias_mascara = 0;
+    int divergencias_contagem = 0;
+    int usar_avx2 = 0;
+
+#ifdef DESPACHO_AVX2
+    usar_avx2 = __builtin_cpu_supports("avx2");
+#endif
+
+    for (int caso = 0; caso < 4000; caso++)
+    {
+        int n_pontos = caso % (MAX_PONTOS_TESTE + 1);
+        int n_palavras = calcular_palavras_bitset(n_pontos);
+        int inicio = caso % 7 == 0 ? INT_MIN : gerador_uniforme(&gerador, 2000) - 1000;
+        int fim = caso % 11 == 0 ? INT_MAX : inicio + gerador_uniforme(&gerador, 1500);
+
+        for (int j = 0; j < n_pontos; j++)
+        {
+            posicoes[j] = j % 13 == 0 ? (j % 2 ? INT_MAX : INT_MIN) : gerador_uniforme(&gerador, 3000) - 1500;
+        }
+        for (int w = 0; w < n_palavras; w++)
+        {
+            cobertura[w] = gerador_proximo(&gerador);
+        }
+
+        memset(escalar, 0, sizeof(escalar));
+        memset(vetorial, 0, sizeof(vetorial));
+        preencher_mascara_escalar(escalar, posicoes, 0, n_pontos, inicio, fim);
+        preencher_mascara(vetorial, posicoes, n_pontos, inicio, fim);
+#ifdef DESPACHO_AVX2
+        if (usar_avx2)
+        {
+            uint64_t avx2[(MAX_PONTOS_TESTE + 63) / 64];
+
+            memset(avx2, 0, sizeof(avx2));
+            preencher_mascara_avx2(avx2, posicoes, n_pontos, inicio, fim);
+            divergencias_mascara += memcmp(avx2, escalar, sizeof(escalar)) != 0;
+            divergencias_contagem += contar_pontos_novos_avx2(escalar, cobertura, n_palavras) !=
+                                     bitset_contar_novos(escalar, cobertura, n_palavras);
+        }
+#endif
+        divergencias_mascara += memcmp(vetorial, escalar, sizeof(escalar)) != 0;
+        divergencias_contagem += contar_pontos_novos(escalar, cobertura, n_palavras) != bitset_contar_novos(escalar, cobertura, n_palavras);
+    }
+
+    VERIFICAR(divergencias_mascara == 0, usar_avx2 ? "preencher_mascara: caminhos escalar e AVX2 iguais"
+                                                   : "preencher_mascara: caminho despachado igual ao escalar (sem AVX2)");
+    VERIFICAR(divergencias_contagem == 0, usar_avx2 ? "contar_pontos_novos: caminhos escalar e AVX2 iguais"
+                                                    : "contar_pontos_novos: caminho despachado igual ao escalar (sem AVX2)");
+}
+
+/**
+ * @brief As faixas por busca binária contêm exatamente os pontos de cada intervalo.
+ *
+ * Depois da resolução, confere `faixa_inicio` e `faixa_fim` contra o
+ * teste direto de pertinência: no guloso clássico em vetor, pelo posto
+ * de cada ponto; no backtracking, pelo índice, já que os pontos ficam
+ * ordenados. As instâncias agrupadas têm muitas posições repetidas.
+ */
+void testar_faixas_intervalos(void)
+{
+    for (int distribuicao = DISTRIBUICAO_UNIFORME; distribuicao <= DISTRIBUICAO_ANINHADA; distribuicao++)
+    {
+        Problema guloso;
+        ProblemaBacktracking exato;
+        int erradas_guloso = 0;
+        int erradas_exato = 0;
+        char descricao[128];
+
+        inicializar_problema(&guloso);
+        gerar_instancia(&guloso, 400, 300, distribuicao, 11);
+        resolver_guloso(&guloso);
+        for (int i = 0; i < guloso.n_intervalos; i++)
+        {
+            for (int j = 0; j < guloso.n_pontos; j++)
+            {
+                int dentro = ponto_coberto_por_intervalo(guloso.pontos[j].posicao, guloso.intervalos[i].inicio, guloso.intervalos[i].fim);
+                int na_faixa = guloso.posto[j] >= guloso.faixa_inicio[i] && guloso.posto[j] < guloso.faixa_fim[i];
+
+                erradas_guloso += dentro != na_faixa;
+            }
+        }
+
+        inicializar_problema_backtracking(&exato);
+        exato.configuracao.motor = MOTOR_BACKTRACKING_DINAMICA;
+        gerar_instancia_backtracking(&exato, 400, 300, distribuicao, 11);
+        resolver_backtracking(&exato);
+        for (int i = 0; i < exato.n_intervalos; i++)
+        {
+            for (int j = 0; j < exato.n_pontos; j++)
+            {
+                int dentro = ponto_coberto_por_intervalo(exato.pontos[j].posicao, exato.intervalos[i].inicio, exato.intervalos[i].fim);
+                int na_faixa = j >= exato.faixa_inicio[i] && j < exato.faixa_fim[i];
+
+                erradas_exato += dentro != na_faixa;
+            }
+        }
+
+        snprintf(descricao, sizeof(descricao), "faixas do guloso %s iguais ao teste de pertinencia", nome_distribuicao(distribuicao));
+        VERIFICAR(guloso.posto != NULL && erradas_guloso == 0, descricao);
+        snprintf(descricao, sizeof(descricao), "faixas do backtracking %s iguais ao teste de pertinencia", nome_distribuicao(distribuicao));
+        VERIFICAR(exato.faixa_inicio != NULL && erradas_exato == 0, descricao);
+
+        liberar_problema(&guloso);
+        liberar_problema_backtracking(&exato);
+    }
+}
+
+/**
+ * @brief Indica se todos os pontos estão em algum intervalo da solução.
+ *
+ * @param pontos Pontos da instância.
+ * @param n_pontos Quantidade de pontos.
+ * @param solucao Intervalos da solução.
+ * @param n_solucao Quantidade de intervalos da solução.
+ * @return 1 se a solução cobre todos os pontos, 0 caso contrário.
+ */
+int solucao_cobre_pontos(const Ponto *pontos, int n_pontos, const Intervalo *solucao, int n_solucao)
+{
+    int cobre = 1;
+
+    for (int j = 0; cobre && j < n_pontos; j++)
+    {
+        cobre = 0;
+        for (int i = 0; cobre == 0 && i < n_solucao; i++)
+        {
+            cobre = ponto_coberto_por_intervalo(pontos[j].posicao, solucao[i].inicio, solucao[i].fim);
+        }
+    }
+
+    return cobre;
+}
+
+/**
+ * @brief O cache devolve, para instâncias repetidas e transladadas, soluções do tamanho da varredura.
+ *
+ * Cada instância é resolvida pelo motor com poda através do cache e
+ * depois consultada de novo transladada: a segunda consulta deve ser
+ * um acerto, com uma solução que cobre os pontos transladados e tem o
+ * tamanho ótimo da varredura. Com a capacidade de uma única entrada,
+ * as entradas antigas são removidas e as respostas continuam corretas.
+ */
+void testar_cache_solucoes(void)
+{
+    size_t capacidades[2] = {(size_t)1 << 24, 1};
+
+    for (int c = 0; c < 2; c++)
+    {
+        CacheCobertura cache;
+        int erradas = 0;
+        int acertos_esperados = 0;
+        char descricao[128];
+
+        VERIFICAR(cache_criar(&cache, capacidades[c]), "criar cache");
+        for (int distribuicao = DISTRIBUICAO_UNIFORME; distribuicao <= DISTRIBUICAO_ADVERSARIA; distribuicao++)
+        {
+            Problema gerado, transladado;
+            InstanciaCobertura instancia, copia;
+            OpcoesCobertura opcoes;
+            ResultadoCobertura varredura, primeiro, segundo;
+
+            inicializar_problema(&gerado);
+            inicializar_problema(&transladado);
+            gerar_instancia_teste(&gerado, &instancia, 300, 250, distribuicao, 5);
+            gerar_instancia_teste(&transladado, &copia, 300, 250, distribuicao, 5);
+            for (int j = 0; j < copia.n_pontos; j++)
+            {
+                transladado.pontos[j].posicao += 1000;
+            }
+            for (int i = 0; i < copia.n_intervalos; i++)
+            {
+                transladado.intervalos[i].inicio += 1000;
+                transladado.intervalos[i].fim += 1000;
+            }
+
+            opcoes_cobertura_padrao(&opcoes);
+            opcoes.solucionador = SOLUCIONADOR_VARREDURA;
+            resolver_cobertura(&instancia, &opcoes, &varredura);
+            opcoes.solucionador = SOLUCIONADOR_PODA;
+            resolver_cobertura_com_cache(&cache, &instancia, &opcoes, &primeiro);
+            resolver_cobertura_com_cache(&cache, &copia, &opcoes, &segundo);
+
+            acertos_esperados += capacidades[c] > 1;
+            erradas += primeiro.do_cache || primeiro.n_solucao != varredura.n_solucao;
+            erradas += segundo.n_solucao != varredura.n_solucao || segundo.cobertura_completa != varredura.cobertura_completa;
+            erradas += segundo.cobertura_completa && solucao_cobre_pontos(copia.pontos, copia.n_pontos, segundo.solucao, segundo.n_solucao) == 0;
+
+            liberar_resultado_cobertura(&varredura);
+            liberar_resultado_cobertura(&primeiro);
+            liberar_resultado_cobertura(&segundo);
+            liberar_problema(&gerado);
+            liberar_problema(&transladado);
+        }
+
+        snprintf(descricao, sizeof(descricao), "cache de %zu bytes: solucoes do tamanho da varredura", capacidades[c]);
+        VERIFICAR(erradas == 0, descricao);
+        snprintf(descricao, sizeof(descricao), "cache de %zu bytes: acertos nas instancias transladadas", capacidades[c]);
+        VERIFICAR(cache.acertos == acertos_esperados, descricao);
+        cache_liberar(&cache);
+    }
+}
+
+/**
+ * @brief A cobertura incremental acompanha a varredura refeita do zero a cada edição.
+ *
+ * Aplica inserções e remoções aleatórias de pontos e intervalos (parte
+ * delas de elementos ausentes, que devem ser recusadas) à cobertura
+ * incremental e a uma cópia da instância. Depois de cada edição, a
+ * solução reparada deve cobrir todo ponto que algum intervalo cobre,
+ * `n_descobertos` deve contar as posições sem intervalo e, quando não
+ * há pontos descobertos, a solução deve ser a mesma de
+ * `executar_guloso_varredura` sobre a cópia. Os intervalos curtos
+ * deixam pontos descobertos; os longos cobrem a instância inteira.
+ */
+void testar_cobertura_incremental(void)
+{
+    enum { MAX_ELEMENTOS_TESTE = 600 };
+    Ponto pontos[MAX_ELEMENTOS_TESTE];
+    Intervalo intervalos[MAX_ELEMENTOS_TESTE];
+    Intervalo solucao[MAX_ELEMENTOS_TESTE];
+    GeradorAleatorio gerador = {UINT64_C(0x2545f4914f6cdd1d)};
+    int tamanhos_intervalo[2] = {40, 400};
+
+    for (int t = 0; t < 2; t++)
+    {
+        InstanciaCobertura instancia;
+        CoberturaIncremental cobertura;
+        int n_pontos = 150, n_intervalos = 200;
+        int divergencias = 0, recusas_erradas = 0, comparacoes = 0;
+        char descricao[128];
+
+        for (int j = 0; j < n_pontos; j++)
+        {
+            pontos[j].id = j;
+            pontos[j].posicao = gerador_uniforme(&gerador, 2000);
+        }
+        for (int i = 0; i < n_intervalos; i++)
+        {
+            intervalos[i].inicio = gerador_uniforme(&gerador, 2000) - 50;
+            intervalos[i].fim = intervalos[i].inicio + gerador_uniforme(&gerador, tamanhos_intervalo[t]);
+        }
+        instancia.pontos = pontos;
+        instancia.n_pontos = n_pontos;
+        instancia.intervalos = intervalos;
+        instancia.n_intervalos = n_intervalos;
+        VERIFICAR(incremental_criar(&cobertura, &instancia), "criar cobertura incremental");
+
+        for (int edicao = 0; edicao < 1500; edicao++)
+        {
+            int tipo = gerador_uniforme(&gerador, 4);
+            int ausente = gerador_uniforme(&gerador, 8) == 0;
+            int descobertos = 0;
+            int n_solucao;
+
+            if (tipo == 0 && n_pontos < MAX_ELEMENTOS_TESTE)
+            {
+                pontos[n_pontos].id = n_pontos;
+                pontos[n_pontos].posicao = gerador_uniforme(&gerador, 2000);
+                incremental_inserir_ponto(&cobertura, pontos[n_pontos].posicao);
+                n_pontos++;
+            }
+            else if (tipo == 1 && ausente)
+            {
+                recusas_erradas += incremental_remover_ponto(&cobertura, 5000 + edicao) != 0;
+            }
+            else if (tipo == 1 && n_pontos > 0)
+            {
+                int j = gerador_uniforme(&gerador, n_pontos);
+
+                recusas_erradas += incremental_remover_ponto(&cobertura, pontos[j].posicao) == 0;
+                pontos[j] = pontos[--n_pontos];
+            }
+            else if (tipo == 2 && n_intervalos < MAX_ELEMENTOS_TESTE)
+            {
+                intervalos[n_intervalos].inicio = gerador_uniforme(&gerador, 2000) - 50;
+                intervalos[n_intervalos].fim = intervalos[n_intervalos].inicio + gerador_uniforme(&gerador, tamanhos_intervalo[t]);
+                incremental_inserir_intervalo(&cobertura, intervalos[n_intervalos]);
+                n_intervalos++;
+            }
+            else if (tipo == 3 && ausente)
+            {
+                Intervalo inexistente = {5000 + edicao, 5000 + edicao};
+
+                recusas_erradas += incremental_remover_intervalo(&cobertura, inexistente) != 0;
+            }
+            else if (tipo == 3 && n_intervalos > 0)
+            {
+                int i = gerador_uniforme(&gerador, n_intervalos);
+
+                recusas_erradas += incremental_remover_intervalo(&cobertura, intervalos[i]) == 0;
+                intervalos[i] = intervalos[--n_intervalos];
+            }
+
+            instancia.n_pontos = n_pontos;
+            instancia.n_intervalos = n_intervalos;
+            n_solucao = incremental_solucao(&cobertura, solucao);
+
+            for (int j = 0; j < n_pontos; j++)
+            {
+                int coberto_por_algum = solucao_cobre_pontos(&pontos[j], 1, intervalos, n_intervalos);
+                int repetido = 0;
+
+                for (int k = 0; k < j && repetido == 0; k++)
+                {
+                    repetido = pontos[k].posicao == pontos[j].posicao;
+                }
+                descobertos += coberto_por_algum == 0 && repetido == 0;
+                divergencias += coberto_por_algum && solucao_cobre_pontos(&pontos[j], 1, solucao, n_solucao) == 0;
+            }
+            divergencias += descobertos != cobertura.n_descobertos;
+            divergencias += cobertura.n_pontos != n_pontos || cobertura.n_intervalos != n_intervalos || n_solucao != cobertura.n_solucao;
+
+            if (descobertos == 0)
+            {
+                OpcoesCobertura opcoes;
+                ResultadoCobertura varredura;
+                ResultadoCobertura reparada;
+
+                opcoes_cobertura_padrao(&opcoes);
+                opcoes.solucionador = SOLUCIONADOR_VARREDURA;
+                resolver_cobertura(&instancia, &opcoes, &varredura);
+                reparada.n_solucao = n_solucao;
+                reparada.solucao = solucao;
+                divergencias += solucoes_iguais(&varredura, &reparada) == 0;
+                comparacoes++;
+                liberar_resultado_cobertura(&varredura);
+            }
+        }
+
+        snprintf(descricao, sizeof(descricao), "cobertura incremental (intervalos ate %d): mesma solucao da varredura", tamanhos_intervalo[t]);
+        VERIFICAR(divergencias == 0, descricao);
+        snprintf(descricao, sizeof(descricao), "cobertura incremental (intervalos ate %d): remocoes de ausentes recusadas", tamanhos_intervalo[t]);
+        VERIFICAR(recusas_erradas == 0, descricao);
+        VERIFICAR(t == 0 || comparacoes > 0, "cobertura incremental: edicoes sem pontos descobertos comparadas");
+        incremental_liberar(&cobertura);
+    }
+}
+
+/**
+ * @brief A varredura sobre fluxos emite os mesmos intervalos de `executar_guloso_varredura`.
+ *
+ * Os pontos ordenados e os intervalos ordenados por início são
+ * intercalados em um único fluxo, com cada intervalo entregue antes do
+ * primeiro ponto que ele alcança. Os intervalos emitidos devem ser a
+ * solução da varredura, inclusive a parcial das instâncias sem
+ * cobertura. Um intervalo que chega depois de um ponto que ele alcança
+ * deve ser recusado.
+ */
+void testar_cobertura_fluxo(void)
+{
+    for (int distribuicao = DISTRIBUICAO_UNIFORME; distribuicao <= DISTRIBUICAO_ADVERSARIA; distribuicao++)
+    {
+        Problema gerado;
+        InstanciaCobertura instancia;
+        OpcoesCobertura opcoes;
+        ResultadoCobertura varredura, emitidos;
+        CoberturaFluxo fluxo;
+        Ponto *pontos;
+        Intervalo *intervalos;
+        int proximo_intervalo = 0;
+        int recusados = 0;
+        char descricao[128];
+
+        inicializar_problema(&gerado);
+        gerar_instancia_teste(&gerado, &instancia, 2000, 1500, distribuicao, 3);
+        opcoes_cobertura_padrao(&opcoes);
+        opcoes.solucionador = SOLUCIONADOR_VARREDURA;
+        resolver_cobertura(&instancia, &opcoes, &varredura);
+
+        pontos = (Ponto *)malloc((size_t)instancia.n_pontos * sizeof(Ponto));
+        intervalos = (Intervalo *)malloc((size_t)instancia.n_intervalos * sizeof(Intervalo));
+        emitidos.solucao = (Intervalo *)malloc((size_t)instancia.n_pontos * sizeof(Intervalo));
+        emitidos.n_solucao = 0;
+        memcpy(pontos, instancia.pontos, (size_t)instancia.n_pontos * sizeof(Ponto));
+        memcpy(intervalos, instancia.intervalos, (size_t)instancia.n_intervalos * sizeof(Intervalo));
+        qsort(pontos, instancia.n_pontos, sizeof(Ponto), comparar_pontos);
+        qsort(intervalos, instancia.n_intervalos, sizeof(Intervalo), comparar_intervalos_por_inicio);
+
+        fluxo_iniciar(&fluxo);
+        for (int j = 0; j < instancia.n_pontos; j++)
+        {
+            while (proximo_intervalo < instancia.n_intervalos && intervalos[proximo_intervalo].inicio <= pontos[j].posicao)
+            {
+                recusados += fluxo_receber_intervalo(&fluxo, intervalos[proximo_intervalo++]) != 1;
+            }
+            emitidos.n_solucao += fluxo_receber_ponto(&fluxo, pontos[j].posicao, &emitidos.solucao[emitidos.n_solucao]) == 1;
+        }
+        while (proximo_intervalo < instancia.n_intervalos)
+        {
+            recusados += fluxo_receber_intervalo(&fluxo, intervalos[proximo_intervalo++]) != 1;
+        }
+
+        snprintf(descricao, sizeof(descricao), "fluxo %s: intervalos emitidos iguais a solucao da varredura", nome_distribuicao(distribuicao));
+        VERIFICAR(recusados == 0 && solucoes_iguais(&varredura, &emitidos), descricao);
+        snprintf(descricao, sizeof(descricao), "fluxo %s: contagens de pontos, intervalos e descobertos", nome_distribuicao(distribuicao));
+        VERIFICAR(fluxo.n_pontos == instancia.n_pontos && fluxo.n_intervalos == instancia.n_intervalos &&
+                      fluxo.n_solucao == emitidos.n_solucao && (fluxo.n_descobertos == 0) == varredura.cobertura_completa,
+                  descricao);
+        if (instancia.n_pontos > 0)
+        {
+            Intervalo atrasado = {pontos[instancia.n_pontos - 1].posicao, pontos[instancia.n_pontos - 1].posicao};
+
+            snprintf(descricao, sizeof(descricao), "fluxo %s: intervalo fora de ordem recusado", nome_distribuicao(distribuicao));
+            VERIFICAR(fluxo_receber_intervalo(&fluxo, atrasado) == -1, descricao);
+        }
+
+        fluxo_liberar(&fluxo);
+        free(pontos);
+        free(intervalos);
+        free(emitidos.solucao);
+        liberar_resultado_cobertura(&varredura);
+        liberar_problema(&gerado);
+    }
+}
+
+/**
+ * @brief Lê o cabeçalho de uma instância gravada em um arquivo temporário.
+ *
+ * @param conteudo Bytes do arquivo.
+ * @param tamanho Quantidade de bytes.
+ * @param n_pontos Destino da quantidade de pontos lida.
+ * @param n_intervalos Destino da quantidade de intervalos lida.
+ * @return O retorno de `ler_cabecalho_instancia`, ou -2 se o arquivo não pôde ser criado.
+ */
+int ler_cabecalho_arquivo(const void *conteudo, size_t tamanho, int *n_pontos, int *n_intervalos)
+{
+    char caminho[] = "/tmp/testesCoberturaXXXXXX";
+    LeitorInstancia leitor;
+    int formato;
+    int resultado = -2;
+    int descritor = mkstemp(caminho);
+
+    if (descritor >= 0)
+    {
+        if (write(descritor, conteudo, tamanho) == (ssize_t)tamanho && leitor_abrir(&leitor, caminho))
+        {
+            resultado = ler_cabecalho_instancia(&leitor, &formato, n_pontos, n_intervalos);
+            leitor_fechar(&leitor);
+        }
+        close(descritor);
+        unlink(caminho);
+    }
+
+    return resultado;
+}
+
+/**
+ * @brief Cabeçalhos grandes demais ou maiores que o arquivo são recusados antes da alocação.
+ *
+ * Cobre o texto e os dois formatos binários: quantidades acima de
+ * `MAX_ELEMENTOS_INSTANCIA` e quantidades que não cabem nos bytes
+ * restantes do arquivo mapeado, ao lado de instâncias válidas que
+ * terminam exatamente no último byte.
+ */
+void testar_cabecalhos_instancia(void)
+{
+    struct
+    {
+        const char *descricao;
+        int32_t n_pontos;
+        int32_t n_intervalos;
+        int32_t n_valores; /* valores de fato gravados após o cabeçalho */
+        int esperado;
+    } binarios[] = {
+        {"n_pontos 0x7fffffff", INT32_C(0x7fffffff), 0, 0, -1},
+        {"n_intervalos acima do maximo", 1, MAX_ELEMENTOS_INSTANCIA + 1, 1, -1},
+        {"valores truncados", 1000, 1000, 10, -1},
+        {"ultimo valor faltando", 2, 1, 3, -1},
+        {"instancia completa", 2, 1, 4, 1},
+    };
+    const char *textos[][2] = {
+        {"2000000000 2000000000\n", "-1"},
+        {"100000001 0\n", "-1"},
+        {"5 3\n1 2 3\n", "-1"},
+        {"2 1\n1 2\n0", "-1"},
+        {"2 1\n1 2\n0 5", "1"},
+        {"# comentario\n1 0\n7\n", "1"},
+    };
+    char descricao[160];
+    int n_pontos, n_intervalos;
+
+    for (size_t k = 0; k < sizeof(textos) / sizeof(textos[0]); k++)
+    {
+        snprintf(descricao, sizeof(descricao), "cabecalho em texto \"%.20s...\": retorno %s", textos[k][0], textos[k][1]);
+        VERIFICAR(ler_cabecalho_arquivo(textos[k][0], strlen(textos[k][0]), &n_pontos, &n_intervalos) == atoi(textos[k][1]), descricao);
+    }
+
+    for (int largura = 4; largura <= 8; largura += 4)
+    {
+        for (size_t k = 0; k < sizeof(binarios) / sizeof(binarios[0]); k++)
+        {
+            unsigned char conteudo[12 + 8 * 16];
+            size_t tamanho = 12 + (size_t)largura * binarios[k].n_valores;
+
+            memset(conteudo, 0, sizeof(conteudo));
+            memcpy(conteudo, largura == 4 ? ASSINATURA_INSTANCIA_BINARIA : ASSINATURA_INSTANCIA_BINARIA_64, 4);
+            memcpy(conteudo + 4, &binarios[k].n_pontos, sizeof(int32_t));
+            memcpy(conteudo + 8, &binarios[k].n_intervalos, sizeof(int32_t));
+            snprintf(descricao, sizeof(descricao), "cabecalho %s com %s: retorno %d", largura == 4 ? "CPI1" : "CPI2",
+                     binarios[k].descricao, binarios[k].esperado);
+            VERIFICAR(ler_cabecalho_arquivo(conteudo, tamanho, &n_pontos, &n_intervalos) == binarios[k].esperado, descricao);
+        }
+    }
+}
+
+int main(void)
+{
+    testar_instancia_sem_pontos();
+    testar_coordenadas_contiguas();
+    testar_nucleos_avx2();
+    testar_faixas_intervalos();
+    testar_cache_solucoes();
+    testar_cobertura_incremental();
+    testar_cobertura_fluxo();
+    testar_cabecalhos_instancia();
+
+    printf("%d verificacoes, %d falhas.\n", n_verificacoes, n_falhas);
+
+    return n_falhas > 0;
+}